@@ -0,0 +1,348 @@
+/**
+ * @file asset_loader.c
+ * @brief Implementation of asynchronous asset loading
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "asset_loader.h"
+#include "config.h"
+
+/**
+ * @brief Decode worker entry point
+ *
+ * Takes queued requests in order and decodes their image files, or maps
+ * their cache blobs.
+ *
+ * @param userData Pointer to loader
+ */
+static void AssetLoaderWorkerMain(void* userData) {
+    AssetLoader* loader = (AssetLoader*)userData;
+
+    PlatformMutexLock(loader->mutex);
+    for (;;) {
+        while (loader->nextQueued >= loader->count && !loader->quit) {
+            PlatformConditionWait(loader->workAvailable, loader->mutex);
+        }
+        if (loader->quit) break;
+
+        int index = loader->nextQueued++;
+        loader->requests[index].state = ASSET_STATE_DECODING;
+
+        // The path string is never moved, only the request array is
+        char* filePath = loader->requests[index].filePath;
+
+        // Map the pre-baked blob, or decode, without holding the lock
+        PlatformMutexUnlock(loader->mutex);
+
+        TextureCacheEntry cached;
+        bool fromCache = TextureCacheOpen(filePath, &cached);
+        Image image = fromCache ? cached.image : LoadImage(filePath);
+
+        if (!fromCache && image.data != NULL && ASSET_CACHE_WRITE_ON_MISS) {
+            TextureCacheStore(filePath, image);
+        }
+
+        PlatformMutexLock(loader->mutex);
+
+        AssetRequest* request = &loader->requests[index];
+        if (image.data == NULL) {
+            TraceLog(LOG_ERROR, "Failed to load image: %s", filePath);
+            request->state = ASSET_STATE_FAILED;
+            loader->failedCount++;
+            loader->finishedCount++;
+        }
+        else {
+            request->image = image;
+            request->fromCache = fromCache;
+            if (fromCache) {
+                request->cached = cached;
+            }
+            request->state = ASSET_STATE_DECODED;
+        }
+        loader->decodedCount++;
+    }
+    PlatformMutexUnlock(loader->mutex);
+}
+
+/**
+ * @brief Create an asset loader and start its workers
+ *
+ * @param threadCount Number of decode worker threads
+ * @return AssetLoader* Pointer to created loader or NULL if failed
+ */
+AssetLoader* AssetLoaderCreate(int threadCount) {
+    if (threadCount < 1) threadCount = 1;
+    if (threadCount > ASSET_LOADER_MAX_THREADS) threadCount = ASSET_LOADER_MAX_THREADS;
+
+    AssetLoader* loader = (AssetLoader*)calloc(1, sizeof(AssetLoader));
+    if (!loader) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for asset loader");
+        return NULL;
+    }
+
+    loader->capacity = TEXTURE_COUNT;
+    loader->requests = (AssetRequest*)malloc(sizeof(AssetRequest) * loader->capacity);
+    loader->mutex = PlatformMutexCreate();
+    loader->workAvailable = PlatformConditionCreate();
+
+    if (!loader->requests || !loader->mutex || !loader->workAvailable) {
+        TraceLog(LOG_ERROR, "Failed to allocate asset loader resources");
+        AssetLoaderDestroy(loader);
+        return NULL;
+    }
+
+    // Start decode workers
+    for (int i = 0; i < threadCount; i++) {
+        PlatformThread* worker = PlatformThreadCreate(AssetLoaderWorkerMain, loader);
+        if (!worker) {
+            TraceLog(LOG_WARNING, "Failed to start asset worker %d", i);
+            break;
+        }
+        loader->workers[loader->workerCount++] = worker;
+    }
+
+    if (loader->workerCount == 0) {
+        TraceLog(LOG_ERROR, "No asset workers could be started");
+        AssetLoaderDestroy(loader);
+        return NULL;
+    }
+
+    return loader;
+}
+
+/**
+ * @brief Stop the workers and free the loader
+ *
+ * @param loader Pointer to loader
+ */
+void AssetLoaderDestroy(AssetLoader* loader) {
+    if (!loader) return;
+
+    // Stop workers (a worker in the middle of a decode finishes it first)
+    if (loader->mutex) {
+        PlatformMutexLock(loader->mutex);
+        loader->quit = true;
+        PlatformConditionBroadcast(loader->workAvailable);
+        PlatformMutexUnlock(loader->mutex);
+    }
+
+    for (int i = 0; i < loader->workerCount; i++) {
+        PlatformThreadJoin(loader->workers[i]);
+    }
+
+    // Release images that were never uploaded
+    for (int i = 0; i < loader->count; i++) {
+        if (loader->requests[i].state == ASSET_STATE_DECODED) {
+            if (loader->requests[i].fromCache) {
+                TextureCacheClose(&loader->requests[i].cached);
+            }
+            else {
+                UnloadImage(loader->requests[i].image);
+            }
+        }
+        free(loader->requests[i].filePath);
+    }
+
+    PlatformConditionDestroy(loader->workAvailable);
+    PlatformMutexDestroy(loader->mutex);
+    free(loader->requests);
+    free(loader);
+}
+
+/**
+ * @brief Queue a texture for loading
+ *
+ * @param loader Pointer to loader
+ * @param id Texture ID
+ * @param filePath Path to image file
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the request was queued
+ */
+bool AssetLoaderQueueTexture(AssetLoader* loader, TextureID id, const char* filePath, int tileWidth, int tileHeight) {
+    if (!loader || id < 0 || id >= TEXTURE_COUNT || !filePath) return false;
+
+    char* pathCopy = _strdup(filePath);
+    if (!pathCopy) return false;
+
+    PlatformMutexLock(loader->mutex);
+
+    // Grow the request array if needed
+    if (loader->count >= loader->capacity) {
+        int newCapacity = loader->capacity * 2;
+        AssetRequest* newRequests = (AssetRequest*)realloc(loader->requests, sizeof(AssetRequest) * newCapacity);
+        if (!newRequests) {
+            PlatformMutexUnlock(loader->mutex);
+            TraceLog(LOG_ERROR, "Failed to expand asset request array");
+            free(pathCopy);
+            return false;
+        }
+
+        loader->requests = newRequests;
+        loader->capacity = newCapacity;
+    }
+
+    AssetRequest* request = &loader->requests[loader->count];
+    request->id = id;
+    request->filePath = pathCopy;
+    request->tileWidth = tileWidth;
+    request->tileHeight = tileHeight;
+    request->state = ASSET_STATE_QUEUED;
+    request->image = (Image){ 0 };
+    request->fromCache = false;
+    loader->count++;
+
+    PlatformConditionSignal(loader->workAvailable);
+    PlatformMutexUnlock(loader->mutex);
+
+    return true;
+}
+
+/**
+ * @brief Queue all initial game textures
+ *
+ * @param loader Pointer to loader
+ * @return bool Whether every texture was queued
+ */
+bool AssetLoaderQueueGameAssets(AssetLoader* loader) {
+    if (!loader) return false;
+
+    const TextureAssetDesc* assets = NULL;
+    int assetCount = TextureManagerGetGameAssets(&assets);
+
+    bool success = true;
+    for (int i = 0; i < assetCount; i++) {
+        success &= AssetLoaderQueueTexture(
+            loader,
+            assets[i].id,
+            assets[i].filePath,
+            assets[i].tileWidth,
+            assets[i].tileHeight
+        );
+    }
+
+    return success;
+}
+
+/**
+ * @brief Upload decoded images to the GPU
+ *
+ * @param loader Pointer to loader
+ * @param manager Texture manager receiving the textures
+ * @param budgetSeconds Time budget for this call in seconds
+ */
+void AssetLoaderUpdate(AssetLoader* loader, TextureManager* manager, double budgetSeconds) {
+    if (!loader || !manager) return;
+
+    double startTime = GetTime();
+    int searchFrom = 0;
+
+    for (;;) {
+        // Take the next decoded image
+        PlatformMutexLock(loader->mutex);
+        int index = -1;
+        for (int i = searchFrom; i < loader->count; i++) {
+            if (loader->requests[i].state == ASSET_STATE_DECODED) {
+                index = i;
+                break;
+            }
+        }
+
+        if (index < 0) {
+            PlatformMutexUnlock(loader->mutex);
+            break;
+        }
+
+        AssetRequest request = loader->requests[index];
+        loader->requests[index].state = ASSET_STATE_UPLOADED;
+        PlatformMutexUnlock(loader->mutex);
+
+        // Upload on this thread, straight from the mapping on a cache hit
+        bool uploaded;
+        if (request.fromCache) {
+            uploaded = TextureManagerUploadImage(
+                manager,
+                request.id,
+                request.image,
+                request.filePath,
+                request.tileWidth,
+                request.tileHeight
+            );
+            TextureCacheClose(&request.cached);
+        }
+        else {
+            uploaded = TextureManagerLoadFromImage(
+                manager,
+                request.id,
+                request.image,
+                request.filePath,
+                request.tileWidth,
+                request.tileHeight
+            );
+        }
+
+        PlatformMutexLock(loader->mutex);
+        if (!uploaded) {
+            loader->requests[index].state = ASSET_STATE_FAILED;
+            loader->failedCount++;
+        }
+        loader->finishedCount++;
+        PlatformMutexUnlock(loader->mutex);
+
+        searchFrom = index + 1;
+
+        // Stop once this frame's budget is spent
+        if (GetTime() - startTime >= budgetSeconds) break;
+    }
+}
+
+/**
+ * @brief Get loading progress
+ *
+ * @param loader Pointer to loader
+ * @return float Progress from 0.0 to 1.0
+ */
+float AssetLoaderGetProgress(AssetLoader* loader) {
+    if (!loader) return 1.0f;
+
+    PlatformMutexLock(loader->mutex);
+    int count = loader->count;
+    int steps = loader->decodedCount + loader->finishedCount;
+    PlatformMutexUnlock(loader->mutex);
+
+    if (count == 0) return 1.0f;
+    return (float)steps / (float)(count * 2);
+}
+
+/**
+ * @brief Check whether every request is uploaded or failed
+ *
+ * @param loader Pointer to loader
+ * @return bool Whether loading is finished
+ */
+bool AssetLoaderIsFinished(AssetLoader* loader) {
+    if (!loader) return true;
+
+    PlatformMutexLock(loader->mutex);
+    bool finished = loader->finishedCount >= loader->count;
+    PlatformMutexUnlock(loader->mutex);
+
+    return finished;
+}
+
+/**
+ * @brief Get the number of failed requests
+ *
+ * @param loader Pointer to loader
+ * @return int Number of failed requests
+ */
+int AssetLoaderGetFailedCount(AssetLoader* loader) {
+    if (!loader) return 0;
+
+    PlatformMutexLock(loader->mutex);
+    int failedCount = loader->failedCount;
+    PlatformMutexUnlock(loader->mutex);
+
+    return failedCount;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file asset_loader.h
+ * @brief Asynchronous asset loading
+ *
+ * This file defines the asset loader, which decodes image files on worker
+ * threads and uploads the results to the GPU on the main thread under a
+ * per-frame time budget. Decoding is the slow part of loading a texture
+ * and needs no graphics context; uploading must happen on the thread that
+ * owns the context. Images with a pre-baked cache blob are mapped instead
+ * of decoded.
+ */
+#ifndef MESSY_GAME_ASSET_LOADER_H
+#define MESSY_GAME_ASSET_LOADER_H
+
+#include <stdbool.h>
+#include "raylib.h"
+#include "textures.h"
+#include "platform.h"
+#include "texture_cache.h"
+
+#define ASSET_LOADER_MAX_THREADS 8  // Upper bound on decode worker threads
+
+/**
+ * @brief Asset request states enumeration
+ */
+typedef enum {
+    ASSET_STATE_QUEUED,        // Waiting for a worker
+    ASSET_STATE_DECODING,      // Being decoded by a worker
+    ASSET_STATE_DECODED,       // Decoded, waiting for GPU upload
+    ASSET_STATE_UPLOADED,      // Texture is in the texture manager
+    ASSET_STATE_FAILED,        // Decode or upload failed
+    ASSET_STATE_COUNT
+} AssetState;
+
+/**
+ * @brief Texture load request
+ */
+typedef struct {
+    TextureID id;              // Texture slot to fill
+    char* filePath;            // Path to image file
+    int tileWidth;             // Width of tiles (if tileset) or 0
+    int tileHeight;            // Height of tiles (if tileset) or 0
+    AssetState state;          // Current state
+    Image image;               // Decoded image (valid while ASSET_STATE_DECODED)
+    bool fromCache;            // Whether image points into cached
+    TextureCacheEntry cached;  // Mapped cache blob (if fromCache)
+} AssetRequest;
+
+/**
+ * @brief Asset loader structure
+ *
+ * Requests and counters are shared with the workers and guarded by mutex.
+ */
+typedef struct {
+    AssetRequest* requests;    // Array of requests
+    int count;                 // Number of requests
+    int capacity;              // Capacity of requests array
+    int nextQueued;            // Index of next request for a worker
+    int decodedCount;          // Requests that finished decoding (or failed to)
+    int finishedCount;         // Requests that are uploaded or failed
+    int failedCount;           // Requests that failed
+    PlatformMutex* mutex;      // Guards requests, counters and quit
+    PlatformCondition* workAvailable; // Signalled when a request is queued
+    PlatformThread* workers[ASSET_LOADER_MAX_THREADS]; // Decode worker threads
+    int workerCount;           // Number of worker threads
+    bool quit;                 // Tells workers to exit
+} AssetLoader;
+
+/**
+ * @brief Create an asset loader and start its workers
+ *
+ * @param threadCount Number of decode worker threads
+ * @return AssetLoader* Pointer to created loader or NULL if failed
+ */
+AssetLoader* AssetLoaderCreate(int threadCount);
+
+/**
+ * @brief Stop the workers and free the loader
+ *
+ * Images that were decoded but never uploaded are released.
+ *
+ * @param loader Pointer to loader
+ */
+void AssetLoaderDestroy(AssetLoader* loader);
+
+/**
+ * @brief Queue a texture for loading
+ *
+ * @param loader Pointer to loader
+ * @param id Texture ID
+ * @param filePath Path to image file
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the request was queued
+ */
+bool AssetLoaderQueueTexture(AssetLoader* loader, TextureID id, const char* filePath, int tileWidth, int tileHeight);
+
+/**
+ * @brief Queue all initial game textures
+ *
+ * @param loader Pointer to loader
+ * @return bool Whether every texture was queued
+ */
+bool AssetLoaderQueueGameAssets(AssetLoader* loader);
+
+/**
+ * @brief Upload decoded images to the GPU
+ *
+ * Must be called on the main thread. Uploads at least one decoded image
+ * if any is ready, then stops once the time budget is used up.
+ *
+ * @param loader Pointer to loader
+ * @param manager Texture manager receiving the textures
+ * @param budgetSeconds Time budget for this call in seconds
+ */
+void AssetLoaderUpdate(AssetLoader* loader, TextureManager* manager, double budgetSeconds);
+
+/**
+ * @brief Get loading progress
+ *
+ * Decoding and uploading each count for half of an asset.
+ *
+ * @param loader Pointer to loader
+ * @return float Progress from 0.0 to 1.0
+ */
+float AssetLoaderGetProgress(AssetLoader* loader);
+
+/**
+ * @brief Check whether every request is uploaded or failed
+ *
+ * @param loader Pointer to loader
+ * @return bool Whether loading is finished
+ */
+bool AssetLoaderIsFinished(AssetLoader* loader);
+
+/**
+ * @brief Get the number of failed requests
+ *
+ * @param loader Pointer to loader
+ * @return int Number of failed requests
+ */
+int AssetLoaderGetFailedCount(AssetLoader* loader);
+
+#endif // MESSY_GAME_ASSET_LOADER_H
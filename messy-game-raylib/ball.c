@@ -8,41 +8,198 @@
 #include "ball.h"
 #include "config.h"
 #include "player.h"
+#include "fixed.h"
 
- /**
-  * @brief Create a new ball entity
-  *
-  * @param type Ball type
-  * @param x Initial X position
-  * @param y Initial Y position
-  * @return Entity* Pointer to the created ball entity
-  */
-Entity* BallCreate(BallType type, float x, float y) {
-    // For a ball, width and height are based on radius
-    float diameter = BALL_RADIUS * 2;
+/**
+ * @brief Create a ball pool
+ *
+ * @param capacity Most balls alive at once
+ * @return BallPool* Pointer to created pool or NULL if failed
+ */
+BallPool* BallPoolCreate(int capacity) {
+    if (capacity < 1) capacity = 1;
+    if (capacity > BROADPHASE_MAX_ITEMS) capacity = BROADPHASE_MAX_ITEMS;
 
-    // Create base entity
-    Entity* ball = EntityCreate(ENTITY_BALL, x, y, diameter, diameter);
-    if (!ball) {
-        TraceLog(LOG_ERROR, "Failed to create ball entity");
+    BallPool* pool = (BallPool*)calloc(1, sizeof(BallPool));
+    if (!pool) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for ball pool");
         return NULL;
     }
 
-    // Create ball-specific data
-    BallData* ballData = (BallData*)malloc(sizeof(BallData));
-    if (!ballData) {
-        TraceLog(LOG_ERROR, "Failed to allocate ball data");
-        EntityDestroy(ball);
+    pool->slots = (BallPoolSlot*)calloc(capacity, sizeof(BallPoolSlot));
+    pool->balls = (Entity**)malloc(sizeof(Entity*) * capacity);
+    if (!pool->slots || !pool->balls) {
+        TraceLog(LOG_ERROR, "Failed to allocate ball pool slots");
+        BallPoolDestroy(pool);
         return NULL;
     }
 
-    // Initialize ball data
+    pool->capacity = capacity;
+    BroadphaseInit(&pool->grid, BALL_GRID_CELL_SIZE);
+    BallPoolClear(pool);
+
+    return pool;
+}
+
+/**
+ * @brief Free a ball pool and every ball in it
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolDestroy(BallPool* pool) {
+    if (!pool) return;
+
+    free(pool->balls);
+    free(pool->slots);
+    free(pool);
+}
+
+/**
+ * @brief Destroy every ball in a pool
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolClear(BallPool* pool) {
+    if (!pool) return;
+
+    // Chain the free slots in order, so balls fill the pool front to back
+    for (int i = 0; i < pool->capacity; i++) {
+        pool->slots[i].inUse = false;
+        pool->slots[i].nextFree = i + 1 < pool->capacity ? i + 1 : -1;
+    }
+    pool->firstFree = 0;
+    pool->count = 0;
+    BroadphaseClear(&pool->grid);
+}
+
+/**
+ * @brief Get the slot a ball lives in
+ *
+ * @param pool Pointer to pool
+ * @param ball Pointer to ball entity
+ * @return int Slot index, or -1 if the ball is not in the pool
+ */
+int BallPoolGetSlot(const BallPool* pool, const Entity* ball) {
+    if (!pool || !ball) return -1;
+
+    const BallPoolSlot* slot = (const BallPoolSlot*)ball;
+    if (slot < pool->slots || slot >= pool->slots + pool->capacity) return -1;
+
+    int index = (int)(slot - pool->slots);
+    return pool->slots[index].inUse ? index : -1;
+}
+
+/**
+ * @brief Get the ball in a slot
+ *
+ * @param pool Pointer to pool
+ * @param slot Slot index
+ * @return Entity* Pointer to the ball, or NULL if the slot is empty
+ */
+Entity* BallPoolGetBall(BallPool* pool, int slot) {
+    if (!pool || slot < 0 || slot >= pool->capacity || !pool->slots[slot].inUse) return NULL;
+    return &pool->slots[slot].entity;
+}
+
+/**
+ * @brief Rebuild the grid of ball positions
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolBuildGrid(BallPool* pool) {
+    if (!pool) return;
+
+    BroadphaseClear(&pool->grid);
+    for (int i = 0; i < pool->count; i++) {
+        Entity* ball = pool->balls[i];
+        float radius = ((BallData*)ball->typeData)->radius;
+        BroadphaseInsert(
+            &pool->grid,
+            BallPoolGetSlot(pool, ball),
+            ball->x - radius,
+            ball->y - radius,
+            ball->x + radius,
+            ball->y + radius
+        );
+    }
+    BroadphaseBuild(&pool->grid);
+}
+
+/**
+ * @brief Find the balls that may touch a box
+ *
+ * @param pool Pointer to pool
+ * @param minX Left edge of the box
+ * @param minY Top edge of the box
+ * @param maxX Right edge of the box
+ * @param maxY Bottom edge of the box
+ * @param balls Array to store the balls
+ * @param maxBalls Capacity of balls
+ * @return int Number of balls stored
+ */
+int BallPoolQuery(BallPool* pool, float minX, float minY, float maxX, float maxY, Entity** balls, int maxBalls) {
+    if (!pool || !balls || maxBalls <= 0) return 0;
+
+    int slots[BROADPHASE_MAX_ITEMS];
+    if (maxBalls > BROADPHASE_MAX_ITEMS) maxBalls = BROADPHASE_MAX_ITEMS;
+    int found = BroadphaseQuery(&pool->grid, minX, minY, maxX, maxY, slots, maxBalls);
+
+    // Skip balls destroyed since the grid was built
+    int count = 0;
+    for (int i = 0; i < found; i++) {
+        Entity* ball = BallPoolGetBall(pool, slots[i]);
+        if (ball) balls[count++] = ball;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Find the live ball nearest a point
+ *
+ * Ties go to the ball created first.
+ *
+ * @param pool Pointer to pool
+ * @param x Point X
+ * @param y Point Y
+ * @return Entity* Pointer to the nearest ball, or NULL if there are none
+ */
+Entity* BallPoolFindNearest(BallPool* pool, float x, float y) {
+    if (!pool) return NULL;
+
+    Entity* nearest = NULL;
+    float nearestDistanceSq = 0.0f;
+    for (int i = 0; i < pool->count; i++) {
+        Entity* ball = pool->balls[i];
+        if (!ball->active) continue;
+
+        float dx = ball->x - x;
+        float dy = ball->y - y;
+        float distanceSq = dx * dx + dy * dy;
+        if (!nearest || distanceSq < nearestDistanceSq) {
+            nearest = ball;
+            nearestDistanceSq = distanceSq;
+        }
+    }
+
+    return nearest;
+}
+
+/**
+ * @brief Set up ball data for a ball type
+ *
+ * @param ballData Pointer to ball data
+ * @param type Ball type
+ */
+static void BallInitData(BallData* ballData, BallType type) {
     ballData->type = type;
     ballData->radius = BALL_RADIUS;
     ballData->bounceFactor = BALL_BOUNCE_FACTOR;
     ballData->friction = BALL_FRICTION;
+    ballData->surfaceFriction = 1.0f;
     ballData->damage = 10.0f; // Default damage value
     ballData->hasSpecialEffect = false;
+    ballData->kickerIndex = -1;
     ballData->state = BALL_STATE_NEUTRAL;
     ballData->innerColor = WHITE;
     ballData->outerColor = WHITE;
@@ -83,26 +240,112 @@ Entity* BallCreate(BallType type, float x, float y) {
         ballData->outerColor = RED;
         break;
     }
+}
+
+/**
+ * @brief Create a new ball entity in a pool
+ *
+ * @param pool Pool to take the ball from
+ * @param type Ball type
+ * @param x Initial X position
+ * @param y Initial Y position
+ * @return Entity* Pointer to the created ball entity, or NULL if the pool is full
+ */
+Entity* BallCreate(BallPool* pool, BallType type, float x, float y) {
+    if (!pool) return NULL;
+    if (pool->firstFree < 0) {
+        TraceLog(LOG_WARNING, "Ball pool is full (%d balls)", pool->capacity);
+        return NULL;
+    }
+
+    // Take the first free slot
+    int index = pool->firstFree;
+    BallPoolSlot* slot = &pool->slots[index];
+    pool->firstFree = slot->nextFree;
+    slot->nextFree = -1;
+    slot->inUse = true;
+
+    // For a ball, width and height are based on radius
+    float diameter = BALL_RADIUS * 2;
+
+    Entity* ball = &slot->entity;
+    ball->type = ENTITY_BALL;
+    ball->x = x;
+    ball->y = y;
+    ball->width = diameter;
+    ball->height = diameter;
+    ball->facing = DIRECTION_DOWN;
+    ball->tint = WHITE;
+    ball->tileX = -1;
+    ball->tileY = -1;
+
+    BallInitData(&slot->data, type);
 
     // Set initial ball state
     ball->speedX = 0;
     ball->speedY = 0;
     ball->active = true;
-    ball->typeData = ballData;
+    ball->typeData = &slot->data;
+
+    pool->balls[pool->count++] = ball;
 
     return ball;
 }
 
+/**
+ * @brief Return a ball to its pool
+ *
+ * @param pool Pool the ball came from
+ * @param ball Pointer to ball entity
+ */
+void BallDestroy(BallPool* pool, Entity* ball) {
+    int index = BallPoolGetSlot(pool, ball);
+    if (index < 0) return;
+
+    // Keep the live list in creation order
+    for (int i = 0; i < pool->count; i++) {
+        if (pool->balls[i] == ball) {
+            for (int j = i; j < pool->count - 1; j++) {
+                pool->balls[j] = pool->balls[j + 1];
+            }
+            pool->count--;
+            break;
+        }
+    }
+
+    BallPoolSlot* slot = &pool->slots[index];
+    slot->inUse = false;
+    slot->nextFree = pool->firstFree;
+    pool->firstFree = index;
+}
+
+/**
+ * @brief Scale a velocity down to the ball's maximum speed
+ *
+ * @param speedX Pointer to horizontal speed
+ * @param speedY Pointer to vertical speed
+ */
+static void BallCapSpeed(SimReal* speedX, SimReal* speedY) {
+    SimReal maxSpeed = SimRealFromFloat(BALL_MAX_SPEED);
+    SimReal speedMagnitude = SimRealLength(*speedX, *speedY);
+    if (speedMagnitude > maxSpeed) {
+        SimReal scale = SimRealDiv(maxSpeed, speedMagnitude);
+        *speedX = SimRealMul(*speedX, scale);
+        *speedY = SimRealMul(*speedY, scale);
+    }
+}
+
 /**
  * @brief Update ball state based on physics
  *
  * @param ball Pointer to ball entity
  * @param world Pointer to game world
- * @param player Pointer to player entity for player-ball interaction
+ * @param players Players that can kick the ball
+ * @param playerCount Number of players
  * @param deltaTime Time elapsed since last update
  */
-void BallUpdate(Entity* ball, World* world, Entity* player, float deltaTime) {
-    if (!ball || !world || !player || ball->type != ENTITY_BALL) return;
+void BallUpdate(Entity* ball, World* world, Entity** players, int playerCount, float deltaTime) {
+    if (!ball || !world || !players || ball->type != ENTITY_BALL) return;
 
     // Skip if ball is not active
     if (!ball->active) return;
@@ -115,18 +358,30 @@ void BallUpdate(Entity* ball, World* world, Entity* player, float deltaTime) {
     float prevY = ball->y;
 
     // Apply ball physics - update position based on speed
-    ball->x += ball->speedX;
-    ball->y += ball->speedY;
-
-    // Apply friction to gradually slow down the ball
-    ball->speedX *= ballData->friction;
-    ball->speedY *= ballData->friction;
+    SimReal speedX = SimRealFromFloat(ball->speedX);
+    SimReal speedY = SimRealFromFloat(ball->speedY);
+    ball->x = SimRealToFloat(SimRealFromFloat(prevX) + speedX);
+    ball->y = SimRealToFloat(SimRealFromFloat(prevY) + speedY);
+
+    // Apply friction to gradually slow down the ball; the tile underneath
+    // scales the speed lost, so balls glide over ice and bog down in water
+    SimReal one = SimRealFromInt(1);
+    SimReal friction = one - SimRealMul(one - SimRealFromFloat(ballData->friction),
+        SimRealFromFloat(ballData->surfaceFriction));
+    if (friction < 0) friction = 0;
+    ball->speedX = SimRealToFloat(SimRealMul(speedX, friction));
+    ball->speedY = SimRealToFloat(SimRealMul(speedY, friction));
 
     // Handle wall collisions
     BallHandleWallCollision(ball, world, prevX, prevY);
 
-    // Handle collision with player
-    BallHandlePlayerCollision(ball, player);
+    // Handle collision with every living player, remembering who kicked it
+    for (int i = 0; i < playerCount; i++) {
+        if (!PlayerIsAlive(players[i])) continue;
+        if (BallHandlePlayerCollision(ball, players[i])) {
+            ballData->kickerIndex = i;
+        }
+    }
 
     // Special effects based on ball type
     if (ballData->hasSpecialEffect) {
@@ -149,8 +404,10 @@ void BallUpdate(Entity* ball, World* world, Entity* player, float deltaTime) {
     }
 
     // Check if ball should return to neutral state based on speed
-    float speedMagnitude = sqrtf(ball->speedX * ball->speedX + ball->speedY * ball->speedY);
-    if (speedMagnitude < BALL_INITIAL_SPEED * 0.5f) {
+    speedX = SimRealFromFloat(ball->speedX);
+    speedY = SimRealFromFloat(ball->speedY);
+    SimReal speedMagnitude = SimRealLength(speedX, speedY);
+    if (speedMagnitude < SimRealFromFloat(BALL_INITIAL_SPEED * 0.5f)) {
         BallData* ballData = (BallData*)ball->typeData;
         if (ballData && ballData->state != BALL_STATE_NEUTRAL) {
             ballData->state = BALL_STATE_NEUTRAL;
@@ -161,13 +418,226 @@ void BallUpdate(Entity* ball, World* world, Entity* player, float deltaTime) {
     }
 
     // If ball is very slow, stop it completely to prevent tiny endless movement
-    if (fabs(ball->speedX) < 0.1f) ball->speedX = 0;
-    if (fabs(ball->speedY) < 0.1f) ball->speedY = 0;
+    if (SimRealAbs(speedX) < SimRealFromFloat(0.1f)) ball->speedX = 0;
+    if (SimRealAbs(speedY) < SimRealFromFloat(0.1f)) ball->speedY = 0;
+}
+
+/**
+ * @brief Find when a moving circle first touches a tile
+ *
+ * The circle's center is traced against the tile grown by the radius:
+ * its faces moved out by the radius, and its corners rounded. A tile the
+ * circle already overlaps is ignored, so a ball that starts inside a wall
+ * can leave it.
+ *
+ * @param x Center X at the start of the move
+ * @param y Center Y at the start of the move
+ * @param dx Move X
+ * @param dy Move Y
+ * @param radius Circle radius
+ * @param tileX Tile X position in tiles
+ * @param tileY Tile Y position in tiles
+ * @param hitT Pointer to store the fraction of the move at first contact
+ * @param normalX Pointer to store the contact normal X
+ * @param normalY Pointer to store the contact normal Y
+ * @return bool Whether the circle touches the tile during the move
+ */
+static bool BallSweepTile(
+    SimReal x, SimReal y, SimReal dx, SimReal dy, SimReal radius,
+    int tileX, int tileY, SimReal* hitT, SimReal* normalX, SimReal* normalY
+) {
+    SimReal left = SimRealFromInt(tileX * TILE_WIDTH);
+    SimReal right = left + SimRealFromInt(TILE_WIDTH);
+    SimReal top = SimRealFromInt(tileY * TILE_HEIGHT);
+    SimReal bottom = top + SimRealFromInt(TILE_HEIGHT);
+    SimReal zero = SimRealFromInt(0);
+    SimReal one = SimRealFromInt(1);
+    SimReal never = SimRealFromInt(2); // Any fraction past the end of the move
+
+    // Skip the tile if the circle already overlaps it
+    SimReal nearestX = x < left ? left : (x > right ? right : x);
+    SimReal nearestY = y < top ? top : (y > bottom ? bottom : y);
+    SimReal offsetX = x - nearestX;
+    SimReal offsetY = y - nearestY;
+    if (SimRealAbs(offsetX) < radius && SimRealAbs(offsetY) < radius &&
+        SimRealMul(offsetX, offsetX) + SimRealMul(offsetY, offsetY) < SimRealMul(radius, radius)) {
+        return false;
+    }
+
+    // Slab test against the tile grown by the radius on every side
+    SimReal enterX = -never, exitX = never;
+    if (dx != zero) {
+        SimReal t1 = SimRealDiv(left - radius - x, dx);
+        SimReal t2 = SimRealDiv(right + radius - x, dx);
+        enterX = t1 < t2 ? t1 : t2;
+        exitX = t1 < t2 ? t2 : t1;
+    }
+    else if (x <= left - radius || x >= right + radius) {
+        return false;
+    }
+
+    SimReal enterY = -never, exitY = never;
+    if (dy != zero) {
+        SimReal t1 = SimRealDiv(top - radius - y, dy);
+        SimReal t2 = SimRealDiv(bottom + radius - y, dy);
+        enterY = t1 < t2 ? t1 : t2;
+        exitY = t1 < t2 ? t2 : t1;
+    }
+    else if (y <= top - radius || y >= bottom + radius) {
+        return false;
+    }
+
+    SimReal enter = enterX > enterY ? enterX : enterY;
+    SimReal exit = exitX < exitY ? exitX : exitY;
+    if (enter > exit || enter > one || exit < zero) return false;
+    if (enter < zero) enter = zero;
+
+    // Hitting a face: the contact point lies along the face itself
+    SimReal contactX = x + SimRealMul(dx, enter);
+    SimReal contactY = y + SimRealMul(dy, enter);
+    if (enterX > enterY && contactY >= top && contactY <= bottom) {
+        *hitT = enter;
+        *normalX = dx > zero ? -one : one;
+        *normalY = zero;
+        return true;
+    }
+    if (enterY >= enterX && contactX >= left && contactX <= right) {
+        *hitT = enter;
+        *normalX = zero;
+        *normalY = dy > zero ? -one : one;
+        return true;
+    }
+
+    // Otherwise the circle can only touch the corner nearest the contact
+    SimReal cornerX = contactX < left ? left : right;
+    SimReal cornerY = contactY < top ? top : bottom;
+    SimReal toCenterX = x - cornerX;
+    SimReal toCenterY = y - cornerY;
+
+    // Closest approach of the center to the corner along the move
+    SimReal moveLengthSq = SimRealMul(dx, dx) + SimRealMul(dy, dy);
+    SimReal along = SimRealMul(toCenterX, dx) + SimRealMul(toCenterY, dy);
+    if (moveLengthSq <= zero || along >= zero) return false;
+
+    SimReal closestT = SimRealDiv(-along, moveLengthSq);
+    SimReal closestX = toCenterX + SimRealMul(dx, closestT);
+    SimReal closestY = toCenterY + SimRealMul(dy, closestT);
+    SimReal missSq = SimRealMul(closestX, closestX) + SimRealMul(closestY, closestY);
+    SimReal radiusSq = SimRealMul(radius, radius);
+    if (missSq >= radiusSq) return false;
+
+    // Step back from the closest approach to where the distance is the radius
+    SimReal backT = SimRealDiv(SimRealSqrt(radiusSq - missSq), SimRealSqrt(moveLengthSq));
+    SimReal t = closestT - backT;
+    if (t > one) return false;
+    if (t < zero) t = zero;
+
+    *hitT = t;
+    *normalX = SimRealDiv(toCenterX + SimRealMul(dx, t), radius);
+    *normalY = SimRealDiv(toCenterY + SimRealMul(dy, t), radius);
+    return true;
+}
+
+/**
+ * @brief Find the first wall the ball touches along a move
+ *
+ * Walks the cells the center passes through in order (DDA) and sweeps the
+ * ball against the solid tiles around each. The radius is smaller than a
+ * tile, so any tile the ball touches while its center is in a cell is one
+ * of that cell's 3x3 neighbours; once a cell is entered after the earliest
+ * hit so far, no later cell can hold an earlier one.
+ *
+ * @param world Pointer to game world
+ * @param x Center X at the start of the move
+ * @param y Center Y at the start of the move
+ * @param dx Move X
+ * @param dy Move Y
+ * @param radius Ball radius
+ * @param hitT Pointer to store the fraction of the move at first contact
+ * @param normalX Pointer to store the contact normal X
+ * @param normalY Pointer to store the contact normal Y
+ * @return bool Whether the ball touches a wall during the move
+ */
+static bool BallSweepWorld(
+    World* world, SimReal x, SimReal y, SimReal dx, SimReal dy, SimReal radius,
+    SimReal* hitT, SimReal* normalX, SimReal* normalY
+) {
+    SimReal zero = SimRealFromInt(0);
+    SimReal one = SimRealFromInt(1);
+    SimReal never = SimRealFromInt(2);
+    SimReal tileWidth = SimRealFromInt(TILE_WIDTH);
+    SimReal tileHeight = SimRealFromInt(TILE_HEIGHT);
+
+    int cellX = SimRealToInt(SimRealDiv(x, tileWidth));
+    int cellY = SimRealToInt(SimRealDiv(y, tileHeight));
+    int stepX = dx > zero ? 1 : (dx < zero ? -1 : 0);
+    int stepY = dy > zero ? 1 : (dy < zero ? -1 : 0);
+
+    // Fraction of the move at the next cell border on each axis, and
+    // between borders (capped, so the sums cannot overflow fixed point)
+    SimReal nextX = never, deltaX = never;
+    if (stepX != 0) {
+        SimReal border = SimRealFromInt((cellX + (stepX > 0 ? 1 : 0)) * TILE_WIDTH);
+        nextX = SimRealDiv(border - x, dx);
+        deltaX = SimRealDiv(tileWidth, SimRealAbs(dx));
+        if (nextX > never) nextX = never;
+        if (deltaX > never) deltaX = never;
+    }
+
+    SimReal nextY = never, deltaY = never;
+    if (stepY != 0) {
+        SimReal border = SimRealFromInt((cellY + (stepY > 0 ? 1 : 0)) * TILE_HEIGHT);
+        nextY = SimRealDiv(border - y, dy);
+        deltaY = SimRealDiv(tileHeight, SimRealAbs(dy));
+        if (nextY > never) nextY = never;
+        if (deltaY > never) deltaY = never;
+    }
+
+    bool hit = false;
+    SimReal cellEnter = zero;
+    while (cellEnter <= one && (!hit || cellEnter <= *hitT)) {
+        // Sweep against the solid tiles around this cell
+        for (int i = -1; i <= 1; i++) {
+            for (int j = -1; j <= 1; j++) {
+                int checkX = cellX + i;
+                int checkY = cellY + j;
+                if (!WorldIsWallAtPosition(world, (float)(checkX * TILE_WIDTH), (float)(checkY * TILE_HEIGHT))) continue;
+
+                SimReal t, nx, ny;
+                if (BallSweepTile(x, y, dx, dy, radius, checkX, checkY, &t, &nx, &ny) && (!hit || t < *hitT)) {
+                    *hitT = t;
+                    *normalX = nx;
+                    *normalY = ny;
+                    hit = true;
+                }
+            }
+        }
+
+        // Step to the next cell along the move
+        if (nextX < nextY) {
+            cellEnter = nextX;
+            nextX += deltaX;
+            cellX += stepX;
+        }
+        else {
+            cellEnter = nextY;
+            nextY += deltaY;
+            cellY += stepY;
+        }
+    }
+
+    return hit;
 }
 
 /**
  * @brief Handle ball collision with walls
  *
+ * Sweeps the ball from its previous position to its current one, so it
+ * cannot pass through a wall however fast it moves. At each contact the
+ * velocity and the rest of the move are reflected off the wall, losing
+ * speed along the normal by the bounce factor, and the sweep continues
+ * from the contact point for up to BALL_MAX_BOUNCES contacts per step.
+ *
  * @param ball Pointer to ball entity
  * @param world Pointer to game world
  * @param prevX Previous X position
@@ -179,121 +649,126 @@ void BallHandleWallCollision(Entity* ball, World* world, float prevX, float prev
     BallData* ballData = (BallData*)ball->typeData;
     if (!ballData) return;
 
-    // Convert ball position to tile coordinates for checking nearby tiles
-    int tileX = (int)(ball->x / TILE_WIDTH);
-    int tileY = (int)(ball->y / TILE_HEIGHT);
-
-    // Check tiles around the ball (3x3 grid centered on ball)
-    for (int i = -1; i <= 1; i++) {
-        for (int j = -1; j <= 1; j++) {
-            int checkX = tileX + i;
-            int checkY = tileY + j;
-
-            // Check if this tile is a wall
-            if (WorldIsWallAtPosition(world, checkX * TILE_WIDTH, checkY * TILE_HEIGHT)) {
-                // Calculate the edges of the wall tile
-                float tileLeft = checkX * TILE_WIDTH;
-                float tileRight = tileLeft + TILE_WIDTH;
-                float tileTop = checkY * TILE_HEIGHT;
-                float tileBottom = tileTop + TILE_HEIGHT;
-
-                // Handle horizontal collisions
-                if (ball->y > tileTop && ball->y < tileBottom) {
-                    // Ball hitting left side of wall
-                    if (prevX + ballData->radius < tileLeft && ball->x + ballData->radius >= tileLeft) {
-                        ball->x = tileLeft - ballData->radius;
-                        ball->speedX = -ball->speedX * ballData->bounceFactor;
-                    }
-                    // Ball hitting right side of wall
-                    else if (prevX - ballData->radius > tileRight && ball->x - ballData->radius <= tileRight) {
-                        ball->x = tileRight + ballData->radius;
-                        ball->speedX = -ball->speedX * ballData->bounceFactor;
-                    }
-                }
+    SimReal x = SimRealFromFloat(prevX);
+    SimReal y = SimRealFromFloat(prevY);
+    SimReal moveX = SimRealFromFloat(ball->x) - x;
+    SimReal moveY = SimRealFromFloat(ball->y) - y;
+    SimReal speedX = SimRealFromFloat(ball->speedX);
+    SimReal speedY = SimRealFromFloat(ball->speedY);
+    SimReal radius = SimRealFromFloat(ballData->radius);
+    SimReal bounceFactor = SimRealFromFloat(ballData->bounceFactor);
+    SimReal skin = SimRealFromFloat(BALL_COLLISION_SKIN);
+    SimReal zero = SimRealFromInt(0);
+    SimReal one = SimRealFromInt(1);
+
+    for (int bounce = 0; bounce <= BALL_MAX_BOUNCES; bounce++) {
+        SimReal t, normalX, normalY;
+        if (!BallSweepWorld(world, x, y, moveX, moveY, radius, &t, &normalX, &normalY)) {
+            // Nothing in the way: finish the move
+            x += moveX;
+            y += moveY;
+            break;
+        }
 
-                // Handle vertical collisions
-                if (ball->x > tileLeft && ball->x < tileRight) {
-                    // Ball hitting top of wall
-                    if (prevY + ballData->radius < tileTop && ball->y + ballData->radius >= tileTop) {
-                        ball->y = tileTop - ballData->radius;
-                        ball->speedY = -ball->speedY * ballData->bounceFactor;
-                    }
-                    // Ball hitting bottom of wall
-                    else if (prevY - ballData->radius > tileBottom && ball->y - ballData->radius <= tileBottom) {
-                        ball->y = tileBottom + ballData->radius;
-                        ball->speedY = -ball->speedY * ballData->bounceFactor;
-                    }
-                }
-            }
+        // Move to the contact point, just clear of the wall
+        x += SimRealMul(moveX, t) + SimRealMul(normalX, skin);
+        y += SimRealMul(moveY, t) + SimRealMul(normalY, skin);
+
+        // Out of bounces: stop at the contact point
+        if (bounce == BALL_MAX_BOUNCES) break;
+
+        // Reflect the rest of the move and the velocity off the wall
+        SimReal remaining = one - t;
+        moveX = SimRealMul(moveX, remaining);
+        moveY = SimRealMul(moveY, remaining);
+
+        SimReal moveNormal = SimRealMul(moveX, normalX) + SimRealMul(moveY, normalY);
+        if (moveNormal < zero) {
+            SimReal scale = SimRealMul(moveNormal, one + bounceFactor);
+            moveX -= SimRealMul(normalX, scale);
+            moveY -= SimRealMul(normalY, scale);
+        }
+
+        SimReal speedNormal = SimRealMul(speedX, normalX) + SimRealMul(speedY, normalY);
+        if (speedNormal < zero) {
+            SimReal scale = SimRealMul(speedNormal, one + bounceFactor);
+            speedX -= SimRealMul(normalX, scale);
+            speedY -= SimRealMul(normalY, scale);
         }
     }
 
     // Keep ball within world boundaries
-    int worldWidthPixels = world->width * TILE_WIDTH;
-    int worldHeightPixels = world->height * TILE_HEIGHT;
+    SimReal worldWidthPixels = SimRealFromInt(world->width * TILE_WIDTH);
+    SimReal worldHeightPixels = SimRealFromInt(world->height * TILE_HEIGHT);
 
-    if (ball->x - ballData->radius < 0) {
-        ball->x = ballData->radius;
-        ball->speedX = -ball->speedX * ballData->bounceFactor;
+    if (x - radius < 0) {
+        x = radius;
+        speedX = SimRealMul(-speedX, bounceFactor);
     }
-    else if (ball->x + ballData->radius > worldWidthPixels) {
-        ball->x = worldWidthPixels - ballData->radius;
-        ball->speedX = -ball->speedX * ballData->bounceFactor;
+    else if (x + radius > worldWidthPixels) {
+        x = worldWidthPixels - radius;
+        speedX = SimRealMul(-speedX, bounceFactor);
     }
 
-    if (ball->y - ballData->radius < 0) {
-        ball->y = ballData->radius;
-        ball->speedY = -ball->speedY * ballData->bounceFactor;
+    if (y - radius < 0) {
+        y = radius;
+        speedY = SimRealMul(-speedY, bounceFactor);
     }
-    else if (ball->y + ballData->radius > worldHeightPixels) {
-        ball->y = worldHeightPixels - ballData->radius;
-        ball->speedY = -ball->speedY * ballData->bounceFactor;
+    else if (y + radius > worldHeightPixels) {
+        y = worldHeightPixels - radius;
+        speedY = SimRealMul(-speedY, bounceFactor);
     }
+
+    ball->x = SimRealToFloat(x);
+    ball->y = SimRealToFloat(y);
+    ball->speedX = SimRealToFloat(speedX);
+    ball->speedY = SimRealToFloat(speedY);
 }
 
 /**
  * @brief Handle ball collision with player
  *
+ * Kicks a touching ball away from the player. Separating the two is
+ * left to the physics solver.
+ *
  * @param ball Pointer to ball entity
  * @param player Pointer to player entity
+ * @return bool Whether the player kicked the ball
  */
-void BallHandlePlayerCollision(Entity* ball, Entity* player) {
-    if (!ball || !player || ball->type != ENTITY_BALL || player->type != ENTITY_PLAYER) return;
+bool BallHandlePlayerCollision(Entity* ball, Entity* player) {
+    if (!ball || !player || ball->type != ENTITY_BALL || player->type != ENTITY_PLAYER) return false;
 
     BallData* ballData = (BallData*)ball->typeData;
-    if (!ballData) return;
+    if (!ballData) return false;
 
     // Calculate distance between ball and player centers
-    float dx = ball->x - player->x;
-    float dy = ball->y - player->y;
-    float distance = sqrtf(dx * dx + dy * dy);
+    SimReal playerX = SimRealFromFloat(player->x);
+    SimReal playerY = SimRealFromFloat(player->y);
+    SimReal dx = SimRealFromFloat(ball->x) - playerX;
+    SimReal dy = SimRealFromFloat(ball->y) - playerY;
+    SimReal distance = SimRealLength(dx, dy);
 
     // Estimate player collision radius (use average of width and height / 2)
-    float playerRadius = (player->width + player->height) / 4.0f;
+    SimReal playerRadius = SimRealDiv(SimRealFromFloat(player->width) + SimRealFromFloat(player->height), SimRealFromInt(4));
+    SimReal reach = SimRealFromFloat(ballData->radius) + playerRadius;
 
     // Check for collision
-    if (distance < ballData->radius + playerRadius) {
+    if (distance < reach) {
         // Normalize collision vector
-        float nx = dx / distance;
-        float ny = dy / distance;
-
-        // Push ball away from player
-        ball->x = player->x + nx * (ballData->radius + playerRadius);
-        ball->y = player->y + ny * (ballData->radius + playerRadius);
+        SimReal nx = SimRealDiv(dx, distance);
+        SimReal ny = SimRealDiv(dy, distance);
 
         // Apply force to ball based on player's movement and collision direction
         PlayerData* playerData = PlayerGetData(player);
-        float pushForce = playerData ? playerData->kickForce : PLAYER_PUSH_FORCE;
-        ball->speedX = nx * pushForce + player->speedX * 0.5f;
-        ball->speedY = ny * pushForce + player->speedY * 0.5f;
+        SimReal pushForce = SimRealFromFloat(playerData ? playerData->kickForce : PLAYER_PUSH_FORCE);
+        SimReal half = SimRealFromFloat(0.5f);
+        SimReal speedX = SimRealMul(nx, pushForce) + SimRealMul(SimRealFromFloat(player->speedX), half);
+        SimReal speedY = SimRealMul(ny, pushForce) + SimRealMul(SimRealFromFloat(player->speedY), half);
 
         // Cap ball speed
-        float speedMagnitude = sqrtf(ball->speedX * ball->speedX + ball->speedY * ball->speedY);
-        if (speedMagnitude > BALL_MAX_SPEED) {
-            float scale = BALL_MAX_SPEED / speedMagnitude;
-            ball->speedX *= scale;
-            ball->speedY *= scale;
-        }
+        BallCapSpeed(&speedX, &speedY);
+        ball->speedX = SimRealToFloat(speedX);
+        ball->speedY = SimRealToFloat(speedY);
 
         // Check if ball is in SNAKE state (red) - only then damage player
         if (ballData->state == BALL_STATE_SNAKE) {
@@ -312,7 +787,10 @@ void BallHandlePlayerCollision(Entity* ball, Entity* player) {
         ballData->outerColor = SKYBLUE;
 
         TraceLog(LOG_INFO, "Ball hit by player, changed to PLAYER state (blue)");
+        return true;
     }
+
+    return false;
 }
 
 
@@ -382,16 +860,13 @@ void BallApplyForce(Entity* ball, float forceX, float forceY) {
     if (!ball || ball->type != ENTITY_BALL || !ball->active) return;
 
     // Apply force to ball's speed
-    ball->speedX += forceX;
-    ball->speedY += forceY;
+    SimReal speedX = SimRealFromFloat(ball->speedX) + SimRealFromFloat(forceX);
+    SimReal speedY = SimRealFromFloat(ball->speedY) + SimRealFromFloat(forceY);
 
     // Cap ball speed
-    float speedMagnitude = sqrtf(ball->speedX * ball->speedX + ball->speedY * ball->speedY);
-    if (speedMagnitude > BALL_MAX_SPEED) {
-        float scale = BALL_MAX_SPEED / speedMagnitude;
-        ball->speedX *= scale;
-        ball->speedY *= scale;
-    }
+    BallCapSpeed(&speedX, &speedY);
+    ball->speedX = SimRealToFloat(speedX);
+    ball->speedY = SimRealToFloat(speedY);
 }
 
 /**
@@ -420,35 +895,41 @@ bool BallHandleEnemyCollision(Entity* ball, Entity* enemy) {
     if (!ballData) return false;
 
     // Calculate distance between ball and enemy centers
-    float dx = ball->x - enemy->x;
-    float dy = ball->y - enemy->y;
-    float distance = sqrtf(dx * dx + dy * dy);
+    SimReal enemyX = SimRealFromFloat(enemy->x);
+    SimReal enemyY = SimRealFromFloat(enemy->y);
+    SimReal dx = SimRealFromFloat(ball->x) - enemyX;
+    SimReal dy = SimRealFromFloat(ball->y) - enemyY;
+    SimReal distance = SimRealLength(dx, dy);
 
     // Assume enemy has a collision radius similar to player
-    float enemyRadius = (enemy->width + enemy->height) / 4.0f;
+    SimReal enemyRadius = SimRealDiv(SimRealFromFloat(enemy->width) + SimRealFromFloat(enemy->height), SimRealFromInt(4));
+    SimReal reach = SimRealFromFloat(ballData->radius) + enemyRadius;
 
     // Check for collision
-    if (distance < ballData->radius + enemyRadius) {
+    if (distance < reach) {
         // Normalize collision vector
-        float nx = dx / distance;
-        float ny = dy / distance;
+        SimReal nx = SimRealDiv(dx, distance);
+        SimReal ny = SimRealDiv(dy, distance);
 
         // Push ball away from enemy
-        ball->x = enemy->x + nx * (ballData->radius + enemyRadius);
-        ball->y = enemy->y + ny * (ballData->radius + enemyRadius);
+        ball->x = SimRealToFloat(enemyX + SimRealMul(nx, reach));
+        ball->y = SimRealToFloat(enemyY + SimRealMul(ny, reach));
 
         // Bounce ball off enemy
-        float impactSpeed = ball->speedX * nx + ball->speedY * ny;
+        SimReal speedX = SimRealFromFloat(ball->speedX);
+        SimReal speedY = SimRealFromFloat(ball->speedY);
+        SimReal impactSpeed = SimRealMul(speedX, nx) + SimRealMul(speedY, ny);
 
         // Only bounce if ball is moving toward enemy
         if (impactSpeed < 0) {
             // Calculate reflection vector
-            ball->speedX -= 2 * impactSpeed * nx;
-            ball->speedY -= 2 * impactSpeed * ny;
+            speedX -= SimRealMul(2 * impactSpeed, nx);
+            speedY -= SimRealMul(2 * impactSpeed, ny);
 
             // Apply bounce factor
-            ball->speedX *= ballData->bounceFactor;
-            ball->speedY *= ballData->bounceFactor;
+            SimReal bounceFactor = SimRealFromFloat(ballData->bounceFactor);
+            ball->speedX = SimRealToFloat(SimRealMul(speedX, bounceFactor));
+            ball->speedY = SimRealToFloat(SimRealMul(speedY, bounceFactor));
         }
 
         // Apply special effects based on ball type
@@ -473,4 +954,33 @@ bool BallHandleEnemyCollision(Entity* ball, Entity* enemy) {
     }
 
     return false; // No collision
+}
+
+/**
+ * @brief Set ball state and its matching colors
+ *
+ * @param ball Pointer to ball entity
+ * @param state New ball state
+ */
+void BallSetState(Entity* ball, BallState state) {
+    BallData* ballData = BallGetData(ball);
+    if (!ballData) return;
+
+    ballData->state = state;
+    switch (state) {
+    case BALL_STATE_PLAYER:
+        ballData->innerColor = BLUE;
+        ballData->outerColor = SKYBLUE;
+        break;
+
+    case BALL_STATE_SNAKE:
+        ballData->innerColor = RED;
+        ballData->outerColor = MAROON;
+        break;
+
+    default:
+        ballData->innerColor = WHITE;
+        ballData->outerColor = WHITE;
+        break;
+    }
 }
\ No newline at end of file
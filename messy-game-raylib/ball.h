@@ -3,7 +3,10 @@
  * @brief Ball entity definitions and functions
  *
  * This file defines ball-specific data structures and functions.
- * Handles ball physics, collision, and special effects.
+ * Handles ball physics, collision, and special effects. Balls live in a
+ * fixed pool, so spawning and removing them never allocates, and the
+ * pool keeps a grid of ball positions for finding the balls near a
+ * point.
  */
 
 #ifndef MESSY_GAME_BALL_H
@@ -11,6 +14,7 @@
 
 #include "entity.h"
 #include "world.h"
+#include "broadphase.h"
 
  /**
   * @brief Ball types enumeration
@@ -48,32 +52,150 @@ typedef struct {
     float radius;          // Ball radius
     float bounceFactor;    // How bouncy the ball is
     float friction;        // How quickly the ball slows down
+    float surfaceFriction; // Friction multiplier of the tile under the ball (set each step)
     float damage;          // Damage dealt to enemies
     Color innerColor;      // Inner color for special effects
     Color outerColor;      // Outer color for special effects
     bool hasSpecialEffect; // Whether ball has special effects
+    int kickerIndex;       // Index of the player who last kicked the ball (-1 if none)
     // Add more ball-specific attributes as needed
 } BallData;
 
 /**
- * @brief Create a new ball entity
+ * @brief Pool slot holding one ball
+ */
+typedef struct {
+    Entity entity;         // Ball entity (typeData points at data)
+    BallData data;         // Ball-specific data
+    int nextFree;          // Next free slot, or -1 (only while free)
+    bool inUse;            // Whether the slot holds a live ball
+} BallPoolSlot;
+
+/**
+ * @brief Pool of balls
+ *
+ * Slots never move, so ball pointers stay valid until the ball is
+ * destroyed, and a slot index can stand in for a ball in saved state.
+ */
+typedef struct {
+    BallPoolSlot* slots;   // Slot storage
+    int capacity;          // Number of slots
+    int firstFree;         // First free slot, or -1 if the pool is full
+    Entity** balls;        // Live balls in the order they were created
+    int count;             // Number of live balls
+    Broadphase grid;       // Ball bounds by slot, as of the last BallPoolBuildGrid
+} BallPool;
+
+/**
+ * @brief Create a ball pool
+ *
+ * @param capacity Most balls alive at once
+ * @return BallPool* Pointer to created pool or NULL if failed
+ */
+BallPool* BallPoolCreate(int capacity);
+
+/**
+ * @brief Free a ball pool and every ball in it
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolDestroy(BallPool* pool);
+
+/**
+ * @brief Destroy every ball in a pool
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolClear(BallPool* pool);
+
+/**
+ * @brief Get the slot a ball lives in
+ *
+ * @param pool Pointer to pool
+ * @param ball Pointer to ball entity
+ * @return int Slot index, or -1 if the ball is not in the pool
+ */
+int BallPoolGetSlot(const BallPool* pool, const Entity* ball);
+
+/**
+ * @brief Get the ball in a slot
+ *
+ * @param pool Pointer to pool
+ * @param slot Slot index
+ * @return Entity* Pointer to the ball, or NULL if the slot is empty
+ */
+Entity* BallPoolGetBall(BallPool* pool, int slot);
+
+/**
+ * @brief Rebuild the grid of ball positions
+ *
+ * Call after the balls move and before querying.
+ *
+ * @param pool Pointer to pool
+ */
+void BallPoolBuildGrid(BallPool* pool);
+
+/**
+ * @brief Find the balls that may touch a box
+ *
+ * Uses the positions from the last BallPoolBuildGrid; callers still test
+ * the real shapes.
+ *
+ * @param pool Pointer to pool
+ * @param minX Left edge of the box
+ * @param minY Top edge of the box
+ * @param maxX Right edge of the box
+ * @param maxY Bottom edge of the box
+ * @param balls Array to store the balls
+ * @param maxBalls Capacity of balls
+ * @return int Number of balls stored
+ */
+int BallPoolQuery(BallPool* pool, float minX, float minY, float maxX, float maxY, Entity** balls, int maxBalls);
+
+/**
+ * @brief Find the live ball nearest a point
+ *
+ * @param pool Pointer to pool
+ * @param x Point X
+ * @param y Point Y
+ * @return Entity* Pointer to the nearest ball, or NULL if there are none
+ */
+Entity* BallPoolFindNearest(BallPool* pool, float x, float y);
+
+/**
+ * @brief Create a new ball entity in a pool
  *
+ * @param pool Pool to take the ball from
  * @param type Ball type
  * @param x Initial X position
  * @param y Initial Y position
- * @return Entity* Pointer to the created ball entity
+ * @return Entity* Pointer to the created ball entity, or NULL if the pool is full
  */
-Entity* BallCreate(BallType type, float x, float y);
+Entity* BallCreate(BallPool* pool, BallType type, float x, float y);
+
+/**
+ * @brief Return a ball to its pool
+ *
+ * The ball's slot is reused by later balls.
+ *
+ * @param pool Pool the ball came from
+ * @param ball Pointer to ball entity
+ */
+void BallDestroy(BallPool* pool, Entity* ball);
 
 /**
  * @brief Update ball state based on physics
  *
+ * Living players kick the ball; the last one to do so is recorded in
+ * kickerIndex.
+ *
  * @param ball Pointer to ball entity
  * @param world Pointer to game world
- * @param player Pointer to player entity for player-ball interaction
+ * @param players Players that can kick the ball
+ * @param playerCount Number of players
  * @param deltaTime Time elapsed since last update
  */
-void BallUpdate(Entity* ball, World* world, Entity* player, float deltaTime);
+void BallUpdate(Entity* ball, World* world, Entity** players, int playerCount, float deltaTime);
 
 /**
  * @brief Render ball with appropriate effects
@@ -94,6 +216,9 @@ void BallReset(Entity* ball, float x, float y);
 /**
  * @brief Handle ball collision with walls
  *
+ * Sweeps the ball from the previous position to its current one, so it
+ * cannot tunnel through walls at any speed.
+ *
  * @param ball Pointer to ball entity
  * @param world Pointer to game world
  * @param prevX Previous X position
@@ -104,10 +229,14 @@ void BallHandleWallCollision(Entity* ball, World* world, float prevX, float prev
 /**
  * @brief Handle ball collision with player
  *
+ * Kicks a touching ball away from the player. Separating the two is
+ * left to the physics solver.
+ *
  * @param ball Pointer to ball entity
  * @param player Pointer to player entity
+ * @return bool Whether the player kicked the ball
  */
-void BallHandlePlayerCollision(Entity* ball, Entity* player);
+bool BallHandlePlayerCollision(Entity* ball, Entity* player);
 
 /**
  * @brief Handle ball collision with enemies
@@ -128,6 +257,14 @@ bool BallHandleEnemyCollision(Entity* ball, Entity* enemy);
  */
 void BallApplyForce(Entity* ball, float forceX, float forceY);
 
+/**
+ * @brief Set ball state and its matching colors
+ *
+ * @param ball Pointer to ball entity
+ * @param state New ball state
+ */
+void BallSetState(Entity* ball, BallState state);
+
 /**
  * @brief Get ball-specific data from entity
  *
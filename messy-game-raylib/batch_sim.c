@@ -0,0 +1,329 @@
+/**
+ * @file batch_sim.c
+ * @brief Implementation of the parallel headless match simulator
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "batch_sim.h"
+#include "game.h"
+#include "bot.h"
+#include "platform.h"
+#include "config.h"
+
+/**
+ * @brief Work shared by the simulation workers
+ *
+ * Results are written to disjoint slots, so only the job counter is
+ * guarded by the mutex.
+ */
+typedef struct {
+    const BatchSimConfig* config; // Settings
+    const GameTuning* tunings; // Tuning per sweep value
+    int valueCount;            // Number of sweep values
+    int jobCount;              // valueCount * matches
+    int nextJob;               // Index of next job for a worker
+    BatchSimMatchResult* results; // One result per job
+    PlatformMutex* mutex;      // Guards nextJob
+} BatchSimWork;
+
+/**
+ * @brief Fill settings with defaults
+ *
+ * @param config Pointer to settings
+ */
+void BatchSimConfigDefaults(BatchSimConfig* config) {
+    if (!config) return;
+
+    config->matches = 100;
+    config->threads = 0;
+    config->playerCount = 1;
+    config->maxMatchTime = BATCH_SIM_MAX_MATCH_TIME;
+    config->seed = GAME_DEFAULT_SEED;
+    GameTuningDefaults(&config->tuning);
+    config->sweepName = NULL;
+    config->sweepFrom = 0.0f;
+    config->sweepTo = 0.0f;
+    config->sweepStep = 0.0f;
+}
+
+/**
+ * @brief Check whether every snake boss in the game is defeated
+ *
+ * @param game Pointer to game
+ * @return bool Whether at least one snake boss exists and all are defeated
+ */
+static bool BatchSimSnakesDefeated(Game* game) {
+    bool found = false;
+    for (int i = 0; i < game->entityCount; i++) {
+        SnakeBossData* bossData = IsSnakeBoss(game->entities[i]) ? SnakeBossGetData(game->entities[i]) : NULL;
+        if (!bossData) continue;
+
+        if (bossData->state != SNAKE_STATE_DEFEATED) return false;
+        found = true;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Play one bot-driven headless match
+ *
+ * Events are counted by watching state changes after each step, so the
+ * simulation itself needs no hooks.
+ *
+ * @param tuning Balancing parameters
+ * @param seed Match seed
+ * @param playerCount Number of bot players
+ * @param maxMatchTime Simulated seconds before the match is called off
+ * @param result Pointer to store the outcome
+ */
+void BatchSimRunMatch(const GameTuning* tuning, uint64_t seed, int playerCount, float maxMatchTime, BatchSimMatchResult* result) {
+    if (!result) return;
+
+    memset(result, 0, sizeof(BatchSimMatchResult));
+
+    Game* game = GameCreateHeadless(seed, tuning, playerCount);
+    if (!game) return;
+
+    Bot bots[MAX_LOCAL_PLAYERS];
+    PlayerState prevPlayerStates[MAX_LOCAL_PLAYERS];
+    for (int i = 0; i < game->playerCount; i++) {
+        BotInit(&bots[i], seed, i);
+        prevPlayerStates[i] = PLAYER_STATE_ALIVE;
+    }
+    WinConditionState prevWinState = WIN_STATE_IDLE;
+
+    int maxSteps = (int)(maxMatchTime / SIM_FIXED_TIMESTEP);
+    int step = 0;
+    while (step < maxSteps) {
+        for (int i = 0; i < game->playerCount; i++) {
+            BotUpdate(&bots[i], game, game->players[i], game->playerInputs[i], SIM_FIXED_TIMESTEP);
+        }
+
+        GameSimulationStep(game, SIM_FIXED_TIMESTEP);
+        step++;
+
+        // A player dies when they leave the alive state
+        for (int i = 0; i < game->playerCount; i++) {
+            PlayerData* playerData = PlayerGetData(game->players[i]);
+            if (!playerData) continue;
+
+            if (prevPlayerStates[i] == PLAYER_STATE_ALIVE && playerData->state != PLAYER_STATE_ALIVE) {
+                result->playerDeaths++;
+            }
+            prevPlayerStates[i] = playerData->state;
+        }
+
+        // A goal is scored when the hole enters a scored state
+        WinConditionState winState = game->winCondition ? game->winCondition->state : WIN_STATE_IDLE;
+        if (winState != prevWinState) {
+            if (winState == WIN_STATE_PLAYER_SCORED) result->playerGoals++;
+            if (winState == WIN_STATE_ENEMY_SCORED) result->enemyGoals++;
+        }
+        prevWinState = winState;
+
+        if (BatchSimSnakesDefeated(game)) {
+            result->snakeDefeated = true;
+            result->timeToKill = step * SIM_FIXED_TIMESTEP;
+            break;
+        }
+    }
+
+    result->simulatedTime = step * SIM_FIXED_TIMESTEP;
+    result->completed = true;
+
+    GameDestroy(game);
+}
+
+/**
+ * @brief Simulation worker entry point
+ *
+ * Takes jobs in order until none are left.
+ *
+ * @param userData Pointer to shared work
+ */
+static void BatchSimWorkerMain(void* userData) {
+    BatchSimWork* work = (BatchSimWork*)userData;
+    const BatchSimConfig* config = work->config;
+
+    for (;;) {
+        PlatformMutexLock(work->mutex);
+        int job = work->nextJob < work->jobCount ? work->nextJob++ : -1;
+        PlatformMutexUnlock(work->mutex);
+
+        if (job < 0) break;
+
+        // Match i of every sweep value uses the same seed, so values are
+        // compared on the same set of matches
+        int valueIndex = job / config->matches;
+        int matchIndex = job % config->matches;
+        BatchSimRunMatch(
+            &work->tunings[valueIndex],
+            config->seed + (uint64_t)matchIndex,
+            config->playerCount,
+            config->maxMatchTime,
+            &work->results[job]
+        );
+    }
+}
+
+/**
+ * @brief Write the statistics of one sweep value as a CSV row
+ *
+ * @param out Stream receiving the CSV
+ * @param name Swept parameter name
+ * @param value Sweep value
+ * @param results Results of the value's matches
+ * @param count Number of results
+ */
+static void BatchSimWriteRow(FILE* out, const char* name, float value, const BatchSimMatchResult* results, int count) {
+    int completed = 0;
+    int kills = 0;
+    int deaths = 0;
+    int playerGoals = 0;
+    int enemyGoals = 0;
+    double totalTime = 0.0;
+    double totalTimeToKill = 0.0;
+    float minTimeToKill = 0.0f;
+    float maxTimeToKill = 0.0f;
+
+    for (int i = 0; i < count; i++) {
+        const BatchSimMatchResult* result = &results[i];
+        if (!result->completed) continue;
+
+        completed++;
+        deaths += result->playerDeaths;
+        playerGoals += result->playerGoals;
+        enemyGoals += result->enemyGoals;
+        totalTime += result->simulatedTime;
+
+        if (result->snakeDefeated) {
+            if (kills == 0 || result->timeToKill < minTimeToKill) minTimeToKill = result->timeToKill;
+            if (kills == 0 || result->timeToKill > maxTimeToKill) maxTimeToKill = result->timeToKill;
+            totalTimeToKill += result->timeToKill;
+            kills++;
+        }
+    }
+
+    double minutes = totalTime / 60.0;
+    double meanTimeToKill = kills > 0 ? totalTimeToKill / kills : 0.0;
+
+    fprintf(out, "%s,%g,%d,%d,%.2f,%.2f,%.2f,%.3f,%.3f,%.3f\n",
+        name, value, completed, kills,
+        meanTimeToKill, minTimeToKill, maxTimeToKill,
+        minutes > 0.0 ? deaths / minutes : 0.0,
+        minutes > 0.0 ? playerGoals / minutes : 0.0,
+        minutes > 0.0 ? enemyGoals / minutes : 0.0);
+}
+
+/**
+ * @brief Run every match and write the statistics as CSV
+ *
+ * @param config Pointer to settings
+ * @param out Stream receiving the CSV
+ * @return bool Whether every match ran
+ */
+bool BatchSimRun(const BatchSimConfig* config, FILE* out) {
+    if (!config || !out || config->matches < 1) return false;
+
+    // One tuning per sweep value
+    GameTuning tunings[BATCH_SIM_MAX_SWEEP_VALUES];
+    float values[BATCH_SIM_MAX_SWEEP_VALUES];
+    int valueCount = 0;
+
+    if (config->sweepName) {
+        if (!GameTuningHasParameter(config->sweepName)) {
+            TraceLog(LOG_ERROR, "Unknown tuning parameter: %s", config->sweepName);
+            return false;
+        }
+        if (config->sweepStep <= 0.0f || config->sweepTo < config->sweepFrom) {
+            TraceLog(LOG_ERROR, "Invalid sweep range %g to %g step %g", config->sweepFrom, config->sweepTo, config->sweepStep);
+            return false;
+        }
+
+        // Computed from the index, so steps do not accumulate rounding error
+        float span = (config->sweepTo - config->sweepFrom) / config->sweepStep;
+        int stepCount = (int)floorf(span + 1e-4f) + 1;
+        if (stepCount > BATCH_SIM_MAX_SWEEP_VALUES) {
+            TraceLog(LOG_WARNING, "Sweep limited to %d values", BATCH_SIM_MAX_SWEEP_VALUES);
+            stepCount = BATCH_SIM_MAX_SWEEP_VALUES;
+        }
+
+        for (int i = 0; i < stepCount; i++) {
+            values[i] = config->sweepFrom + i * config->sweepStep;
+            tunings[i] = config->tuning;
+            GameTuningSet(&tunings[i], config->sweepName, values[i]);
+        }
+        valueCount = stepCount;
+    }
+    else {
+        values[0] = 0.0f;
+        tunings[0] = config->tuning;
+        valueCount = 1;
+    }
+
+    BatchSimWork work = { 0 };
+    work.config = config;
+    work.tunings = tunings;
+    work.valueCount = valueCount;
+    work.jobCount = valueCount * config->matches;
+    work.nextJob = 0;
+    work.results = (BatchSimMatchResult*)calloc(work.jobCount, sizeof(BatchSimMatchResult));
+    work.mutex = PlatformMutexCreate();
+
+    if (!work.results || !work.mutex) {
+        TraceLog(LOG_ERROR, "Failed to allocate batch simulation resources");
+        free(work.results);
+        PlatformMutexDestroy(work.mutex);
+        return false;
+    }
+
+    // One thread per processor unless told otherwise; this thread is one of them
+    int threadCount = config->threads > 0 ? config->threads : PlatformGetCpuCount();
+    if (threadCount > work.jobCount) threadCount = work.jobCount;
+
+    PlatformThread** workers = (PlatformThread**)calloc(threadCount, sizeof(PlatformThread*));
+    int workerCount = 0;
+    if (workers) {
+        for (int i = 0; i < threadCount - 1; i++) {
+            workers[i] = PlatformThreadCreate(BatchSimWorkerMain, &work);
+            if (!workers[i]) {
+                TraceLog(LOG_WARNING, "Failed to start simulation worker %d", i);
+                break;
+            }
+            workerCount++;
+        }
+    }
+
+    // Play matches alongside the workers until the jobs run out
+    BatchSimWorkerMain(&work);
+
+    for (int i = 0; i < workerCount; i++) {
+        PlatformThreadJoin(workers[i]);
+    }
+    free(workers);
+
+    // Report
+    fprintf(out, "parameter,value,matches,kills,ttk_mean,ttk_min,ttk_max,deaths_per_min,goals_per_min,enemy_goals_per_min\n");
+    for (int i = 0; i < valueCount; i++) {
+        BatchSimWriteRow(
+            out,
+            config->sweepName ? config->sweepName : "none",
+            values[i],
+            &work.results[i * config->matches],
+            config->matches
+        );
+    }
+
+    bool success = true;
+    for (int i = 0; i < work.jobCount; i++) {
+        success &= work.results[i].completed;
+    }
+
+    free(work.results);
+    PlatformMutexDestroy(work.mutex);
+
+    return success;
+}
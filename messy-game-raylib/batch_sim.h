@@ -0,0 +1,77 @@
+/**
+ * @file batch_sim.h
+ * @brief Parallel headless match simulator for game balancing
+ *
+ * This file defines the batch simulator, which plays many bot-driven
+ * matches in headless games across worker threads and reports how long
+ * the snake boss takes to kill, how often players die and how often each
+ * side scores. A tuning parameter can be swept over a range of values to
+ * see how it moves those numbers.
+ */
+#ifndef MESSY_GAME_BATCH_SIM_H
+#define MESSY_GAME_BATCH_SIM_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "tuning.h"
+
+/**
+ * @brief Batch simulation settings
+ */
+typedef struct {
+    int matches;               // Matches per sweep value
+    int threads;               // Worker threads (0 = one per logical processor)
+    int playerCount;           // Bot players per match
+    float maxMatchTime;        // Simulated seconds before a match is called off
+    uint64_t seed;             // Seed of the first match; each match adds its index
+    GameTuning tuning;         // Tuning for every match, apart from the swept parameter
+    const char* sweepName;     // Config name of the parameter to sweep, or NULL
+    float sweepFrom;           // First sweep value
+    float sweepTo;             // Last sweep value (inclusive)
+    float sweepStep;           // Distance between sweep values
+} BatchSimConfig;
+
+/**
+ * @brief Outcome of one simulated match
+ */
+typedef struct {
+    bool completed;            // Whether the match could be created and run
+    bool snakeDefeated;        // Whether every snake boss was defeated
+    float simulatedTime;       // Simulated seconds until the kill or time limit
+    float timeToKill;          // Simulated seconds until the kill (if snakeDefeated)
+    int playerDeaths;          // Times any player died
+    int playerGoals;           // Goals scored by the players
+    int enemyGoals;            // Goals scored by the enemies
+} BatchSimMatchResult;
+
+/**
+ * @brief Fill settings with defaults
+ *
+ * @param config Pointer to settings
+ */
+void BatchSimConfigDefaults(BatchSimConfig* config);
+
+/**
+ * @brief Play one bot-driven headless match
+ *
+ * @param tuning Balancing parameters
+ * @param seed Match seed
+ * @param playerCount Number of bot players
+ * @param maxMatchTime Simulated seconds before the match is called off
+ * @param result Pointer to store the outcome
+ */
+void BatchSimRunMatch(const GameTuning* tuning, uint64_t seed, int playerCount, float maxMatchTime, BatchSimMatchResult* result);
+
+/**
+ * @brief Run every match and write the statistics as CSV
+ *
+ * Writes one row per sweep value, or a single row without a sweep.
+ *
+ * @param config Pointer to settings
+ * @param out Stream receiving the CSV
+ * @return bool Whether every match ran
+ */
+bool BatchSimRun(const BatchSimConfig* config, FILE* out);
+
+#endif // MESSY_GAME_BATCH_SIM_H
@@ -0,0 +1,128 @@
+/**
+ * @file bot.c
+ * @brief Implementation of the scripted player
+ */
+
+#include <math.h>
+#include "bot.h"
+#include "config.h"
+
+/**
+ * @brief Initialize a bot
+ *
+ * @param bot Pointer to bot
+ * @param seed Game seed
+ * @param playerIndex Index of the player the bot controls
+ */
+void BotInit(Bot* bot, uint64_t seed, int playerIndex) {
+    if (!bot) return;
+
+    // Each player of a match gets its own sequence
+    RngSeed(&bot->rng, seed ^ ((uint64_t)playerIndex << 32), RNG_STREAM_BOT);
+    bot->reactionTime = BOT_REACTION_TIME;
+    bot->aimNoise = BOT_AIM_NOISE;
+    bot->decisionTimer = 0.0f;
+    bot->aimOffset = (Vector2){ 0.0f, 0.0f };
+    bot->actions = 0;
+}
+
+/**
+ * @brief Turn a target point into movement actions
+ *
+ * @param player Player entity
+ * @param targetX Target X position
+ * @param targetY Target Y position
+ * @return InputActionMask Movement actions towards the target
+ */
+static InputActionMask BotMoveTowards(Entity* player, float targetX, float targetY) {
+    InputActionMask actions = 0;
+    float dx = targetX - player->x;
+    float dy = targetY - player->y;
+
+    if (dx > BOT_MOVE_DEADZONE) actions |= (InputActionMask)1 << ACTION_MOVE_RIGHT;
+    if (dx < -BOT_MOVE_DEADZONE) actions |= (InputActionMask)1 << ACTION_MOVE_LEFT;
+    if (dy > BOT_MOVE_DEADZONE) actions |= (InputActionMask)1 << ACTION_MOVE_DOWN;
+    if (dy < -BOT_MOVE_DEADZONE) actions |= (InputActionMask)1 << ACTION_MOVE_UP;
+
+    return actions;
+}
+
+/**
+ * @brief Decide what the bot does until its next decision
+ *
+ * @param bot Pointer to bot
+ * @param game Pointer to game
+ * @param player Player entity the bot controls
+ * @return InputActionMask Actions to hold
+ */
+static InputActionMask BotDecide(Bot* bot, Game* game, Entity* player) {
+    PlayerData* playerData = PlayerGetData(player);
+    if (!playerData) return 0;
+
+    // Skip the death screen like an impatient player
+    if (playerData->state == PLAYER_STATE_DEAD) {
+        return (InputActionMask)1 << ACTION_ATTACK;
+    }
+    if (playerData->state != PLAYER_STATE_ALIVE) return 0;
+
+    // Play whichever ball is nearest
+    Entity* ball = BallPoolFindNearest(game->balls, player->x, player->y);
+    if (!ball) return 0;
+
+    // Without a hole, just chase the ball
+    if (!game->winCondition) {
+        return BotMoveTowards(player, ball->x, ball->y);
+    }
+
+    // Shot line from the ball to the hole, aimed a little off
+    float aimX = game->winCondition->position.x + bot->aimOffset.x;
+    float aimY = game->winCondition->position.y + bot->aimOffset.y;
+    float lineX = aimX - ball->x;
+    float lineY = aimY - ball->y;
+    float lineLength = sqrtf(lineX * lineX + lineY * lineY);
+    if (lineLength < 1.0f) {
+        return BotMoveTowards(player, ball->x, ball->y);
+    }
+    lineX /= lineLength;
+    lineY /= lineLength;
+
+    // Where the player is relative to the ball, along and across the line
+    float toPlayerX = player->x - ball->x;
+    float toPlayerY = player->y - ball->y;
+    float along = toPlayerX * lineX + toPlayerY * lineY;
+    float across = fabsf(toPlayerX * lineY - toPlayerY * lineX);
+
+    // Behind the ball and on the line: push through it
+    if (along < 0.0f && across < BOT_ALIGN_TOLERANCE) {
+        return BotMoveTowards(player, ball->x + lineX * BOT_APPROACH_DISTANCE, ball->y + lineY * BOT_APPROACH_DISTANCE);
+    }
+
+    // Otherwise walk round to the point behind the ball
+    return BotMoveTowards(player, ball->x - lineX * BOT_APPROACH_DISTANCE, ball->y - lineY * BOT_APPROACH_DISTANCE);
+}
+
+/**
+ * @brief Choose the bot's actions for the next simulation step
+ *
+ * Decisions are made every reactionTime seconds on average; the actions
+ * are held in between, as a person's would be.
+ *
+ * @param bot Pointer to bot
+ * @param game Pointer to game
+ * @param player Player entity the bot controls
+ * @param input The player's input manager
+ * @param deltaTime Step length in seconds
+ */
+void BotUpdate(Bot* bot, Game* game, Entity* player, InputManager* input, float deltaTime) {
+    if (!bot || !game || !player || !input) return;
+
+    bot->decisionTimer -= deltaTime;
+    if (bot->decisionTimer <= 0.0f) {
+        bot->decisionTimer += bot->reactionTime * RngFloatRange(&bot->rng, 0.5f, 1.5f);
+        bot->aimOffset.x = RngFloatRange(&bot->rng, -bot->aimNoise, bot->aimNoise);
+        bot->aimOffset.y = RngFloatRange(&bot->rng, -bot->aimNoise, bot->aimNoise);
+        bot->actions = BotDecide(bot, game, player);
+    }
+
+    InputManagerSetActions(input, bot->actions, NULL);
+}
@@ -0,0 +1,52 @@
+/**
+ * @file bot.h
+ * @brief Scripted player for headless matches
+ *
+ * This file defines a simple bot that plays a match through a player's
+ * input manager, the same way a person would. It lines up behind the ball
+ * and pushes it towards the hole, with a reaction delay and aim error so
+ * matches played from different seeds differ.
+ */
+#ifndef MESSY_GAME_BOT_H
+#define MESSY_GAME_BOT_H
+
+#include <stdint.h>
+#include "game.h"
+#include "rng.h"
+
+/**
+ * @brief Bot structure
+ */
+typedef struct {
+    Rng rng;                   // Aim and reaction jitter
+    float reactionTime;        // Average seconds between decisions
+    float aimNoise;            // Largest sideways aim error in pixels
+    float decisionTimer;       // Seconds until the next decision
+    Vector2 aimOffset;         // Aim error for the current decision
+    InputActionMask actions;   // Actions held until the next decision
+} Bot;
+
+/**
+ * @brief Initialize a bot
+ *
+ * @param bot Pointer to bot
+ * @param seed Game seed
+ * @param playerIndex Index of the player the bot controls
+ */
+void BotInit(Bot* bot, uint64_t seed, int playerIndex);
+
+/**
+ * @brief Choose the bot's actions for the next simulation step
+ *
+ * Call before GameSimulationStep; the actions are written to input with
+ * InputManagerSetActions.
+ *
+ * @param bot Pointer to bot
+ * @param game Pointer to game
+ * @param player Player entity the bot controls
+ * @param input The player's input manager
+ * @param deltaTime Step length in seconds
+ */
+void BotUpdate(Bot* bot, Game* game, Entity* player, InputManager* input, float deltaTime);
+
+#endif // MESSY_GAME_BOT_H
@@ -0,0 +1,245 @@
+/**
+ * @file broadphase.c
+ * @brief Implementation of the uniform grid broadphase
+ */
+
+#include <math.h>
+#include "broadphase.h"
+#include "raylib.h"
+
+/**
+ * @brief Get the bucket a cell hashes to
+ *
+ * @param cellX Cell column
+ * @param cellY Cell row
+ * @return int Bucket index
+ */
+static int BroadphaseBucket(int cellX, int cellY) {
+    unsigned int hash = ((unsigned int)cellX * 73856093u) ^ ((unsigned int)cellY * 19349663u);
+    return (int)(hash & (BROADPHASE_BUCKET_COUNT - 1));
+}
+
+/**
+ * @brief Get the cell a coordinate falls in
+ *
+ * @param broadphase Pointer to broadphase
+ * @param value X or Y coordinate
+ * @return int Cell column or row
+ */
+static int BroadphaseCell(const Broadphase* broadphase, float value) {
+    return (int)floorf(value / broadphase->cellSize);
+}
+
+/**
+ * @brief Initialize an empty broadphase
+ *
+ * @param broadphase Pointer to broadphase
+ * @param cellSize Cell width and height in pixels
+ */
+void BroadphaseInit(Broadphase* broadphase, float cellSize) {
+    if (!broadphase) return;
+
+    broadphase->cellSize = cellSize > 0.0f ? cellSize : 1.0f;
+    BroadphaseClear(broadphase);
+}
+
+/**
+ * @brief Remove every item
+ *
+ * @param broadphase Pointer to broadphase
+ */
+void BroadphaseClear(Broadphase* broadphase) {
+    if (!broadphase) return;
+
+    broadphase->itemCount = 0;
+    broadphase->entryCount = 0;
+    for (int i = 0; i <= BROADPHASE_BUCKET_COUNT; i++) {
+        broadphase->bucketStart[i] = 0;
+    }
+}
+
+/**
+ * @brief Insert an item
+ *
+ * @param broadphase Pointer to broadphase
+ * @param id Caller's index for the item
+ * @param minX Left edge of the item's bounding box
+ * @param minY Top edge of the item's bounding box
+ * @param maxX Right edge of the item's bounding box
+ * @param maxY Bottom edge of the item's bounding box
+ * @return bool Whether the item fit
+ */
+bool BroadphaseInsert(Broadphase* broadphase, int id, float minX, float minY, float maxX, float maxY) {
+    if (!broadphase) return false;
+
+    int minCellX = BroadphaseCell(broadphase, minX);
+    int minCellY = BroadphaseCell(broadphase, minY);
+    int maxCellX = BroadphaseCell(broadphase, maxX);
+    int maxCellY = BroadphaseCell(broadphase, maxY);
+    int cellCount = (maxCellX - minCellX + 1) * (maxCellY - minCellY + 1);
+
+    if (broadphase->itemCount >= BROADPHASE_MAX_ITEMS ||
+        broadphase->entryCount + cellCount > BROADPHASE_MAX_ENTRIES) {
+        TraceLog(LOG_DEBUG, "Broadphase full, dropping item %d", id);
+        return false;
+    }
+
+    int itemIndex = broadphase->itemCount++;
+    BroadphaseItem* item = &broadphase->items[itemIndex];
+    item->id = id;
+    item->minCellX = minCellX;
+    item->minCellY = minCellY;
+    item->maxCellX = maxCellX;
+    item->maxCellY = maxCellY;
+
+    for (int cellY = minCellY; cellY <= maxCellY; cellY++) {
+        for (int cellX = minCellX; cellX <= maxCellX; cellX++) {
+            BroadphaseEntry* entry = &broadphase->entries[broadphase->entryCount++];
+            entry->cellX = cellX;
+            entry->cellY = cellY;
+            entry->item = itemIndex;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Sort the inserted items into their buckets
+ *
+ * Call after inserting and before querying.
+ *
+ * @param broadphase Pointer to broadphase
+ */
+void BroadphaseBuild(Broadphase* broadphase) {
+    if (!broadphase) return;
+
+    // Count the entries in each bucket
+    for (int i = 0; i <= BROADPHASE_BUCKET_COUNT; i++) {
+        broadphase->bucketStart[i] = 0;
+    }
+    for (int i = 0; i < broadphase->entryCount; i++) {
+        const BroadphaseEntry* entry = &broadphase->entries[i];
+        broadphase->bucketStart[BroadphaseBucket(entry->cellX, entry->cellY) + 1]++;
+    }
+
+    // Turn the counts into start offsets
+    for (int i = 0; i < BROADPHASE_BUCKET_COUNT; i++) {
+        broadphase->bucketStart[i + 1] += broadphase->bucketStart[i];
+    }
+
+    // Place the entries, keeping insertion order within a bucket
+    int next[BROADPHASE_BUCKET_COUNT];
+    for (int i = 0; i < BROADPHASE_BUCKET_COUNT; i++) {
+        next[i] = broadphase->bucketStart[i];
+    }
+    for (int i = 0; i < broadphase->entryCount; i++) {
+        const BroadphaseEntry* entry = &broadphase->entries[i];
+        broadphase->sorted[next[BroadphaseBucket(entry->cellX, entry->cellY)]++] = *entry;
+    }
+}
+
+/**
+ * @brief Find the items whose cells a box touches
+ *
+ * Each item is reported once. Items are only known by their cells, so
+ * callers still test the real shapes.
+ *
+ * @param broadphase Pointer to broadphase
+ * @param minX Left edge of the box
+ * @param minY Top edge of the box
+ * @param maxX Right edge of the box
+ * @param maxY Bottom edge of the box
+ * @param ids Array to store the caller's indices of the items
+ * @param maxIds Capacity of ids
+ * @return int Number of items stored
+ */
+int BroadphaseQuery(const Broadphase* broadphase, float minX, float minY, float maxX, float maxY, int* ids, int maxIds) {
+    if (!broadphase || !ids || maxIds <= 0) return 0;
+
+    int minCellX = BroadphaseCell(broadphase, minX);
+    int minCellY = BroadphaseCell(broadphase, minY);
+    int maxCellX = BroadphaseCell(broadphase, maxX);
+    int maxCellY = BroadphaseCell(broadphase, maxY);
+    int count = 0;
+
+    // A box covering more cells than there are items is cheaper to check item by item
+    if ((maxCellX - minCellX + 1) * (maxCellY - minCellY + 1) > broadphase->itemCount) {
+        for (int i = 0; i < broadphase->itemCount && count < maxIds; i++) {
+            const BroadphaseItem* item = &broadphase->items[i];
+            if (item->maxCellX < minCellX || item->minCellX > maxCellX ||
+                item->maxCellY < minCellY || item->minCellY > maxCellY) {
+                continue;
+            }
+            ids[count++] = item->id;
+        }
+        return count;
+    }
+
+    for (int cellY = minCellY; cellY <= maxCellY; cellY++) {
+        for (int cellX = minCellX; cellX <= maxCellX; cellX++) {
+            int bucket = BroadphaseBucket(cellX, cellY);
+            for (int i = broadphase->bucketStart[bucket]; i < broadphase->bucketStart[bucket + 1]; i++) {
+                const BroadphaseEntry* entry = &broadphase->sorted[i];
+                if (entry->cellX != cellX || entry->cellY != cellY) continue;
+
+                // Report the item only from the first cell it shares with the box
+                const BroadphaseItem* item = &broadphase->items[entry->item];
+                int firstX = item->minCellX > minCellX ? item->minCellX : minCellX;
+                int firstY = item->minCellY > minCellY ? item->minCellY : minCellY;
+                if (cellX != firstX || cellY != firstY) continue;
+
+                if (count >= maxIds) return count;
+                ids[count++] = item->id;
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Find every pair of items that share a cell
+ *
+ * Each pair is reported once.
+ *
+ * @param broadphase Pointer to broadphase
+ * @param pairs Array to store the pairs
+ * @param maxPairs Capacity of pairs
+ * @return int Number of pairs stored
+ */
+int BroadphaseFindPairs(const Broadphase* broadphase, BroadphasePair* pairs, int maxPairs) {
+    if (!broadphase || !pairs || maxPairs <= 0) return 0;
+
+    int count = 0;
+    for (int bucket = 0; bucket < BROADPHASE_BUCKET_COUNT; bucket++) {
+        int start = broadphase->bucketStart[bucket];
+        int end = broadphase->bucketStart[bucket + 1];
+
+        for (int i = start; i < end; i++) {
+            const BroadphaseEntry* first = &broadphase->sorted[i];
+            const BroadphaseItem* a = &broadphase->items[first->item];
+
+            for (int j = i + 1; j < end; j++) {
+                const BroadphaseEntry* second = &broadphase->sorted[j];
+                if (second->cellX != first->cellX || second->cellY != first->cellY) continue;
+
+                // Report the pair only from the first cell the two items share
+                const BroadphaseItem* b = &broadphase->items[second->item];
+                int firstX = a->minCellX > b->minCellX ? a->minCellX : b->minCellX;
+                int firstY = a->minCellY > b->minCellY ? a->minCellY : b->minCellY;
+                if (first->cellX != firstX || first->cellY != firstY) continue;
+
+                if (count >= maxPairs) {
+                    TraceLog(LOG_DEBUG, "Broadphase pair list full");
+                    return count;
+                }
+                pairs[count].a = a->id;
+                pairs[count].b = b->id;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
\ No newline at end of file
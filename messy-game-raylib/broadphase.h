@@ -0,0 +1,129 @@
+/**
+ * @file broadphase.h
+ * @brief Uniform grid broadphase
+ *
+ * This file defines the broadphase that finds which boxes may overlap
+ * without testing every pair. Items are binned into the square grid
+ * cells their bounding box covers; cells are hashed into a fixed number
+ * of buckets and the entries sorted by bucket, so a build is a counting
+ * sort and a query only looks at the buckets of the cells it covers.
+ * Everything lives in fixed arrays, and results come out in the same
+ * order for the same inputs.
+ */
+#ifndef MESSY_GAME_BROADPHASE_H
+#define MESSY_GAME_BROADPHASE_H
+
+#include <stdbool.h>
+
+#define BROADPHASE_MAX_ITEMS 512       // Upper bound on items in one build
+#define BROADPHASE_MAX_ENTRIES 2048    // Upper bound on item-cell entries (an item covering 4 cells uses 4)
+#define BROADPHASE_BUCKET_COUNT 1024   // Hash buckets (must be a power of two)
+
+/**
+ * @brief Item in the grid
+ */
+typedef struct {
+    int id;                    // Caller's index for the item
+    int minCellX;              // First cell column the item covers
+    int minCellY;              // First cell row the item covers
+    int maxCellX;              // Last cell column the item covers
+    int maxCellY;              // Last cell row the item covers
+} BroadphaseItem;
+
+/**
+ * @brief One item in one cell
+ */
+typedef struct {
+    int cellX;                 // Cell column
+    int cellY;                 // Cell row
+    int item;                  // Index into items
+} BroadphaseEntry;
+
+/**
+ * @brief Pair of items that may overlap
+ */
+typedef struct {
+    int a;                     // Caller's index of the first item
+    int b;                     // Caller's index of the second item
+} BroadphasePair;
+
+/**
+ * @brief Uniform grid broadphase
+ */
+typedef struct {
+    float cellSize;            // Cell width and height in pixels
+    BroadphaseItem items[BROADPHASE_MAX_ITEMS]; // Items inserted since the last clear
+    int itemCount;             // Number of items
+    BroadphaseEntry entries[BROADPHASE_MAX_ENTRIES]; // Entries in insertion order
+    int entryCount;            // Number of entries
+    BroadphaseEntry sorted[BROADPHASE_MAX_ENTRIES]; // Entries grouped by bucket (valid after a build)
+    int bucketStart[BROADPHASE_BUCKET_COUNT + 1]; // First sorted entry of each bucket
+} Broadphase;
+
+/**
+ * @brief Initialize an empty broadphase
+ *
+ * @param broadphase Pointer to broadphase
+ * @param cellSize Cell width and height in pixels
+ */
+void BroadphaseInit(Broadphase* broadphase, float cellSize);
+
+/**
+ * @brief Remove every item
+ *
+ * @param broadphase Pointer to broadphase
+ */
+void BroadphaseClear(Broadphase* broadphase);
+
+/**
+ * @brief Insert an item
+ *
+ * @param broadphase Pointer to broadphase
+ * @param id Caller's index for the item
+ * @param minX Left edge of the item's bounding box
+ * @param minY Top edge of the item's bounding box
+ * @param maxX Right edge of the item's bounding box
+ * @param maxY Bottom edge of the item's bounding box
+ * @return bool Whether the item fit
+ */
+bool BroadphaseInsert(Broadphase* broadphase, int id, float minX, float minY, float maxX, float maxY);
+
+/**
+ * @brief Sort the inserted items into their buckets
+ *
+ * Call after inserting and before querying.
+ *
+ * @param broadphase Pointer to broadphase
+ */
+void BroadphaseBuild(Broadphase* broadphase);
+
+/**
+ * @brief Find the items whose cells a box touches
+ *
+ * Each item is reported once. Items are only known by their cells, so
+ * callers still test the real shapes.
+ *
+ * @param broadphase Pointer to broadphase
+ * @param minX Left edge of the box
+ * @param minY Top edge of the box
+ * @param maxX Right edge of the box
+ * @param maxY Bottom edge of the box
+ * @param ids Array to store the caller's indices of the items
+ * @param maxIds Capacity of ids
+ * @return int Number of items stored
+ */
+int BroadphaseQuery(const Broadphase* broadphase, float minX, float minY, float maxX, float maxY, int* ids, int maxIds);
+
+/**
+ * @brief Find every pair of items that share a cell
+ *
+ * Each pair is reported once.
+ *
+ * @param broadphase Pointer to broadphase
+ * @param pairs Array to store the pairs
+ * @param maxPairs Capacity of pairs
+ * @return int Number of pairs stored
+ */
+int BroadphaseFindPairs(const Broadphase* broadphase, BroadphasePair* pairs, int maxPairs);
+
+#endif // MESSY_GAME_BROADPHASE_H
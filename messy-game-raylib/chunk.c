@@ -0,0 +1,766 @@
+/**
+ * @file chunk.c
+ * @brief Implementation of streamed chunk storage for open worlds
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+#include "chunk.h"
+#include "rng.h"
+
+// Chunk file identification
+#define CHUNK_FILE_MAGIC "MGCK"        // First four bytes of every chunk file
+#define CHUNK_FILE_VERSION 1           // Bump when the layout changes
+
+/**
+ * @brief Chunk file header, followed by CHUNK_SIZE * CHUNK_SIZE tile bytes
+ */
+typedef struct {
+    char magic[4];             // CHUNK_FILE_MAGIC
+    uint16_t version;          // CHUNK_FILE_VERSION
+    uint16_t size;             // CHUNK_SIZE the file was written with
+    int32_t chunkX;            // Chunk X position in chunks
+    int32_t chunkY;            // Chunk Y position in chunks
+} ChunkFileHeader;
+
+// Compile-time checks: the file layout must not depend on padding, and the
+// pool must hold every chunk inside the stream radius
+typedef char ChunkHeaderSizeCheck[(sizeof(ChunkFileHeader) == 16) ? 1 : -1];
+typedef char ChunkCapacityCheck[
+    (CHUNK_CACHE_CAPACITY >= (2 * CHUNK_STREAM_RADIUS + 1) * (2 * CHUNK_STREAM_RADIUS + 1)) ? 1 : -1];
+
+/**
+ * @brief Hash chunk coordinates
+ *
+ * @param chunkX Chunk X position
+ * @param chunkY Chunk Y position
+ * @return uint32_t Hash value
+ */
+static uint32_t ChunkHash(int chunkX, int chunkY) {
+    uint32_t hash = (uint32_t)chunkX * 0x9E3779B1u ^ (uint32_t)chunkY * 0x85EBCA77u;
+    hash ^= hash >> 15;
+    return hash;
+}
+
+/**
+ * @brief Find a resident chunk in the hash table
+ *
+ * @param map Pointer to chunk map
+ * @param chunkX Chunk X position
+ * @param chunkY Chunk Y position
+ * @return Chunk* Chunk or NULL if not resident
+ */
+static Chunk* ChunkMapFind(ChunkMap* map, int chunkX, int chunkY) {
+    int mask = map->tableCapacity - 1;
+    int index = (int)(ChunkHash(chunkX, chunkY) & (uint32_t)mask);
+
+    // Linear probing until an empty slot
+    while (map->table[index]) {
+        Chunk* chunk = map->table[index];
+        if (chunk->chunkX == chunkX && chunk->chunkY == chunkY) {
+            return chunk;
+        }
+        index = (index + 1) & mask;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a resident chunk, checking the last lookup first
+ *
+ * Neighbouring tile queries almost always hit the same chunk.
+ *
+ * @param map Pointer to chunk map
+ * @param chunkX Chunk X position
+ * @param chunkY Chunk Y position
+ * @return Chunk* Chunk or NULL if not resident
+ */
+static Chunk* ChunkMapLookup(ChunkMap* map, int chunkX, int chunkY) {
+    Chunk* chunk = map->lastChunk;
+    if (chunk && chunk->chunkX == chunkX && chunk->chunkY == chunkY) {
+        return chunk;
+    }
+
+    chunk = ChunkMapFind(map, chunkX, chunkY);
+    if (chunk) {
+        map->lastChunk = chunk;
+    }
+
+    return chunk;
+}
+
+/**
+ * @brief Insert a chunk into the hash table
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk to insert (must not be resident)
+ */
+static void ChunkMapInsert(ChunkMap* map, Chunk* chunk) {
+    int mask = map->tableCapacity - 1;
+    int index = (int)(ChunkHash(chunk->chunkX, chunk->chunkY) & (uint32_t)mask);
+
+    while (map->table[index]) {
+        index = (index + 1) & mask;
+    }
+
+    map->table[index] = chunk;
+}
+
+/**
+ * @brief Remove a chunk from the hash table
+ *
+ * Uses backward-shift deletion so probe sequences stay intact without
+ * tombstones.
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk to remove
+ */
+static void ChunkMapRemove(ChunkMap* map, Chunk* chunk) {
+    int mask = map->tableCapacity - 1;
+    int hole = (int)(ChunkHash(chunk->chunkX, chunk->chunkY) & (uint32_t)mask);
+
+    // Find the chunk's slot
+    while (map->table[hole] && map->table[hole] != chunk) {
+        hole = (hole + 1) & mask;
+    }
+    if (!map->table[hole]) return;
+
+    map->table[hole] = NULL;
+
+    // Shift later entries of the probe run back into the hole
+    int index = hole;
+    for (;;) {
+        index = (index + 1) & mask;
+        Chunk* next = map->table[index];
+        if (!next) break;
+
+        int home = (int)(ChunkHash(next->chunkX, next->chunkY) & (uint32_t)mask);
+        bool homeBetween = (hole <= index) ?
+            (home > hole && home <= index) :
+            (home > hole || home <= index);
+
+        if (!homeBetween) {
+            map->table[hole] = next;
+            map->table[index] = NULL;
+            hole = index;
+        }
+    }
+
+    if (map->lastChunk == chunk) {
+        map->lastChunk = NULL;
+    }
+}
+
+/**
+ * @brief Build the file path of a chunk
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk
+ * @param path Buffer to store path
+ * @param pathSize Size of buffer
+ */
+static void ChunkFilePath(ChunkMap* map, Chunk* chunk, char* path, size_t pathSize) {
+    sprintf_s(path, pathSize, "%s/chunk_%d_%d.bin", map->directory, chunk->chunkX, chunk->chunkY);
+}
+
+/**
+ * @brief Read a chunk from its file
+ *
+ * Runs on the I/O thread.
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk to fill (coordinates set)
+ * @return true If the chunk was read
+ * @return false If there is no valid file for the chunk
+ */
+static bool ChunkReadFile(ChunkMap* map, Chunk* chunk) {
+    char path[256];
+    ChunkFilePath(map, chunk, path, sizeof(path));
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    ChunkFileHeader header;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+        memcmp(header.magic, CHUNK_FILE_MAGIC, 4) == 0 &&
+        header.version == CHUNK_FILE_VERSION &&
+        header.size == CHUNK_SIZE &&
+        header.chunkX == chunk->chunkX &&
+        header.chunkY == chunk->chunkY &&
+        fread(chunk->tiles, sizeof(chunk->tiles), 1, file) == 1;
+    fclose(file);
+
+    if (!valid) {
+        TraceLog(LOG_WARNING, "Ignoring invalid chunk file: %s", path);
+        return false;
+    }
+
+    // Unknown tile types become floor
+    for (int i = 0; i < CHUNK_SIZE * CHUNK_SIZE; i++) {
+        if (chunk->tiles[i] >= TILE_TYPE_COUNT) {
+            chunk->tiles[i] = TILE_TYPE_EMPTY;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write a chunk to its file
+ *
+ * Runs on the I/O thread, or on the main thread once the I/O thread has
+ * stopped.
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk to write
+ * @return true If the chunk was written
+ * @return false If writing failed
+ */
+static bool ChunkWriteFile(ChunkMap* map, Chunk* chunk) {
+    char path[256];
+    ChunkFilePath(map, chunk, path, sizeof(path));
+
+    ChunkFileHeader header = { 0 };
+    memcpy(header.magic, CHUNK_FILE_MAGIC, 4);
+    header.version = CHUNK_FILE_VERSION;
+    header.size = CHUNK_SIZE;
+    header.chunkX = chunk->chunkX;
+    header.chunkY = chunk->chunkY;
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        TraceLog(LOG_WARNING, "Failed to open chunk file for writing: %s", path);
+        return false;
+    }
+
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(chunk->tiles, sizeof(chunk->tiles), 1, file) == 1;
+    fclose(file);
+
+    if (!success) {
+        TraceLog(LOG_WARNING, "Failed to write chunk file: %s", path);
+    }
+
+    return success;
+}
+
+/**
+ * @brief Generate a chunk that has no file
+ *
+ * The layout depends only on the map seed and chunk coordinates, so a
+ * chunk looks the same every time it is streamed in. Obstacles keep one
+ * tile clear along chunk edges so neighbouring chunks always connect.
+ * Runs on the I/O thread.
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Chunk to fill (coordinates set)
+ */
+static void ChunkGenerate(ChunkMap* map, Chunk* chunk) {
+    memset(chunk->tiles, TILE_TYPE_EMPTY, sizeof(chunk->tiles));
+
+    Rng rng;
+    uint64_t chunkKey = ((uint64_t)(uint32_t)chunk->chunkX << 32) | (uint32_t)chunk->chunkY;
+    RngSeed(&rng, map->seed ^ chunkKey, RNG_STREAM_WORLD);
+
+    // Scatter rectangular obstacles
+    int obstacleCount = RngRange(&rng, 2, 6);
+    for (int i = 0; i < obstacleCount; i++) {
+        int width = RngRange(&rng, 1, 4);
+        int height = RngRange(&rng, 1, 4);
+        int left = RngRange(&rng, 1, CHUNK_SIZE - 1 - width);
+        int top = RngRange(&rng, 1, CHUNK_SIZE - 1 - height);
+
+        for (int y = top; y < top + height; y++) {
+            for (int x = left; x < left + width; x++) {
+                chunk->tiles[y * CHUNK_SIZE + x] = TILE_TYPE_WALL;
+            }
+        }
+    }
+
+    // Close the world border and keep the spawn area clear
+    int worldWidth = map->widthInChunks * CHUNK_SIZE;
+    int worldHeight = map->heightInChunks * CHUNK_SIZE;
+    int centerX = worldWidth / 2;
+    int centerY = worldHeight / 2;
+
+    for (int y = 0; y < CHUNK_SIZE; y++) {
+        for (int x = 0; x < CHUNK_SIZE; x++) {
+            int tileX = chunk->chunkX * CHUNK_SIZE + x;
+            int tileY = chunk->chunkY * CHUNK_SIZE + y;
+
+            if (tileX == 0 || tileY == 0 || tileX == worldWidth - 1 || tileY == worldHeight - 1) {
+                chunk->tiles[y * CHUNK_SIZE + x] = TILE_TYPE_WALL;
+            }
+            else if (abs(tileX - centerX) <= CHUNK_SPAWN_CLEAR_RADIUS &&
+                abs(tileY - centerY) <= CHUNK_SPAWN_CLEAR_RADIUS) {
+                chunk->tiles[y * CHUNK_SIZE + x] = TILE_TYPE_EMPTY;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Append a job to a queue
+ *
+ * @param queue Pointer to queue
+ * @param job Job to append
+ * @return true If the job was queued
+ * @return false If the queue is full
+ */
+static bool ChunkJobQueuePush(ChunkJobQueue* queue, ChunkJob job) {
+    if (queue->count >= CHUNK_QUEUE_CAPACITY) return false;
+
+    queue->jobs[(queue->head + queue->count) % CHUNK_QUEUE_CAPACITY] = job;
+    queue->count++;
+    return true;
+}
+
+/**
+ * @brief Remove the oldest job from a queue
+ *
+ * @param queue Pointer to queue
+ * @param job Pointer to store the job
+ * @return true If a job was removed
+ * @return false If the queue is empty
+ */
+static bool ChunkJobQueuePop(ChunkJobQueue* queue, ChunkJob* job) {
+    if (queue->count == 0) return false;
+
+    *job = queue->jobs[queue->head];
+    queue->head = (queue->head + 1) % CHUNK_QUEUE_CAPACITY;
+    queue->count--;
+    return true;
+}
+
+/**
+ * @brief I/O thread entry point
+ *
+ * Loads, generates and saves chunks until told to quit, finishing any
+ * queued jobs first.
+ *
+ * @param userData Pointer to chunk map
+ */
+static void ChunkWorkerMain(void* userData) {
+    ChunkMap* map = (ChunkMap*)userData;
+
+    PlatformMutexLock(map->mutex);
+    for (;;) {
+        while (map->requests.count == 0 && !map->quit) {
+            PlatformConditionWait(map->workAvailable, map->mutex);
+        }
+
+        ChunkJob job;
+        if (!ChunkJobQueuePop(&map->requests, &job)) break;
+
+        // Do the I/O without holding the lock
+        PlatformMutexUnlock(map->mutex);
+
+        if (job.type == CHUNK_JOB_LOAD) {
+            if (!ChunkReadFile(map, job.chunk)) {
+                ChunkGenerate(map, job.chunk);
+            }
+        }
+        else {
+            ChunkWriteFile(map, job.chunk);
+        }
+
+        PlatformMutexLock(map->mutex);
+        ChunkJobQueuePush(&map->completed, job);
+        PlatformConditionSignal(map->workFinished);
+    }
+    PlatformMutexUnlock(map->mutex);
+}
+
+/**
+ * @brief Hand a job to the I/O thread
+ *
+ * @param map Pointer to chunk map
+ * @param type Job type
+ * @param chunk Chunk to load or save
+ * @return true If the job was queued
+ * @return false If too many jobs are in flight
+ */
+static bool ChunkMapSubmit(ChunkMap* map, ChunkJobType type, Chunk* chunk) {
+    // Jobs in flight are bounded so the completed queue can never overflow
+    if (map->pendingJobs >= CHUNK_QUEUE_CAPACITY) return false;
+
+    ChunkJob job = { type, chunk };
+
+    PlatformMutexLock(map->mutex);
+    ChunkJobQueuePush(&map->requests, job);
+    PlatformConditionSignal(map->workAvailable);
+    PlatformMutexUnlock(map->mutex);
+
+    map->pendingJobs++;
+    return true;
+}
+
+/**
+ * @brief Queue an edited chunk for saving
+ *
+ * @param map Pointer to chunk map
+ * @param chunk Ready, dirty chunk
+ * @return true If the save was queued
+ * @return false If too many jobs are in flight
+ */
+static bool ChunkMapSubmitSave(ChunkMap* map, Chunk* chunk) {
+    if (!ChunkMapSubmit(map, CHUNK_JOB_SAVE, chunk)) return false;
+
+    // Tiles stay readable but are frozen until the write finishes
+    chunk->state = CHUNK_STATE_SAVING;
+    chunk->dirty = false;
+    return true;
+}
+
+/**
+ * @brief Apply jobs the I/O thread has finished
+ *
+ * @param map Pointer to chunk map
+ */
+static void ChunkMapCollect(ChunkMap* map) {
+    ChunkJob finished[CHUNK_QUEUE_CAPACITY];
+    int finishedCount = 0;
+
+    PlatformMutexLock(map->mutex);
+    while (ChunkJobQueuePop(&map->completed, &finished[finishedCount])) {
+        finishedCount++;
+    }
+    PlatformMutexUnlock(map->mutex);
+
+    for (int i = 0; i < finishedCount; i++) {
+        Chunk* chunk = finished[i].chunk;
+        map->pendingJobs--;
+
+        if (finished[i].type == CHUNK_JOB_LOAD) {
+            chunk->state = CHUNK_STATE_READY;
+        }
+        else if (chunk->lastUsed == map->tick) {
+            // Saved while still in range: keep it
+            chunk->state = CHUNK_STATE_READY;
+        }
+        else {
+            ChunkMapRemove(map, chunk);
+            chunk->state = CHUNK_STATE_FREE;
+        }
+    }
+}
+
+/**
+ * @brief Get a free chunk slot, evicting if needed
+ *
+ * Evicts the least recently used clean chunk outside the stream radius.
+ * Dirty chunks outside the radius are queued for saving and freed once
+ * written.
+ *
+ * @param map Pointer to chunk map
+ * @return Chunk* Free slot or NULL if none is available this tick
+ */
+static Chunk* ChunkMapAcquireSlot(ChunkMap* map) {
+    Chunk* victim = NULL;
+
+    for (int i = 0; i < CHUNK_CACHE_CAPACITY; i++) {
+        Chunk* chunk = &map->pool[i];
+        if (chunk->state == CHUNK_STATE_FREE) return chunk;
+        if (chunk->state != CHUNK_STATE_READY || chunk->lastUsed == map->tick) continue;
+
+        if (chunk->dirty) {
+            ChunkMapSubmitSave(map, chunk);
+            continue;
+        }
+
+        if (!victim || chunk->lastUsed < victim->lastUsed) {
+            victim = chunk;
+        }
+    }
+
+    if (!victim) return NULL;
+
+    ChunkMapRemove(map, victim);
+    victim->state = CHUNK_STATE_FREE;
+    return victim;
+}
+
+/**
+ * @brief Start loading a chunk
+ *
+ * @param map Pointer to chunk map
+ * @param chunkX Chunk X position
+ * @param chunkY Chunk Y position
+ */
+static void ChunkMapRequest(ChunkMap* map, int chunkX, int chunkY) {
+    if (map->pendingJobs >= CHUNK_QUEUE_CAPACITY) return;
+
+    Chunk* chunk = ChunkMapAcquireSlot(map);
+    if (!chunk) return;
+
+    chunk->chunkX = chunkX;
+    chunk->chunkY = chunkY;
+    chunk->state = CHUNK_STATE_LOADING;
+    chunk->dirty = false;
+    chunk->lastUsed = map->tick;
+
+    // Saves queued while acquiring the slot may have used up the queue
+    if (!ChunkMapSubmit(map, CHUNK_JOB_LOAD, chunk)) {
+        chunk->state = CHUNK_STATE_FREE;
+        return;
+    }
+
+    ChunkMapInsert(map, chunk);
+}
+
+/**
+ * @brief Create a chunk map and start its I/O thread
+ *
+ * @param widthInChunks World width in chunks
+ * @param heightInChunks World height in chunks
+ * @param directory Directory holding chunk files
+ * @param seed Seed for generating chunks with no file
+ * @return ChunkMap* Pointer to the created chunk map or NULL if failed
+ */
+ChunkMap* ChunkMapCreate(int widthInChunks, int heightInChunks, const char* directory, uint64_t seed) {
+    if (widthInChunks <= 0 || heightInChunks <= 0 || !directory) return NULL;
+
+    ChunkMap* map = (ChunkMap*)calloc(1, sizeof(ChunkMap));
+    if (!map) {
+        TraceLog(LOG_ERROR, "Failed to allocate chunk map");
+        return NULL;
+    }
+
+    map->widthInChunks = widthInChunks;
+    map->heightInChunks = heightInChunks;
+    map->seed = seed;
+
+    // Hash table at most half full
+    map->tableCapacity = 1;
+    while (map->tableCapacity < CHUNK_CACHE_CAPACITY * 2) {
+        map->tableCapacity *= 2;
+    }
+
+    map->pool = (Chunk*)calloc(CHUNK_CACHE_CAPACITY, sizeof(Chunk));
+    map->table = (Chunk**)calloc(map->tableCapacity, sizeof(Chunk*));
+    map->directory = _strdup(directory);
+    map->mutex = PlatformMutexCreate();
+    map->workAvailable = PlatformConditionCreate();
+    map->workFinished = PlatformConditionCreate();
+
+    if (!map->pool || !map->table || !map->directory || !map->mutex ||
+        !map->workAvailable || !map->workFinished) {
+        TraceLog(LOG_ERROR, "Failed to allocate chunk map storage");
+        ChunkMapDestroy(map);
+        return NULL;
+    }
+
+    map->thread = PlatformThreadCreate(ChunkWorkerMain, map);
+    if (!map->thread) {
+        TraceLog(LOG_ERROR, "Failed to start chunk I/O thread");
+        ChunkMapDestroy(map);
+        return NULL;
+    }
+
+    TraceLog(LOG_INFO, "Created chunk map %dx%d chunks (%d resident max)",
+        widthInChunks, heightInChunks, CHUNK_CACHE_CAPACITY);
+
+    return map;
+}
+
+/**
+ * @brief Stop the I/O thread, save edited chunks and free the chunk map
+ *
+ * @param map Pointer to chunk map
+ */
+void ChunkMapDestroy(ChunkMap* map) {
+    if (!map) return;
+
+    // Let the I/O thread finish queued jobs, then stop it
+    if (map->thread) {
+        PlatformMutexLock(map->mutex);
+        map->quit = true;
+        PlatformConditionBroadcast(map->workAvailable);
+        PlatformMutexUnlock(map->mutex);
+
+        PlatformThreadJoin(map->thread);
+    }
+
+    // Save remaining edits directly now that nothing else touches the files
+    if (map->pool) {
+        for (int i = 0; i < CHUNK_CACHE_CAPACITY; i++) {
+            Chunk* chunk = &map->pool[i];
+            if (chunk->state == CHUNK_STATE_READY && chunk->dirty) {
+                ChunkWriteFile(map, chunk);
+            }
+        }
+    }
+
+    PlatformConditionDestroy(map->workFinished);
+    PlatformConditionDestroy(map->workAvailable);
+    PlatformMutexDestroy(map->mutex);
+    free(map->directory);
+    free(map->table);
+    free(map->pool);
+    free(map);
+}
+
+/**
+ * @brief Stream chunks around a focus point
+ *
+ * @param map Pointer to chunk map
+ * @param tileX Focus X position in tiles
+ * @param tileY Focus Y position in tiles
+ */
+void ChunkMapUpdate(ChunkMap* map, int tileX, int tileY) {
+    if (!map) return;
+
+    ChunkMapCollect(map);
+    map->tick++;
+
+    // Clamp the focus to the world
+    int focusX = tileX / CHUNK_SIZE;
+    int focusY = tileY / CHUNK_SIZE;
+    if (focusX < 0) focusX = 0;
+    if (focusY < 0) focusY = 0;
+    if (focusX >= map->widthInChunks) focusX = map->widthInChunks - 1;
+    if (focusY >= map->heightInChunks) focusY = map->heightInChunks - 1;
+    map->focusChunkX = focusX;
+    map->focusChunkY = focusY;
+
+    // Visit rings around the focus so the nearest chunks load first
+    for (int ring = 0; ring <= CHUNK_STREAM_RADIUS; ring++) {
+        for (int dy = -ring; dy <= ring; dy++) {
+            for (int dx = -ring; dx <= ring; dx++) {
+                if (abs(dx) != ring && abs(dy) != ring) continue;
+
+                int chunkX = focusX + dx;
+                int chunkY = focusY + dy;
+                if (chunkX < 0 || chunkY < 0 || chunkX >= map->widthInChunks || chunkY >= map->heightInChunks) {
+                    continue;
+                }
+
+                Chunk* chunk = ChunkMapFind(map, chunkX, chunkY);
+                if (chunk) {
+                    chunk->lastUsed = map->tick;
+                }
+                else {
+                    ChunkMapRequest(map, chunkX, chunkY);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Stream chunks around a focus point and wait until they are loaded
+ *
+ * @param map Pointer to chunk map
+ * @param tileX Focus X position in tiles
+ * @param tileY Focus Y position in tiles
+ */
+void ChunkMapPrefetch(ChunkMap* map, int tileX, int tileY) {
+    if (!map) return;
+
+    ChunkMapUpdate(map, tileX, tileY);
+
+    for (;;) {
+        // Check whether every chunk in range is ready
+        bool loading = false;
+        for (int dy = -CHUNK_STREAM_RADIUS; dy <= CHUNK_STREAM_RADIUS && !loading; dy++) {
+            for (int dx = -CHUNK_STREAM_RADIUS; dx <= CHUNK_STREAM_RADIUS; dx++) {
+                int chunkX = map->focusChunkX + dx;
+                int chunkY = map->focusChunkY + dy;
+                if (chunkX < 0 || chunkY < 0 || chunkX >= map->widthInChunks || chunkY >= map->heightInChunks) {
+                    continue;
+                }
+
+                Chunk* chunk = ChunkMapFind(map, chunkX, chunkY);
+                if (!chunk || chunk->state == CHUNK_STATE_LOADING) {
+                    loading = true;
+                    break;
+                }
+            }
+        }
+
+        // Nothing left to wait for
+        if (!loading || map->pendingJobs == 0) break;
+
+        PlatformMutexLock(map->mutex);
+        while (map->completed.count == 0) {
+            PlatformConditionWait(map->workFinished, map->mutex);
+        }
+        PlatformMutexUnlock(map->mutex);
+
+        ChunkMapUpdate(map, tileX, tileY);
+    }
+}
+
+/**
+ * @brief Queue every edited chunk for saving
+ *
+ * @param map Pointer to chunk map
+ * @return int Number of chunks that could not be queued this call
+ */
+int ChunkMapFlush(ChunkMap* map) {
+    if (!map) return 0;
+
+    int remaining = 0;
+    for (int i = 0; i < CHUNK_CACHE_CAPACITY; i++) {
+        Chunk* chunk = &map->pool[i];
+        if (chunk->state == CHUNK_STATE_READY && chunk->dirty) {
+            if (!ChunkMapSubmitSave(map, chunk)) {
+                remaining++;
+            }
+        }
+    }
+
+    return remaining;
+}
+
+/**
+ * @brief Get tile type at position
+ *
+ * @param map Pointer to chunk map
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @return TileType Tile type (TILE_TYPE_WALL if out of bounds or not loaded)
+ */
+TileType ChunkMapGetTile(ChunkMap* map, int x, int y) {
+    if (!map) return TILE_TYPE_WALL;
+
+    if (x < 0 || y < 0 || x >= map->widthInChunks * CHUNK_SIZE || y >= map->heightInChunks * CHUNK_SIZE) {
+        return TILE_TYPE_WALL;
+    }
+
+    // Chunks that have not streamed in yet are solid
+    Chunk* chunk = ChunkMapLookup(map, x / CHUNK_SIZE, y / CHUNK_SIZE);
+    if (!chunk || chunk->state == CHUNK_STATE_LOADING) {
+        return TILE_TYPE_WALL;
+    }
+
+    return (TileType)chunk->tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+}
+
+/**
+ * @brief Set tile type at position
+ *
+ * @param map Pointer to chunk map
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @param type Tile type to set
+ * @return true Tile was set
+ * @return false Chunk is not loaded or is being saved
+ */
+bool ChunkMapSetTile(ChunkMap* map, int x, int y, TileType type) {
+    if (!map) return false;
+
+    if (x < 0 || y < 0 || x >= map->widthInChunks * CHUNK_SIZE || y >= map->heightInChunks * CHUNK_SIZE) {
+        return false;
+    }
+
+    Chunk* chunk = ChunkMapLookup(map, x / CHUNK_SIZE, y / CHUNK_SIZE);
+    if (!chunk || chunk->state != CHUNK_STATE_READY) return false;
+
+    chunk->tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)] = (unsigned char)type;
+    chunk->dirty = true;
+    return true;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file chunk.h
+ * @brief Streamed chunk storage for open worlds
+ *
+ * This file defines the chunk map used by open worlds. The world is split
+ * into CHUNK_SIZE x CHUNK_SIZE tile chunks; only the chunks around a focus
+ * point are resident. Chunks live in a fixed pool indexed by a hash map on
+ * their coordinates, and are loaded, generated and saved on a background
+ * I/O thread, so memory use does not depend on world size.
+ */
+#ifndef MESSY_GAME_CHUNK_H
+#define MESSY_GAME_CHUNK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "tile.h"
+#include "platform.h"
+
+/**
+ * @brief Chunk states enumeration
+ *
+ * Only the main thread changes a chunk's state.
+ */
+typedef enum {
+    CHUNK_STATE_FREE,          // Slot is unused
+    CHUNK_STATE_LOADING,       // Queued for or being filled by the I/O thread
+    CHUNK_STATE_READY,         // Tiles are valid and may be edited
+    CHUNK_STATE_SAVING,        // Tiles are valid but being written by the I/O thread
+    CHUNK_STATE_COUNT
+} ChunkState;
+
+/**
+ * @brief Chunk structure
+ */
+typedef struct {
+    int chunkX;                // Chunk X position in chunks
+    int chunkY;                // Chunk Y position in chunks
+    ChunkState state;          // Current state
+    bool dirty;                // Whether tiles changed since loading
+    unsigned int lastUsed;     // Streaming tick when last inside the stream radius
+    unsigned char tiles[CHUNK_SIZE * CHUNK_SIZE]; // Row-major TileType values
+} Chunk;
+
+/**
+ * @brief Chunk I/O job types enumeration
+ */
+typedef enum {
+    CHUNK_JOB_LOAD,            // Read chunk from disk, or generate it
+    CHUNK_JOB_SAVE,            // Write chunk to disk
+    CHUNK_JOB_COUNT
+} ChunkJobType;
+
+/**
+ * @brief Chunk I/O job
+ */
+typedef struct {
+    ChunkJobType type;         // What to do
+    Chunk* chunk;              // Chunk to fill or write
+} ChunkJob;
+
+/**
+ * @brief Fixed-capacity job ring buffer
+ */
+typedef struct {
+    ChunkJob jobs[CHUNK_QUEUE_CAPACITY]; // Job storage
+    int head;                  // Index of oldest job
+    int count;                 // Number of queued jobs
+} ChunkJobQueue;
+
+/**
+ * @brief Chunk map structure
+ *
+ * The slot pool, hash table and streaming state belong to the main thread.
+ * The job queues are shared with the I/O thread and guarded by mutex.
+ */
+typedef struct {
+    Chunk* pool;               // Fixed pool of CHUNK_CACHE_CAPACITY chunks
+    Chunk** table;             // Open-addressing hash table of resident chunks
+    int tableCapacity;         // Number of hash table slots (power of two)
+    Chunk* lastChunk;          // Most recently looked-up chunk
+    int widthInChunks;         // World width in chunks
+    int heightInChunks;        // World height in chunks
+    char* directory;           // Directory holding chunk files
+    uint64_t seed;             // Seed for generating chunks with no file
+    int focusChunkX;           // Chunk X at the center of the stream radius
+    int focusChunkY;           // Chunk Y at the center of the stream radius
+    unsigned int tick;         // Streaming tick counter
+    int pendingJobs;           // Jobs submitted but not yet collected
+    ChunkJobQueue requests;    // Jobs waiting for the I/O thread
+    ChunkJobQueue completed;   // Jobs finished by the I/O thread
+    PlatformMutex* mutex;      // Guards both job queues and quit
+    PlatformCondition* workAvailable; // Signalled when a job is queued
+    PlatformCondition* workFinished;  // Signalled when a job completes
+    PlatformThread* thread;    // Background I/O thread
+    bool quit;                 // Tells the I/O thread to exit
+} ChunkMap;
+
+/**
+ * @brief Create a chunk map and start its I/O thread
+ *
+ * @param widthInChunks World width in chunks
+ * @param heightInChunks World height in chunks
+ * @param directory Directory holding chunk files
+ * @param seed Seed for generating chunks with no file
+ * @return ChunkMap* Pointer to the created chunk map or NULL if failed
+ */
+ChunkMap* ChunkMapCreate(int widthInChunks, int heightInChunks, const char* directory, uint64_t seed);
+
+/**
+ * @brief Stop the I/O thread, save edited chunks and free the chunk map
+ *
+ * @param map Pointer to chunk map
+ */
+void ChunkMapDestroy(ChunkMap* map);
+
+/**
+ * @brief Stream chunks around a focus point
+ *
+ * Collects finished jobs, requests missing chunks nearest-first and
+ * evicts the least recently used chunks outside the stream radius.
+ * Never blocks.
+ *
+ * @param map Pointer to chunk map
+ * @param tileX Focus X position in tiles
+ * @param tileY Focus Y position in tiles
+ */
+void ChunkMapUpdate(ChunkMap* map, int tileX, int tileY);
+
+/**
+ * @brief Stream chunks around a focus point and wait until they are loaded
+ *
+ * Used when entering the world or teleporting, so the first frame has
+ * tiles to collide with.
+ *
+ * @param map Pointer to chunk map
+ * @param tileX Focus X position in tiles
+ * @param tileY Focus Y position in tiles
+ */
+void ChunkMapPrefetch(ChunkMap* map, int tileX, int tileY);
+
+/**
+ * @brief Queue every edited chunk for saving
+ *
+ * @param map Pointer to chunk map
+ * @return int Number of chunks that could not be queued this call
+ */
+int ChunkMapFlush(ChunkMap* map);
+
+/**
+ * @brief Get tile type at position
+ *
+ * @param map Pointer to chunk map
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @return TileType Tile type (TILE_TYPE_WALL if out of bounds or not loaded)
+ */
+TileType ChunkMapGetTile(ChunkMap* map, int x, int y);
+
+/**
+ * @brief Set tile type at position
+ *
+ * @param map Pointer to chunk map
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @param type Tile type to set
+ * @return true Tile was set
+ * @return false Chunk is not loaded or is being saved
+ */
+bool ChunkMapSetTile(ChunkMap* map, int x, int y, TileType type);
+
+#endif // MESSY_GAME_CHUNK_H
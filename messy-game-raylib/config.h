@@ -13,19 +13,79 @@ tuning
 #define SCREEN_HEIGHT 960
 #define GAME_TITLE "Raylib Messy Game"
 #define TARGET_FPS 60
+// Simulation timing configuration
+#define SIM_FIXED_TIMESTEP (1.0f / 120.0f) // Seconds simulated per fixed step
+#define SIM_MAX_STEPS_PER_FRAME 8 // Steps run per frame before dropping time after a stall
+#ifndef SIM_FIXED_POINT
+#define SIM_FIXED_POINT 0 // 1 = simulate positions and velocities in Q16.16 fixed point (bit-identical across platforms)
+#endif
+// Random seed configuration
+#define GAME_DEFAULT_SEED 0x6D657373ULL // Seed for all gameplay random streams
+// Local multiplayer configuration
+#define MAX_LOCAL_PLAYERS 4 // Upper bound on players sharing one machine
+#define LOCAL_PLAYER_COUNT 1 // Players in a local game, each on their own gamepad
+#define LOCAL_PLAYER_SPACING 40.0f // Horizontal distance between local players at spawn
+// Network multiplayer configuration
+#define NET_DEFAULT_PORT 27960 // UDP port the server listens on
+#define NET_SNAPSHOT_RATE 20.0f // Snapshots sent to each client per second
+#define NET_TIMEOUT 5.0f // Seconds without packets before a peer is dropped
+#define NET_CONNECT_RETRY_INTERVAL 0.5f // Seconds between connection requests
+// Save game configuration
+#define QUICK_SAVE_PATH "quicksave.sav" // File written by quick-save
+#define QUICK_SAVE_KEY KEY_F5 // Key that writes the quick-save
+#define QUICK_LOAD_KEY KEY_F9 // Key that restores the quick-save
+// Batch match simulation configuration
+#define BATCH_SIM_MAX_MATCH_TIME 600.0f // Simulated seconds before an undecided match is called off
+#define BATCH_SIM_MAX_SWEEP_VALUES 256 // Upper bound on values in one parameter sweep
+#define BOT_REACTION_TIME 0.15f // Average seconds between a bot's decisions
+#define BOT_AIM_NOISE 6.0f // Largest sideways aim error of a bot in pixels
+#define BOT_APPROACH_DISTANCE 14.0f // Distance behind the ball a bot lines up at
+#define BOT_ALIGN_TOLERANCE 8.0f // Distance from the shot line at which a bot pushes
+#define BOT_MOVE_DEADZONE 2.0f // Distance to target below which a bot stops moving on an axis
 // World configuration
 #define WORLD_WIDTH 25  // Adjusted for 25x25 tiles
 #define WORLD_HEIGHT 40// Adjusted for 25x25 tiles
+// Open world streaming configuration
+#define OPEN_WORLD_ENABLED false // Use a streamed chunk world instead of the fixed arena
+#define OPEN_WORLD_WIDTH_CHUNKS 256 // Open world width in chunks
+#define OPEN_WORLD_HEIGHT_CHUNKS 256 // Open world height in chunks
+#define OPEN_WORLD_CHUNK_PATH "Assets/World" // Directory holding saved chunk files
+#define CHUNK_SIZE 32 // Chunk width and height in tiles
+#define CHUNK_STREAM_RADIUS 2 // Chunks kept loaded around the focus in each direction
+#define CHUNK_CACHE_CAPACITY 64 // Maximum resident chunks (fixed memory budget)
+#define CHUNK_QUEUE_CAPACITY 64 // Maximum pending chunk load/save requests
+#define CHUNK_SPAWN_CLEAR_RADIUS 8 // Tiles kept clear around the open world center
+// Room streaming configuration
+#define ROOM_STREAM_QUEUE_CAPACITY 16 // Most rooms being loaded in the background at once
+// Dungeon generation configuration
+#define DUNGEON_ENABLED false // Generate a room dungeon during the splash screen instead of the fixed arena
+#define DUNGEON_ROOM_COUNT 100 // Rooms in a generated dungeon, not counting secret rooms
+#define DUNGEON_CELL_SIZE 22 // Tiles per side of a dungeon grid cell (one room per cell)
+#define DUNGEON_ROOM_MIN_SIZE 13 // Smallest room side in tiles (room layouts need at least 13)
+#define DUNGEON_ROOM_MAX_SIZE 19 // Largest room side in tiles (below DUNGEON_CELL_SIZE)
+#define DUNGEON_TREASURE_ROOMS 2 // Treasure rooms per dungeon
+#define DUNGEON_SHOP_ROOMS 1 // Shop rooms per dungeon
+#define DUNGEON_SECRET_ROOMS 1 // Secret rooms per dungeon
+#define DUNGEON_LOOP_PERCENT 10 // Chance a new room touching several rooms is kept, with a door to each
 // Tile configuration
 #define TILE_WIDTH 25
 #define TILE_HEIGHT 25
 #define TILE_EMPTY 0
 #define TILE_WALL 1
 // Tile color configuration
-#define TILE_FLOOR_COLOR (Color){ 144, 238, 144, 255 } // Light green
-#define TILE_FLOOR_BORDER_COLOR (Color){ 0, 0, 0, 0 } // Transparent
-#define TILE_WALL_COLOR (Color){ 64, 64, 64, 255 } // Dark gray
-#define TILE_WALL_BORDER_COLOR (Color){ 0, 0, 0, 0 } // Transparent
+#define TILE_FLOOR_RGBA 144, 238, 144, 255 // Light green
+#define TILE_FLOOR_BORDER_RGBA 0, 0, 0, 0 // Transparent
+#define TILE_WALL_RGBA 64, 64, 64, 255 // Dark gray
+#define TILE_WALL_BORDER_RGBA 0, 0, 0, 0 // Transparent
+#define TILE_FLOOR_COLOR (Color){ TILE_FLOOR_RGBA }
+#define TILE_FLOOR_BORDER_COLOR (Color){ TILE_FLOOR_BORDER_RGBA }
+#define TILE_WALL_COLOR (Color){ TILE_WALL_RGBA }
+#define TILE_WALL_BORDER_COLOR (Color){ TILE_WALL_BORDER_RGBA }
+// Tile surface configuration
+#define TILE_ICE_FRICTION 0.1f // Friction multiplier on ice (below 1 slides further)
+#define TILE_WATER_FRICTION 1.5f // Friction multiplier in water (above 1 drags)
+#define TILE_WATER_DAMAGE_PER_SECOND 5.0f // Damage per second to a player in water
+#define TILE_LAVA_DAMAGE_PER_SECOND 25.0f // Damage per second to a player on lava
 // Sprite configuration
 #define SPRITE_WIDTH 25
 #define SPRITE_HEIGHT 25
@@ -49,13 +109,43 @@ tuning
 #define BALL_MAX_SPEED 8.0f
 #define BALL_BOUNCE_FACTOR 0.8f
 #define BALL_FRICTION 0.98f
+#define BALL_MAX_BOUNCES 4 // Wall contacts resolved per step before the ball stops for the step
+#define BALL_COLLISION_SKIN 0.01f // Gap left between the ball and a wall after a contact
+#define BALL_COUNT 1 // Balls in play at the start of a match (more than one makes a multi-ball match)
+#define BALL_POOL_CAPACITY 256 // Most balls alive at once (multi-ball levels included)
+#define BALL_GRID_CELL_SIZE 32.0f // Cell size in pixels of the grid used to find balls near a point
+#define BALL_SPAWN_SPACING 12.0f // Distance between balls spawned together
 #define PLAYER_PUSH_FORCE 5.0f
+// Physics solver configuration
+#define PHYSICS_DEFAULT_QUALITY PHYSICS_QUALITY_MEDIUM // Solver quality unless --physics-quality is given
+#define PHYSICS_LOW_SUB_STEPS 1 // Sub-steps per step at low quality
+#define PHYSICS_LOW_ITERATIONS 2 // Contact passes per sub-step at low quality
+#define PHYSICS_MEDIUM_SUB_STEPS 2 // Sub-steps per step at medium quality
+#define PHYSICS_MEDIUM_ITERATIONS 4 // Contact passes per sub-step at medium quality
+#define PHYSICS_HIGH_SUB_STEPS 4 // Sub-steps per step at high quality
+#define PHYSICS_HIGH_ITERATIONS 8 // Contact passes per sub-step at high quality
+#define PHYSICS_POSITION_SLOP 0.05f // Overlap in pixels left alone so resting contacts do not jitter
+#define PHYSICS_POSITION_CORRECTION 0.8f // Share of the remaining overlap removed per contact pass
+#define PHYSICS_TILE_SKIN 0.01f // Gap left between a body and a wall it was pushed out of
+#define PHYSICS_PLAYER_INVERSE_MASS 1.0f // 1 / player mass
+#define PHYSICS_BALL_INVERSE_MASS 4.0f // 1 / ball mass (a quarter of a player)
+#define PHYSICS_BROADPHASE_CELL_SIZE 32.0f // Broadphase cell size in pixels (about two players across)
+#define PHYSICS_BROADPHASE_MARGIN 2.0f // Padding on body bounds so pairs pushed together are still found
 // Asset paths
 #define TILEMAP_ASSET_PATH "Assets/Spritesheets/colored_tilemap_packed.PNG"
 #define PLAYER_ASSET_PATH "Assets/Spritesheets/sheet25x25.png"
 
 // Maximum number of different textures/assets
 #define MAX_TEXTURES 10 // Increased for future expansion
+// Asset loading configuration
+#define ASSET_LOADER_THREADS 2 // Worker threads decoding images in the background
+#define ASSET_UPLOAD_BUDGET 0.004 // Seconds per frame spent uploading textures to the GPU
+#define ASSET_CACHE_PATH "Assets/Cache" // Directory holding pre-baked texture blobs
+#define ASSET_CACHE_WRITE_ON_MISS true // Bake a blob whenever a texture had to be decoded
+// Hot reload configuration
+#define HOT_RELOAD_ENABLED true // Reload textures and levels when their files change
+#define HOT_RELOAD_POLL_INTERVAL 0.5f // Seconds between modification time checks without a file watcher
+#define HOT_RELOAD_SETTLE_TIME 0.1f // Seconds a file must be quiet before it is reloaded
 // Win condition hole configuration
 #define WIN_HOLE_RADIUS 15.0f // Increased for 25x25 scale
 #define WIN_HOLE_DEFAULT_X 1.0f // Position as percentage of room width (center)
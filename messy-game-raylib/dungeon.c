@@ -0,0 +1,504 @@
+/**
+ * @file dungeon.c
+ * @brief Implementation of procedural dungeon generation
+ */
+
+#include <stdlib.h>
+#include "dungeon.h"
+#include "world.h"
+#include "rng.h"
+
+#define DUNGEON_GROW_ATTEMPTS 64 // Placement tries per room before the grid counts as full
+#define DUNGEON_EMPTY_CELL -1    // Cell value for cells without a room
+
+/**
+ * @brief Side of a cell a room can grow from
+ */
+typedef struct {
+    ConnectionDirection direction; // Connection through the side
+    int stepX;                 // X cell step going out through the side
+    int stepY;                 // Y cell step going out through the side
+} DungeonSide;
+
+#define DUNGEON_SIDE_COUNT 4 // Sides in gDungeonSides (opposite sides are two apart)
+
+/**
+ * @brief Cell sides in clockwise order
+ */
+static const DungeonSide gDungeonSides[DUNGEON_SIDE_COUNT] = {
+    { CONNECTION_NORTH, 0, -1 },
+    { CONNECTION_EAST, 1, 0 },
+    { CONNECTION_SOUTH, 0, 1 },
+    { CONNECTION_WEST, -1, 0 },
+};
+
+/**
+ * @brief Generator working state
+ */
+typedef struct {
+    DungeonLayout* layout;     // Layout being filled
+    Rng rng;                   // Generator seeded from the layout seed
+    short cells[DUNGEON_GRID_SIZE * DUNGEON_GRID_SIZE]; // Room index per cell (DUNGEON_EMPTY_CELL if none)
+} DungeonGenerator;
+
+/**
+ * @brief Get the room in a cell
+ *
+ * @param generator Pointer to generator
+ * @param cellX Cell X position
+ * @param cellY Cell Y position
+ * @return int Room index, or DUNGEON_EMPTY_CELL if empty or outside the grid
+ */
+static int DungeonRoomAt(const DungeonGenerator* generator, int cellX, int cellY) {
+    if (cellX < 0 || cellX >= DUNGEON_GRID_SIZE || cellY < 0 || cellY >= DUNGEON_GRID_SIZE) {
+        return DUNGEON_EMPTY_CELL;
+    }
+
+    return generator->cells[cellY * DUNGEON_GRID_SIZE + cellX];
+}
+
+/**
+ * @brief Check whether a room can be placed in a cell
+ *
+ * @param generator Pointer to generator
+ * @param cellX Cell X position
+ * @param cellY Cell Y position
+ * @return bool Whether the cell is inside the grid and empty
+ */
+static bool DungeonIsCellFree(const DungeonGenerator* generator, int cellX, int cellY) {
+    if (cellX < 0 || cellX >= DUNGEON_GRID_SIZE || cellY < 0 || cellY >= DUNGEON_GRID_SIZE) return false;
+
+    return generator->cells[cellY * DUNGEON_GRID_SIZE + cellX] == DUNGEON_EMPTY_CELL;
+}
+
+/**
+ * @brief Count the rooms next to a cell
+ *
+ * @param generator Pointer to generator
+ * @param cellX Cell X position
+ * @param cellY Cell Y position
+ * @return int Number of occupied neighbouring cells
+ */
+static int DungeonCountNeighbours(const DungeonGenerator* generator, int cellX, int cellY) {
+    int count = 0;
+    for (int i = 0; i < DUNGEON_SIDE_COUNT; i++) {
+        if (DungeonRoomAt(generator, cellX + gDungeonSides[i].stepX, cellY + gDungeonSides[i].stepY) != DUNGEON_EMPTY_CELL) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Count the doors of a room
+ *
+ * @param room Pointer to room
+ * @return int Number of connections
+ */
+static int DungeonCountDoors(const DungeonRoom* room) {
+    int count = 0;
+    for (int i = 0; i < DUNGEON_SIDE_COUNT; i++) {
+        if (room->connections & gDungeonSides[i].direction) count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Place a normal room in an empty cell
+ *
+ * @param generator Pointer to generator
+ * @param cellX Cell X position
+ * @param cellY Cell Y position
+ * @param depth Doors between the room and the start room
+ * @return int Index of the new room
+ */
+static int DungeonAddRoom(DungeonGenerator* generator, int cellX, int cellY, int depth) {
+    DungeonLayout* layout = generator->layout;
+    int index = layout->roomCount++;
+
+    DungeonRoom* room = &layout->rooms[index];
+    room->cellX = cellX;
+    room->cellY = cellY;
+    room->x = 0;
+    room->y = 0;
+    room->width = RngRange(&generator->rng, DUNGEON_ROOM_MIN_SIZE, DUNGEON_ROOM_MAX_SIZE);
+    room->height = RngRange(&generator->rng, DUNGEON_ROOM_MIN_SIZE, DUNGEON_ROOM_MAX_SIZE);
+    room->type = ROOM_TYPE_NORMAL;
+    room->depth = depth;
+    room->connections = CONNECTION_NONE;
+
+    generator->cells[cellY * DUNGEON_GRID_SIZE + cellX] = (short)index;
+    return index;
+}
+
+/**
+ * @brief Put a door between a room and the room on one of its sides
+ *
+ * @param layout Pointer to layout
+ * @param fromRoom Index of room
+ * @param sideIndex Index into gDungeonSides of the side toRoom is on
+ * @param toRoom Index of neighbouring room
+ */
+static void DungeonConnect(DungeonLayout* layout, int fromRoom, int sideIndex, int toRoom) {
+    if (layout->connectionCount >= DUNGEON_MAX_CONNECTIONS) return;
+
+    const DungeonSide* side = &gDungeonSides[sideIndex];
+    const DungeonSide* opposite = &gDungeonSides[(sideIndex + DUNGEON_SIDE_COUNT / 2) % DUNGEON_SIDE_COUNT];
+
+    DungeonConnection* connection = &layout->connections[layout->connectionCount++];
+    connection->fromRoom = fromRoom;
+    connection->toRoom = toRoom;
+    connection->direction = side->direction;
+
+    layout->rooms[fromRoom].connections |= side->direction;
+    layout->rooms[toRoom].connections |= opposite->direction;
+}
+
+/**
+ * @brief Grow the room graph out from the start room
+ *
+ * Each step applies one rule of the grammar: attach a new room to a free
+ * side of a random room already placed. New rooms may only touch their
+ * parent, which keeps branches apart and leaves dead ends, except that
+ * now and then a room may close a loop with a door to every room it
+ * touches. The rule is relaxed once half the attempts are used up.
+ *
+ * @param generator Pointer to generator
+ * @param roomCount Rooms wanted in total
+ */
+static void DungeonGrow(DungeonGenerator* generator, int roomCount) {
+    DungeonLayout* layout = generator->layout;
+    int attempts = roomCount * DUNGEON_GROW_ATTEMPTS;
+
+    for (int attempt = 0; attempt < attempts && layout->roomCount < roomCount; attempt++) {
+        int parent = RngRange(&generator->rng, 0, layout->roomCount - 1);
+        int sideIndex = RngRange(&generator->rng, 0, DUNGEON_SIDE_COUNT - 1);
+        const DungeonSide* side = &gDungeonSides[sideIndex];
+
+        int cellX = layout->rooms[parent].cellX + side->stepX;
+        int cellY = layout->rooms[parent].cellY + side->stepY;
+        if (!DungeonIsCellFree(generator, cellX, cellY)) continue;
+
+        int neighbours = DungeonCountNeighbours(generator, cellX, cellY);
+        bool closesLoop = neighbours > 1 && RngRange(&generator->rng, 0, 99) < DUNGEON_LOOP_PERCENT;
+        if (attempt < attempts / 2 && neighbours > 1 && !closesLoop) continue;
+
+        int room = DungeonAddRoom(generator, cellX, cellY, layout->rooms[parent].depth + 1);
+        DungeonConnect(layout, parent, sideIndex, room);
+
+        if (!closesLoop) continue;
+        for (int i = 0; i < DUNGEON_SIDE_COUNT; i++) {
+            int next = DungeonRoomAt(generator, cellX + gDungeonSides[i].stepX, cellY + gDungeonSides[i].stepY);
+            if (next != DUNGEON_EMPTY_CELL && next != parent) {
+                DungeonConnect(layout, room, i, next);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Give a room a special type
+ *
+ * Takes a random dead end from the list if any are left, or else a
+ * random normal room other than the start room.
+ *
+ * @param generator Pointer to generator
+ * @param deadEnds Dead end room indices; taken ones are moved to the front
+ * @param firstFree Pointer to index of the first dead end not yet taken
+ * @param deadEndCount Number of dead ends
+ * @param type Type to give the room
+ */
+static void DungeonAssignRoom(DungeonGenerator* generator, int* deadEnds, int* firstFree, int deadEndCount, RoomType type) {
+    DungeonLayout* layout = generator->layout;
+
+    if (*firstFree < deadEndCount) {
+        int pick = RngRange(&generator->rng, *firstFree, deadEndCount - 1);
+        int room = deadEnds[pick];
+        deadEnds[pick] = deadEnds[*firstFree];
+        deadEnds[*firstFree] = room;
+        (*firstFree)++;
+
+        layout->rooms[room].type = type;
+        return;
+    }
+
+    // Not enough dead ends: settle for a room along the way
+    for (int attempt = 0; attempt < layout->roomCount; attempt++) {
+        int room = RngRange(&generator->rng, 0, layout->roomCount - 1);
+        if (room != layout->startRoom && layout->rooms[room].type == ROOM_TYPE_NORMAL) {
+            layout->rooms[room].type = type;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Choose the boss, treasure and shop rooms
+ *
+ * The boss gets the dead end furthest from the start and the largest
+ * room size; treasure and shops go in other dead ends.
+ *
+ * @param generator Pointer to generator
+ */
+static void DungeonAssignTypes(DungeonGenerator* generator) {
+    DungeonLayout* layout = generator->layout;
+
+    // Dead ends, deepest first (ties keep placement order)
+    int deadEnds[DUNGEON_MAX_ROOMS];
+    int deadEndCount = 0;
+    for (int i = 0; i < layout->roomCount; i++) {
+        if (i == layout->startRoom || DungeonCountDoors(&layout->rooms[i]) != 1) continue;
+
+        int slot = deadEndCount++;
+        while (slot > 0 && layout->rooms[deadEnds[slot - 1]].depth < layout->rooms[i].depth) {
+            deadEnds[slot] = deadEnds[slot - 1];
+            slot--;
+        }
+        deadEnds[slot] = i;
+    }
+
+    if (layout->roomCount < 2) return;
+
+    layout->bossRoom = deadEndCount > 0 ? deadEnds[0] : layout->roomCount - 1;
+    DungeonRoom* boss = &layout->rooms[layout->bossRoom];
+    boss->type = ROOM_TYPE_BOSS;
+    boss->width = DUNGEON_ROOM_MAX_SIZE;
+    boss->height = DUNGEON_ROOM_MAX_SIZE;
+
+    int firstFree = deadEndCount > 0 ? 1 : 0;
+    for (int i = 0; i < DUNGEON_TREASURE_ROOMS; i++) {
+        DungeonAssignRoom(generator, deadEnds, &firstFree, deadEndCount, ROOM_TYPE_TREASURE);
+    }
+    for (int i = 0; i < DUNGEON_SHOP_ROOMS; i++) {
+        DungeonAssignRoom(generator, deadEnds, &firstFree, deadEndCount, ROOM_TYPE_SHOP);
+    }
+}
+
+/**
+ * @brief Tuck secret rooms into empty cells walled in by other rooms
+ *
+ * The empty cell with the most normal neighbours wins; the secret room
+ * gets one door, to the shallowest of them.
+ *
+ * @param generator Pointer to generator
+ */
+static void DungeonAddSecretRooms(DungeonGenerator* generator) {
+    DungeonLayout* layout = generator->layout;
+
+    for (int secret = 0; secret < DUNGEON_SECRET_ROOMS && layout->roomCount < DUNGEON_MAX_ROOMS; secret++) {
+        int bestX = -1, bestY = -1, bestSide = -1;
+        int bestScore = 0;
+
+        for (int cellY = 0; cellY < DUNGEON_GRID_SIZE; cellY++) {
+            for (int cellX = 0; cellX < DUNGEON_GRID_SIZE; cellX++) {
+                if (!DungeonIsCellFree(generator, cellX, cellY)) continue;
+
+                int score = 0;
+                int side = -1;
+                int shallowest = DUNGEON_EMPTY_CELL;
+                for (int i = 0; i < DUNGEON_SIDE_COUNT; i++) {
+                    int next = DungeonRoomAt(generator, cellX + gDungeonSides[i].stepX, cellY + gDungeonSides[i].stepY);
+                    if (next == DUNGEON_EMPTY_CELL || layout->rooms[next].type != ROOM_TYPE_NORMAL) continue;
+
+                    score++;
+                    if (shallowest == DUNGEON_EMPTY_CELL || layout->rooms[next].depth < layout->rooms[shallowest].depth) {
+                        shallowest = next;
+                        side = i;
+                    }
+                }
+
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestX = cellX;
+                    bestY = cellY;
+                    bestSide = side;
+                }
+            }
+        }
+
+        if (bestSide < 0) return;
+
+        const DungeonSide* side = &gDungeonSides[bestSide];
+        int neighbour = DungeonRoomAt(generator, bestX + side->stepX, bestY + side->stepY);
+        int room = DungeonAddRoom(generator, bestX, bestY, layout->rooms[neighbour].depth + 1);
+        layout->rooms[room].type = ROOM_TYPE_SECRET;
+        layout->rooms[room].width = DUNGEON_ROOM_MIN_SIZE;
+        layout->rooms[room].height = DUNGEON_ROOM_MIN_SIZE;
+        DungeonConnect(layout, neighbour, (bestSide + DUNGEON_SIDE_COUNT / 2) % DUNGEON_SIDE_COUNT, room);
+    }
+}
+
+/**
+ * @brief Turn cells into tile positions and size the world to fit
+ *
+ * Rooms are centered in their cells, and the world covers only the
+ * cells in use.
+ *
+ * @param layout Pointer to layout
+ */
+static void DungeonFitBounds(DungeonLayout* layout) {
+    int minX = DUNGEON_GRID_SIZE, minY = DUNGEON_GRID_SIZE;
+    int maxX = 0, maxY = 0;
+    for (int i = 0; i < layout->roomCount; i++) {
+        const DungeonRoom* room = &layout->rooms[i];
+        if (room->cellX < minX) minX = room->cellX;
+        if (room->cellY < minY) minY = room->cellY;
+        if (room->cellX > maxX) maxX = room->cellX;
+        if (room->cellY > maxY) maxY = room->cellY;
+    }
+
+    for (int i = 0; i < layout->roomCount; i++) {
+        DungeonRoom* room = &layout->rooms[i];
+        room->x = (room->cellX - minX) * DUNGEON_CELL_SIZE + (DUNGEON_CELL_SIZE - room->width) / 2;
+        room->y = (room->cellY - minY) * DUNGEON_CELL_SIZE + (DUNGEON_CELL_SIZE - room->height) / 2;
+    }
+
+    layout->width = (maxX - minX + 1) * DUNGEON_CELL_SIZE;
+    layout->height = (maxY - minY + 1) * DUNGEON_CELL_SIZE;
+}
+
+/**
+ * @brief Generate a dungeon layout
+ *
+ * @param layout Pointer to layout to fill
+ * @param seed Seed value
+ * @param roomCount Rooms to place before secret rooms are added
+ * @return true If the layout was generated
+ * @return false If the arguments are invalid
+ */
+bool DungeonGenerate(DungeonLayout* layout, uint64_t seed, int roomCount) {
+    if (!layout || roomCount <= 0) return false;
+
+    if (roomCount > DUNGEON_MAX_ROOMS - DUNGEON_SECRET_ROOMS) {
+        TraceLog(LOG_WARNING, "Dungeon room count %d too large, using %d", roomCount, DUNGEON_MAX_ROOMS - DUNGEON_SECRET_ROOMS);
+        roomCount = DUNGEON_MAX_ROOMS - DUNGEON_SECRET_ROOMS;
+    }
+
+    DungeonGenerator generator;
+    generator.layout = layout;
+    RngSeed(&generator.rng, seed, RNG_STREAM_WORLD);
+    for (int i = 0; i < DUNGEON_GRID_SIZE * DUNGEON_GRID_SIZE; i++) {
+        generator.cells[i] = DUNGEON_EMPTY_CELL;
+    }
+
+    layout->seed = seed;
+    layout->roomCount = 0;
+    layout->connectionCount = 0;
+    layout->bossRoom = -1;
+    layout->startRoom = DungeonAddRoom(&generator, DUNGEON_GRID_SIZE / 2, DUNGEON_GRID_SIZE / 2, 0);
+
+    DungeonGrow(&generator, roomCount);
+    if (layout->roomCount < roomCount) {
+        TraceLog(LOG_WARNING, "Dungeon grid full, placed %d of %d rooms", layout->roomCount, roomCount);
+    }
+
+    DungeonAssignTypes(&generator);
+    DungeonAddSecretRooms(&generator);
+    DungeonFitBounds(layout);
+
+    return true;
+}
+
+/**
+ * @brief Worker thread entry point
+ *
+ * @param userData Pointer to builder
+ */
+static void DungeonBuilderWorkerMain(void* userData) {
+    DungeonBuilder* builder = (DungeonBuilder*)userData;
+
+    double startTime = GetTime();
+    World* world = NULL;
+    if (DungeonGenerate(&builder->layout, builder->layout.seed, builder->roomCount)) {
+        double generatedTime = GetTime();
+        world = WorldCreateDungeon(&builder->layout);
+
+        TraceLog(LOG_INFO, "Generated %d room dungeon in %.2f ms, built world in %.2f ms",
+            builder->layout.roomCount, (generatedTime - startTime) * 1000.0, (GetTime() - generatedTime) * 1000.0);
+    }
+
+    PlatformMutexLock(builder->mutex);
+    builder->world = world;
+    builder->finished = true;
+    PlatformMutexUnlock(builder->mutex);
+}
+
+/**
+ * @brief Start generating and building a dungeon on a worker thread
+ *
+ * @param seed Seed value
+ * @param roomCount Rooms to place before secret rooms are added
+ * @return DungeonBuilder* Pointer to the created builder or NULL if failed
+ */
+DungeonBuilder* DungeonBuilderCreate(uint64_t seed, int roomCount) {
+    DungeonBuilder* builder = (DungeonBuilder*)calloc(1, sizeof(DungeonBuilder));
+    if (!builder) {
+        TraceLog(LOG_ERROR, "Failed to allocate dungeon builder");
+        return NULL;
+    }
+
+    builder->layout.seed = seed;
+    builder->roomCount = roomCount;
+    builder->mutex = PlatformMutexCreate();
+    if (!builder->mutex) {
+        TraceLog(LOG_ERROR, "Failed to allocate dungeon builder lock");
+        DungeonBuilderDestroy(builder);
+        return NULL;
+    }
+
+    builder->thread = PlatformThreadCreate(DungeonBuilderWorkerMain, builder);
+    if (!builder->thread) {
+        TraceLog(LOG_ERROR, "Failed to start dungeon builder thread");
+        DungeonBuilderDestroy(builder);
+        return NULL;
+    }
+
+    return builder;
+}
+
+/**
+ * @brief Wait for the worker and free the builder
+ *
+ * @param builder Pointer to builder
+ */
+void DungeonBuilderDestroy(DungeonBuilder* builder) {
+    if (!builder) return;
+
+    WorldDestroy(DungeonBuilderTakeWorld(builder));
+    PlatformMutexDestroy(builder->mutex);
+    free(builder);
+}
+
+/**
+ * @brief Check whether the dungeon is ready to take
+ *
+ * @param builder Pointer to builder
+ * @return bool Whether the worker is done
+ */
+bool DungeonBuilderIsFinished(DungeonBuilder* builder) {
+    if (!builder) return true;
+
+    PlatformMutexLock(builder->mutex);
+    bool finished = builder->finished;
+    PlatformMutexUnlock(builder->mutex);
+    return finished;
+}
+
+/**
+ * @brief Wait for the worker and take ownership of the built world
+ *
+ * @param builder Pointer to builder
+ * @return struct World* The built world, or NULL if building failed
+ */
+struct World* DungeonBuilderTakeWorld(DungeonBuilder* builder) {
+    if (!builder) return NULL;
+
+    if (builder->thread) {
+        PlatformThreadJoin(builder->thread);
+        builder->thread = NULL;
+    }
+
+    World* world = builder->world;
+    builder->world = NULL;
+    return world;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file dungeon.h
+ * @brief Seeded procedural dungeon generation
+ *
+ * This file defines the dungeon generator. A dungeon is grown on a grid of
+ * cells, one room per cell, by repeatedly attaching a new room to a free
+ * side of a room already placed. Dead ends become the boss, treasure and
+ * shop rooms, a few extra doors close loops, and secret rooms are tucked
+ * into empty cells walled in by several rooms. The same seed always gives
+ * the same dungeon.
+ *
+ * Generation only fills a plain layout; a builder runs it, and builds the
+ * world from it, on a worker thread while the splash screen is up.
+ */
+#ifndef MESSY_GAME_DUNGEON_H
+#define MESSY_GAME_DUNGEON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "room.h"
+#include "platform.h"
+
+#define DUNGEON_MAX_ROOMS 256           // Most rooms in a dungeon, secret rooms included
+#define DUNGEON_MAX_CONNECTIONS (DUNGEON_MAX_ROOMS * 2) // Most two-way connections in a dungeon
+#define DUNGEON_GRID_SIZE 32            // Cells per side of the placement grid
+
+struct World;
+
+/**
+ * @brief Generated room
+ */
+typedef struct {
+    int cellX;                 // Cell X position in the placement grid
+    int cellY;                 // Cell Y position in the placement grid
+    int x;                     // Room X position in world grid
+    int y;                     // Room Y position in world grid
+    int width;                 // Width of room in tiles
+    int height;                // Height of room in tiles
+    RoomType type;             // Type of room
+    int depth;                 // Doors between this room and the start room
+    unsigned int connections;  // Bitfield of ConnectionDirection
+} DungeonRoom;
+
+/**
+ * @brief Generated two-way connection
+ */
+typedef struct {
+    int fromRoom;              // Index of room the door is in
+    int toRoom;                // Index of room on the other side
+    ConnectionDirection direction; // Side of fromRoom the door is on
+} DungeonConnection;
+
+/**
+ * @brief Generated dungeon layout
+ *
+ * Plain data, so it can be filled on any thread.
+ */
+typedef struct {
+    uint64_t seed;             // Seed the layout was generated from
+    int width;                 // World width in tiles
+    int height;                // World height in tiles
+    int startRoom;             // Index of the room the player starts in
+    int bossRoom;              // Index of the boss room (-1 if none)
+    DungeonRoom rooms[DUNGEON_MAX_ROOMS]; // Room storage
+    int roomCount;             // Number of rooms
+    DungeonConnection connections[DUNGEON_MAX_CONNECTIONS]; // Connection storage
+    int connectionCount;       // Number of connections
+} DungeonLayout;
+
+/**
+ * @brief Background dungeon builder
+ *
+ * The layout and world belong to the worker until finished is set;
+ * finished is guarded by mutex.
+ */
+typedef struct {
+    DungeonLayout layout;      // Layout being generated
+    int roomCount;             // Rooms asked for
+    struct World* world;       // Built world (NULL until finished, or if building failed)
+    PlatformMutex* mutex;      // Guards finished
+    PlatformThread* thread;    // Worker generating and building the dungeon
+    bool finished;             // Whether the worker is done
+} DungeonBuilder;
+
+/**
+ * @brief Generate a dungeon layout
+ *
+ * Deterministic: the same seed and room count give the same layout on
+ * every platform.
+ *
+ * @param layout Pointer to layout to fill
+ * @param seed Seed value
+ * @param roomCount Rooms to place before secret rooms are added
+ * @return true If the layout was generated
+ * @return false If the arguments are invalid
+ */
+bool DungeonGenerate(DungeonLayout* layout, uint64_t seed, int roomCount);
+
+/**
+ * @brief Start generating and building a dungeon on a worker thread
+ *
+ * @param seed Seed value
+ * @param roomCount Rooms to place before secret rooms are added
+ * @return DungeonBuilder* Pointer to the created builder or NULL if failed
+ */
+DungeonBuilder* DungeonBuilderCreate(uint64_t seed, int roomCount);
+
+/**
+ * @brief Wait for the worker and free the builder
+ *
+ * Also destroys the world if it was never taken.
+ *
+ * @param builder Pointer to builder
+ */
+void DungeonBuilderDestroy(DungeonBuilder* builder);
+
+/**
+ * @brief Check whether the dungeon is ready to take
+ *
+ * @param builder Pointer to builder
+ * @return bool Whether the worker is done
+ */
+bool DungeonBuilderIsFinished(DungeonBuilder* builder);
+
+/**
+ * @brief Wait for the worker and take ownership of the built world
+ *
+ * @param builder Pointer to builder
+ * @return struct World* The built world, or NULL if building failed
+ */
+struct World* DungeonBuilderTakeWorld(DungeonBuilder* builder);
+
+#endif // MESSY_GAME_DUNGEON_H
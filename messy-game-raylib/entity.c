@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "entity.h"
+#include "fixed.h"
 
  /**
   * @brief Initialize a new entity
@@ -34,6 +35,8 @@ Entity* EntityCreate(EntityType type, float x, float y, float width, float heigh
     entity->active = true;
     entity->facing = DIRECTION_DOWN;
     entity->tint = WHITE;
+    entity->tileX = -1;
+    entity->tileY = -1;
     entity->typeData = NULL;
 
     return entity;
@@ -70,8 +73,8 @@ void EntityUpdate(Entity* entity, float deltaTime) {
     if (!entity || !entity->active) return;
 
     // Apply current speed to position
-    entity->x += entity->speedX;
-    entity->y += entity->speedY;
+    entity->x = SimRealToFloat(SimRealFromFloat(entity->x) + SimRealFromFloat(entity->speedX));
+    entity->y = SimRealToFloat(SimRealFromFloat(entity->y) + SimRealFromFloat(entity->speedY));
 
     // Update facing direction based on movement
     if (fabs(entity->speedX) > fabs(entity->speedY)) {
@@ -220,21 +223,19 @@ bool EntityMoveWithCollision(
 Vector2 EntityDirectionTo(Entity* a, Entity* b) {
     if (!a || !b) return (Vector2) { 0, 0 };
 
-    Vector2 direction = {
-        b->x - a->x,
-        b->y - a->y
-    };
+    SimReal dx = SimRealFromFloat(b->x) - SimRealFromFloat(a->x);
+    SimReal dy = SimRealFromFloat(b->y) - SimRealFromFloat(a->y);
 
     // Calculate magnitude
-    float magnitude = sqrtf(direction.x * direction.x + direction.y * direction.y);
+    SimReal magnitude = SimRealLength(dx, dy);
 
     // Normalize if magnitude is not zero
     if (magnitude > 0) {
-        direction.x /= magnitude;
-        direction.y /= magnitude;
+        dx = SimRealDiv(dx, magnitude);
+        dy = SimRealDiv(dy, magnitude);
     }
 
-    return direction;
+    return (Vector2) { SimRealToFloat(dx), SimRealToFloat(dy) };
 }
 
 /**
@@ -247,8 +248,8 @@ Vector2 EntityDirectionTo(Entity* a, Entity* b) {
 float EntityDistanceTo(Entity* a, Entity* b) {
     if (!a || !b) return 0.0f;
 
-    float dx = b->x - a->x;
-    float dy = b->y - a->y;
+    SimReal dx = SimRealFromFloat(b->x) - SimRealFromFloat(a->x);
+    SimReal dy = SimRealFromFloat(b->y) - SimRealFromFloat(a->y);
 
-    return sqrtf(dx * dx + dy * dy);
+    return SimRealToFloat(SimRealLength(dx, dy));
 }
\ No newline at end of file
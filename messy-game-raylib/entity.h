@@ -57,6 +57,8 @@ typedef struct {
     bool active;           // Whether entity is active
     Direction facing;      // Direction entity is facing
     Color tint;            // Color tint for rendering
+    int tileX;             // Tile column under the center at the last surface sample (-1 = none yet)
+    int tileY;             // Tile row under the center at the last surface sample (-1 = none yet)
     void* typeData;        // Pointer to type-specific data
 } Entity;
 
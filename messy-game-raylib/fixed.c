@@ -0,0 +1,132 @@
+/**
+ * @file fixed.c
+ * @brief Implementation of Q16.16 fixed-point math
+ */
+
+#include "fixed.h"
+
+/**
+ * @brief Clamp a 64-bit intermediate to the fixed-point range
+ *
+ * @param value Intermediate value
+ * @return Fixed Saturated value
+ */
+static Fixed FixedSaturate(int64_t value) {
+    if (value > FIXED_MAX) return FIXED_MAX;
+    if (value < FIXED_MIN) return FIXED_MIN;
+    return (Fixed)value;
+}
+
+/**
+ * @brief Convert a float to fixed point
+ *
+ * Scaling by a power of two is exact, so only the final truncation
+ * rounds.
+ *
+ * @param value Float value
+ * @return Fixed Fixed-point value
+ */
+Fixed FixedFromFloat(float value) {
+    float scaled = value * (float)FIXED_ONE;
+    if (scaled >= 2147483648.0f) return FIXED_MAX;
+    if (scaled <= -2147483648.0f) return FIXED_MIN;
+    if (scaled != scaled) return 0; // NaN
+    return (Fixed)scaled;
+}
+
+/**
+ * @brief Convert fixed point to a float
+ *
+ * @param value Fixed-point value
+ * @return float Nearest float
+ */
+float FixedToFloat(Fixed value) {
+    return (float)value / (float)FIXED_ONE;
+}
+
+/**
+ * @brief Multiply two fixed-point numbers
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @return Fixed Product, rounded toward negative infinity and saturated
+ */
+Fixed FixedMul(Fixed a, Fixed b) {
+    int64_t product = (int64_t)a * (int64_t)b;
+
+    // Floor division rather than >>, whose result on negatives is implementation-defined
+    int64_t quotient = product / FIXED_ONE;
+    if (product % FIXED_ONE < 0) quotient--;
+
+    return FixedSaturate(quotient);
+}
+
+/**
+ * @brief Divide two fixed-point numbers
+ *
+ * @param a Dividend
+ * @param b Divisor
+ * @return Fixed Quotient, rounded toward zero and saturated (0 if b is 0)
+ */
+Fixed FixedDiv(Fixed a, Fixed b) {
+    if (b == 0) return 0;
+    return FixedSaturate(((int64_t)a * FIXED_ONE) / b);
+}
+
+/**
+ * @brief Integer square root
+ *
+ * Bit-by-bit method: one shift, compare and subtract per result bit.
+ *
+ * @param value Value
+ * @return uint32_t Largest integer whose square is at most value
+ */
+uint32_t FixedIntSqrt(uint64_t value) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)result;
+}
+
+/**
+ * @brief Square root of a fixed-point number
+ *
+ * sqrt(v / 2^16) * 2^16 == sqrt(v * 2^16), so the integer root of the
+ * value shifted up by 16 bits is already in fixed point.
+ *
+ * @param value Fixed-point value
+ * @return Fixed Square root rounded down (0 for negative values)
+ */
+Fixed FixedSqrt(Fixed value) {
+    if (value <= 0) return 0;
+    return (Fixed)FixedIntSqrt((uint64_t)value << FIXED_SHIFT);
+}
+
+/**
+ * @brief Length of a vector
+ *
+ * The sum of squares is in Q32.32, whose integer root is in Q16.16.
+ *
+ * @param x X component
+ * @param y Y component
+ * @return Fixed Length rounded down (saturated)
+ */
+Fixed FixedLength(Fixed x, Fixed y) {
+    uint64_t sum = (uint64_t)((int64_t)x * x) + (uint64_t)((int64_t)y * y);
+    return FixedSaturate(FixedIntSqrt(sum));
+}
@@ -0,0 +1,140 @@
+/**
+ * @file fixed.h
+ * @brief Q16.16 fixed-point math for the simulation
+ *
+ * This file defines a 32-bit fixed-point number with 16 fractional bits
+ * and the arithmetic the simulation needs, including an integer square
+ * root. Integer arithmetic gives the same bits on every compiler and CPU,
+ * which float arithmetic does not (contraction into FMA, x87 excess
+ * precision, fast-math flags), so lockstep peers and replay validation
+ * agree without exchanging state.
+ *
+ * SimReal is the scalar the simulation computes with: Fixed when
+ * SIM_FIXED_POINT is enabled, float otherwise. Entities still store
+ * floats; simulation code loads them with SimRealFromFloat, computes in
+ * SimReal and stores the result with SimRealToFloat. Both conversions are
+ * exact or correctly rounded, so they are deterministic too.
+ *
+ * Q16.16 only holds values in [-32768, 32768), so a fixed-point world must
+ * fit in FIXED_MAX_INT pixels on each axis. The arena and generated
+ * dungeons do; the open world does not, and is rejected at compile time.
+ */
+#ifndef MESSY_GAME_FIXED_H
+#define MESSY_GAME_FIXED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "config.h"
+
+#define FIXED_SHIFT 16                  // Number of fractional bits
+#define FIXED_ONE (1 << FIXED_SHIFT)    // 1.0 in fixed point
+#define FIXED_MAX INT32_MAX             // Largest value (about 32768.0)
+#define FIXED_MIN INT32_MIN             // Smallest value (-32768.0)
+#define FIXED_MAX_INT 32767             // Largest integer SimRealFromInt can convert
+
+/**
+ * @brief Q16.16 fixed-point number
+ */
+typedef int32_t Fixed;
+
+/**
+ * @brief Convert a float to fixed point
+ *
+ * Rounds toward zero and saturates out-of-range values.
+ *
+ * @param value Float value
+ * @return Fixed Fixed-point value
+ */
+Fixed FixedFromFloat(float value);
+
+/**
+ * @brief Convert fixed point to a float
+ *
+ * @param value Fixed-point value
+ * @return float Nearest float
+ */
+float FixedToFloat(Fixed value);
+
+/**
+ * @brief Multiply two fixed-point numbers
+ *
+ * @param a First factor
+ * @param b Second factor
+ * @return Fixed Product, rounded toward negative infinity and saturated
+ */
+Fixed FixedMul(Fixed a, Fixed b);
+
+/**
+ * @brief Divide two fixed-point numbers
+ *
+ * @param a Dividend
+ * @param b Divisor
+ * @return Fixed Quotient, rounded toward zero and saturated (0 if b is 0)
+ */
+Fixed FixedDiv(Fixed a, Fixed b);
+
+/**
+ * @brief Square root of a fixed-point number
+ *
+ * @param value Fixed-point value
+ * @return Fixed Square root rounded down (0 for negative values)
+ */
+Fixed FixedSqrt(Fixed value);
+
+/**
+ * @brief Length of a vector
+ *
+ * The squares are summed in 64 bits, so the length of any vector whose
+ * components fit in Fixed is computed without overflow.
+ *
+ * @param x X component
+ * @param y Y component
+ * @return Fixed Length rounded down (saturated)
+ */
+Fixed FixedLength(Fixed x, Fixed y);
+
+/**
+ * @brief Integer square root
+ *
+ * @param value Value
+ * @return uint32_t Largest integer whose square is at most value
+ */
+uint32_t FixedIntSqrt(uint64_t value);
+
+// The open world is OPEN_WORLD_WIDTH_CHUNKS * CHUNK_SIZE * TILE_WIDTH pixels
+// wide (204800 by default), far past the fixed-point range
+#if SIM_FIXED_POINT && OPEN_WORLD_ENABLED && \
+    (OPEN_WORLD_WIDTH_CHUNKS * CHUNK_SIZE * TILE_WIDTH > FIXED_MAX_INT || \
+     OPEN_WORLD_HEIGHT_CHUNKS * CHUNK_SIZE * TILE_HEIGHT > FIXED_MAX_INT)
+#error "The open world is too large for Q16.16 positions; disable SIM_FIXED_POINT or OPEN_WORLD_ENABLED"
+#endif
+
+// Simulation scalar and its operations
+#if SIM_FIXED_POINT
+typedef Fixed SimReal;
+#define SimRealFromFloat(value) FixedFromFloat(value)
+#define SimRealFromInt(value) ((Fixed)(value) * FIXED_ONE)
+#define SimRealFromFixed(value) (value)
+#define SimRealToFloat(value) FixedToFloat(value)
+#define SimRealToInt(value) ((int)((value) / FIXED_ONE))
+#define SimRealMul(a, b) FixedMul((a), (b))
+#define SimRealDiv(a, b) FixedDiv((a), (b))
+#define SimRealAbs(value) ((value) < 0 ? -(value) : (value))
+#define SimRealLength(x, y) FixedLength((x), (y))
+#define SimRealSqrt(value) FixedSqrt(value)
+#else
+typedef float SimReal;
+#define SimRealFromFloat(value) ((float)(value))
+#define SimRealFromInt(value) ((float)(value))
+#define SimRealFromFixed(value) FixedToFloat(value)
+#define SimRealToFloat(value) (value)
+#define SimRealToInt(value) ((int)(value))
+#define SimRealMul(a, b) ((a) * (b))
+#define SimRealDiv(a, b) ((a) / (b))
+#define SimRealAbs(value) fabsf(value)
+#define SimRealLength(x, y) sqrtf((x) * (x) + (y) * (y))
+#define SimRealSqrt(value) sqrtf(value)
+#endif
+
+#endif // MESSY_GAME_FIXED_H
@@ -8,18 +8,19 @@
 #include "game.h"
 #include "config.h"
 #include "snake_boss.h"
+#include "net.h"
+#include "sim_state.h"
 
- /**
-  * @brief Create a new game instance
-  *
-  * Allocates and initializes the game structure.
-  *
-  * @param screenWidth Width of the game screen
-  * @param screenHeight Height of the game screen
-  * @return Game* Pointer to the created game, or NULL if failed
-  */
-Game* GameCreate(int screenWidth, int screenHeight) {
-    Game* game = (Game*)malloc(sizeof(Game));
+/**
+ * @brief Allocate a game with its simulation systems
+ *
+ * Creates the input manager and entity list; the presentation systems are
+ * left NULL for the caller.
+ *
+ * @return Game* Pointer to the allocated game, or NULL if failed
+ */
+static Game* GameAllocate(void) {
+    Game* game = (Game*)calloc(1, sizeof(Game));
     if (!game) {
         TraceLog(LOG_ERROR, "Failed to allocate memory for game");
         return NULL;
@@ -29,41 +30,19 @@ Game* GameCreate(int screenWidth, int screenHeight) {
     game->state = GAME_STATE_NONE;
     game->prevState = GAME_STATE_NONE;
     game->isRunning = false;
+    game->headless = false;
     game->gameTime = 0.0f;
     game->deltaTime = 0.0f;
     game->fps = 0;
-
-    // Initialize subsystems
-    game->textures = TextureManagerCreate(MAX_TEXTURES);
-    if (!game->textures) {
-        TraceLog(LOG_ERROR, "Failed to create texture manager");
-        free(game);
-        return NULL;
-    }
-
-    game->renderer = RendererCreate(screenWidth, screenHeight, game->textures);
-    if (!game->renderer) {
-        TraceLog(LOG_ERROR, "Failed to create renderer");
-        TextureManagerDestroy(game->textures);
-        free(game);
-        return NULL;
-    }
-
-    game->camera = CameraCreate(screenWidth, screenHeight, 5.0f);
-    if (!game->camera) {
-        TraceLog(LOG_ERROR, "Failed to create camera");
-        RendererDestroy(game->renderer);
-        TextureManagerDestroy(game->textures);
-        free(game);
-        return NULL;
-    }
+    game->seed = GAME_DEFAULT_SEED;
+    GameTuningDefaults(&game->tuning);
+    PhysicsSolverInit(&game->physics, PHYSICS_DEFAULT_QUALITY);
+    SurfaceSamplerBegin(&game->surfaces);
+    TileEventQueueClear(&game->tileEvents);
 
     game->input = InputManagerCreate(20); // Initial capacity for 20 bindings
     if (!game->input) {
         TraceLog(LOG_ERROR, "Failed to create input manager");
-        CameraDestroy(game->camera);
-        RendererDestroy(game->renderer);
-        TextureManagerDestroy(game->textures);
         free(game);
         return NULL;
     }
@@ -74,17 +53,36 @@ Game* GameCreate(int screenWidth, int screenHeight) {
     if (!game->entities) {
         TraceLog(LOG_ERROR, "Failed to allocate entity array");
         InputManagerDestroy(game->input);
-        CameraDestroy(game->camera);
-        RendererDestroy(game->renderer);
-        TextureManagerDestroy(game->textures);
+        free(game);
+        return NULL;
+    }
+
+    game->balls = BallPoolCreate(BALL_POOL_CAPACITY);
+    if (!game->balls) {
+        TraceLog(LOG_ERROR, "Failed to create ball pool");
+        free(game->entities);
+        InputManagerDestroy(game->input);
         free(game);
         return NULL;
     }
 
     game->entityCount = 0;
     game->player = NULL;
-    game->ball = NULL;
+    for (int i = 0; i < MAX_LOCAL_PLAYERS; i++) {
+        game->players[i] = NULL;
+        game->playerInputs[i] = NULL;
+    }
+    game->playerInputs[0] = game->input;
+    game->playerCount = 0;
     game->world = NULL;
+    game->textures = NULL;
+    game->renderer = NULL;
+    game->camera = NULL;
+    game->assetLoader = NULL;
+    game->hotReloader = NULL;
+    game->net = NULL;
+    game->levelId = -1;
+    game->simulationTime = 0.0;
 
     // Initialize win condition pointer to NULL
     game->winCondition = NULL;
@@ -92,6 +90,44 @@ Game* GameCreate(int screenWidth, int screenHeight) {
     return game;
 }
 
+ /**
+  * @brief Create a new game instance
+  *
+  * Allocates and initializes the game structure.
+  *
+  * @param screenWidth Width of the game screen
+  * @param screenHeight Height of the game screen
+  * @return Game* Pointer to the created game, or NULL if failed
+  */
+Game* GameCreate(int screenWidth, int screenHeight) {
+    Game* game = GameAllocate();
+    if (!game) return NULL;
+
+    // Initialize subsystems
+    game->textures = TextureManagerCreate(MAX_TEXTURES);
+    if (!game->textures) {
+        TraceLog(LOG_ERROR, "Failed to create texture manager");
+        GameDestroy(game);
+        return NULL;
+    }
+
+    game->renderer = RendererCreate(screenWidth, screenHeight, game->textures);
+    if (!game->renderer) {
+        TraceLog(LOG_ERROR, "Failed to create renderer");
+        GameDestroy(game);
+        return NULL;
+    }
+
+    game->camera = CameraCreate(screenWidth, screenHeight, 5.0f);
+    if (!game->camera) {
+        TraceLog(LOG_ERROR, "Failed to create camera");
+        GameDestroy(game);
+        return NULL;
+    }
+
+    return game;
+}
+
 /**
  * @brief Destroy game and free resources
  *
@@ -100,18 +136,29 @@ Game* GameCreate(int screenWidth, int screenHeight) {
 void GameDestroy(Game* game) {
     if (!game) return;
 
-    // Free all entities
+    // Free all entities (balls are freed with their pool)
     for (int i = 0; i < game->entityCount; i++) {
+        if (game->entities[i]->type == ENTITY_BALL) continue;
         EntityDestroy(game->entities[i]);
     }
     free(game->entities);
+    BallPoolDestroy(game->balls);
 
     // Free world if it exists
     if (game->world) {
         WorldDestroy(game->world);
     }
 
-    // Free subsystems
+    // Stop any asset loading before the texture manager goes away
+    AssetLoaderDestroy(game->assetLoader);
+    DungeonBuilderDestroy(game->dungeonBuilder);
+    HotReloaderDestroy(game->hotReloader);
+    NetSessionDestroy(game->net);
+
+    // Free subsystems (local player 0 uses game->input)
+    for (int i = 1; i < MAX_LOCAL_PLAYERS; i++) {
+        InputManagerDestroy(game->playerInputs[i]);
+    }
     InputManagerDestroy(game->input);
     CameraDestroy(game->camera);
     RendererDestroy(game->renderer);
@@ -127,46 +174,55 @@ void GameDestroy(Game* game) {
 }
 
 /**
-* @brief Initialize game systems
-*
-* This function initializes all game subsystems and loads initial assets.
-*
-* @param game Pointer to game
-* @return bool Whether initialization was successful
-*/
-bool GameInitialize(Game* game) {
-    if (!game) return false;
-
-    // Initialize audio device
-    InitAudioDevice();
-
-    game->input = InputManagerCreate(20);
-    if (!game->input) {
-        TraceLog(LOG_ERROR, "Failed to create input manager");
-        return false;
+ * @brief Create the win condition for the current world
+ *
+ * Replaces any existing win condition and applies the game's seed and
+ * tuning to the new one.
+ *
+ * @param game Pointer to game
+ */
+static void GameCreateWinCondition(Game* game) {
+    if (game->winCondition) {
+        WinConditionDestroy(game->winCondition);
     }
 
-    // Load default input bindings
-    InputManagerLoadDefaultBindings(game->input);
+    game->winCondition = InitializeWinCondition(game->world, game->camera);
+    if (!game->winCondition) return;
 
-    // Load textures
-    if (!TextureManagerLoadGameAssets(game->textures)) {
-        TraceLog(LOG_ERROR, "Failed to load game assets");
-        return false;
+    WinConditionSeed(game->winCondition, game->seed);
+    game->winCondition->segmentsPerGoal = game->tuning.winSegmentsPerGoal;
+    game->winCondition->enemyDamageToPlayer = game->tuning.winEnemyDamageToPlayer;
+}
+
+/**
+ * @brief Create the world, win condition, players, balls and snake boss
+ *
+ * @param game Pointer to game
+ * @param playerCount Number of players to create
+ * @return bool Whether the match was set up
+ */
+static bool GameSetupMatch(Game* game, int playerCount) {
+    // Create world (headless games always use the arena, since streamed
+    // chunks would be shared on disk between simulations)
+    if (OPEN_WORLD_ENABLED && !game->headless) {
+        game->world = WorldCreateOpen(OPEN_WORLD_WIDTH_CHUNKS, OPEN_WORLD_HEIGHT_CHUNKS, OPEN_WORLD_CHUNK_PATH, game->seed);
+    }
+    else {
+        game->world = WorldCreate(WORLD_WIDTH, WORLD_HEIGHT);
     }
 
-    // Create world
-    game->world = WorldCreate(WORLD_WIDTH, WORLD_HEIGHT);
     if (!game->world) {
         TraceLog(LOG_ERROR, "Failed to create world");
         return false;
     }
 
-    // Initialize world with basic layout
-    InitializeWorldLayout(game->world, game->camera);
+    // Initialize world with basic layout (open worlds generate their own)
+    if (!game->world->isOpenWorld) {
+        InitializeWorldLayout(game->world, game->camera);
+    }
 
     // Initialize win condition
-    game->winCondition = InitializeWinCondition(game->world, game->camera);
+    GameCreateWinCondition(game);
     if (!game->winCondition) {
         TraceLog(LOG_WARNING, "Failed to create win condition, game will continue without it");
         // Continue anyway, win condition is not critical
@@ -179,13 +235,25 @@ bool GameInitialize(Game* game) {
         return false;
     }
 
+    // Create the other local players
+    for (int i = 1; i < playerCount && i < MAX_LOCAL_PLAYERS; i++) {
+        if (!GameAddLocalPlayer(game, PLAYER_TYPE_KNIGHT)) {
+            TraceLog(LOG_WARNING, "Failed to add local player %d", i);
+            break;
+        }
+    }
+
     // Create ball
-    game->ball = GameSetBall(game, BALL_TYPE_NORMAL);
-    if (!game->ball) {
+    if (!GameSetBall(game, BALL_TYPE_NORMAL)) {
         TraceLog(LOG_ERROR, "Failed to create ball");
         return false;
     }
 
+    // Multi-ball matches add the rest around the first
+    if (game->tuning.ballCount > 1 && !GameSetBallCount(game, game->tuning.ballCount)) {
+        TraceLog(LOG_WARNING, "Only %d of %d balls could be added", game->balls->count, game->tuning.ballCount);
+    }
+
     // Create snake boss - adjusted for 25x25 tiles
     int centerX = game->world->width / 2;
     int centerY = game->world->height / 2;
@@ -195,11 +263,110 @@ bool GameInitialize(Game* game) {
         // Continue anyway, snake boss is not critical
     }
 
+    return true;
+}
+
+/**
+ * @brief Create a game that only runs the simulation
+ *
+ * @param seed Gameplay random seed
+ * @param tuning Balancing parameters, or NULL for the config values
+ * @param playerCount Number of players (1 to MAX_LOCAL_PLAYERS)
+ * @return Game* Pointer to created game, or NULL if failed
+ */
+Game* GameCreateHeadless(uint64_t seed, const GameTuning* tuning, int playerCount) {
+    Game* game = GameAllocate();
+    if (!game) return NULL;
+
+    game->headless = true;
+    game->seed = seed;
+    if (tuning) {
+        game->tuning = *tuning;
+    }
+
+    if (!GameSetupMatch(game, playerCount)) {
+        TraceLog(LOG_ERROR, "Failed to set up headless match");
+        GameDestroy(game);
+        return NULL;
+    }
+
+    GameChangeState(game, GAME_STATE_PLAYING);
+    game->isRunning = true;
+    return game;
+}
+
+/**
+* @brief Initialize game systems
+*
+* This function initializes all game subsystems and loads initial assets.
+*
+* @param game Pointer to game
+* @return bool Whether initialization was successful
+*/
+bool GameInitialize(Game* game) {
+    if (!game) return false;
+
+    // Initialize audio device
+    InitAudioDevice();
+
+    // Bake the tile overlays while no frame is being drawn
+    RendererBakeTileOverlays(game->renderer);
+
+    // Replace the input manager from GameCreate rather than leak it
+    InputManagerDestroy(game->input);
+    game->input = InputManagerCreate(20);
+    game->playerInputs[0] = game->input;
+    if (!game->input) {
+        TraceLog(LOG_ERROR, "Failed to create input manager");
+        return false;
+    }
+
+    // Load default input bindings
+    InputManagerLoadPlayerBindings(game->input, 0, LOCAL_PLAYER_COUNT);
+
+    // Start decoding textures in the background; the splash screen
+    // uploads them and shows progress while the rest of init runs
+    game->assetLoader = AssetLoaderCreate(ASSET_LOADER_THREADS);
+    if (!game->assetLoader || !AssetLoaderQueueGameAssets(game->assetLoader)) {
+        TraceLog(LOG_ERROR, "Failed to start loading game assets");
+        return false;
+    }
+
+    // Watch the texture files so edits show up without a restart
+    if (HOT_RELOAD_ENABLED) {
+        game->hotReloader = HotReloaderCreate();
+
+        const TextureAssetDesc* assets = NULL;
+        int assetCount = TextureManagerGetGameAssets(&assets);
+        for (int i = 0; i < assetCount; i++) {
+            HotReloaderWatchTexture(
+                game->hotReloader,
+                assets[i].id,
+                assets[i].filePath,
+                assets[i].tileWidth,
+                assets[i].tileHeight
+            );
+        }
+    }
+
+    // Create the world and everything in it
+    if (!GameSetupMatch(game, LOCAL_PLAYER_COUNT)) {
+        return false;
+    }
+
+    // Generate the dungeon alongside the assets; the arena stands in until it is built
+    if (DUNGEON_ENABLED && !OPEN_WORLD_ENABLED) {
+        game->dungeonBuilder = DungeonBuilderCreate(game->seed, DUNGEON_ROOM_COUNT);
+        if (!game->dungeonBuilder) {
+            TraceLog(LOG_WARNING, "Failed to start dungeon generation, playing in the arena");
+        }
+    }
+
     // Set camera to follow player
     CameraFollowTarget(game->camera, game->player);
 
-    // Set initial game state
-    GameChangeState(game, GAME_STATE_PLAYING);
+    // Show the splash screen until assets are loaded
+    GameChangeState(game, GAME_STATE_SPLASH);
 
     // Game is now running
     game->isRunning = true;
@@ -229,74 +396,542 @@ void GameRun(Game* game) {
 }
 
 /**
-* @brief Initialize world layout
-*
-* Helper function to set up the initial world layout with
-* walls and obstacles.
-*
-* @param world Pointer to world
-* @param camera Pointer to camera
-*/
-void InitializeWorldLayout(World* world, GameCamera* camera) {
-    if (!world) return;
+* @brief Initialize world layout
+*
+* Helper function to set up the initial world layout with
+* walls and obstacles.
+*
+* @param world Pointer to world
+* @param camera Pointer to camera
+*/
+void InitializeWorldLayout(World* world, GameCamera* camera) {
+    if (!world) return;
+
+    // Initialize all tiles as empty
+    for (int x = 0; x < world->width; x++) {
+        for (int y = 0; y < world->height; y++) {
+            WorldSetTileType(world, x, y, TILE_TYPE_EMPTY);
+        }
+    }
+
+    // Define the visible area based on camera properties
+    float cameraZoom = CAMERA_ZOOM;
+    int screenWidthInTiles = (int)(SCREEN_WIDTH / (TILE_WIDTH * cameraZoom));
+    int screenHeightInTiles = (int)(SCREEN_HEIGHT / (TILE_HEIGHT * cameraZoom));
+
+    // Calculate the visible portion of the world (matches the room drawn by WorldCreate)
+    int centerX = world->width / 2;
+    int centerY = world->height / 2;
+    int leftEdge = centerX - (screenWidthInTiles / 2);
+    int rightEdge = centerX + (screenWidthInTiles / 2) - 1;
+    int topEdge = centerY - (screenHeightInTiles / 2) - 1;
+    int bottomEdge = centerY + (screenHeightInTiles / 2);
+
+    TraceLog(LOG_INFO, "Visible area: left=%d, right=%d, top=%d, bottom=%d",
+        leftEdge, rightEdge, topEdge, bottomEdge);
+
+    // Create walls at the VISIBLE borders
+    for (int i = leftEdge; i <= rightEdge; i++) {
+        WorldSetTileType(world, i, topEdge, TILE_TYPE_WALL);
+        WorldSetTileType(world, i, bottomEdge, TILE_TYPE_WALL);
+    }
+
+    for (int j = topEdge; j <= bottomEdge; j++) {
+        WorldSetTileType(world, leftEdge, j, TILE_TYPE_WALL);
+        WorldSetTileType(world, rightEdge, j, TILE_TYPE_WALL);
+    }
+
+    // Add some walls in the middle for obstacles
+    // Small horizontal wall - scale appropriately for 25x25 tiles
+    for (int i = centerX - 2; i <= centerX + 2; i++) {
+        WorldSetTileType(world, i, centerY, TILE_TYPE_WALL);
+    }
+
+    // Small vertical walls - scale appropriately for 25x25 tiles
+    for (int j = centerY - 1; j <= centerY + 1; j++) {
+        WorldSetTileType(world, centerX + 4, j, TILE_TYPE_WALL);
+        WorldSetTileType(world, centerX - 4, j, TILE_TYPE_WALL);
+    }
+
+    // Set up camera
+    if (camera) {
+        camera->camera.target = (Vector2){ (float)(centerX * TILE_WIDTH), (float)(centerY * TILE_HEIGHT) };
+        camera->camera.zoom = CAMERA_ZOOM;
+    }
+}
+
+/**
+ * @brief Replace the world and set up the match in it
+ *
+ * Spawns the new world's snake bosses and balls, creates its win
+ * condition and puts everyone back on their spawn points.
+ *
+ * @param game Pointer to game
+ * @param world World to play in (the game takes ownership)
+ */
+static void GameUseWorld(Game* game, World* world) {
+    WorldDestroy(game->world);
+    game->world = world;
+
+    // Replace the previous level's snake bosses with this level's spawns
+    for (int i = game->entityCount - 1; i >= 0; i--) {
+        Entity* entity = game->entities[i];
+        if (IsSnakeBoss(entity)) {
+            GameDestroyEntity(game, entity);
+        }
+    }
+
+    for (int i = 0; i < world->spawnCount; i++) {
+        const WorldSpawn* spawn = &world->spawns[i];
+        if (spawn->type == SPAWN_TYPE_SNAKE_BOSS) {
+            GameSetSnakeBoss(game, spawn->tileX, spawn->tileY, spawn->param > 0 ? spawn->param : 3);
+        }
+    }
+
+    // A ball spawn's parameter asks for that many balls at once
+    const WorldSpawn* ballSpawn = WorldFindSpawn(world, SPAWN_TYPE_BALL);
+    if (ballSpawn && ballSpawn->param > 0) {
+        GameSetBallCount(game, ballSpawn->param);
+    }
+
+    // Create a new win condition for the loaded level
+    GameCreateWinCondition(game);
+
+    // Reset player and ball positions
+    GameReset(game);
+}
+
+/**
+ * @brief Update asset loading during the splash screen
+ *
+ * Uploads decoded textures under the per-frame budget, swaps in the
+ * generated dungeon once it is built, and starts the game once
+ * everything is loaded.
+ *
+ * @param game Pointer to game
+ */
+static void GameUpdateLoading(Game* game) {
+    if (game->assetLoader) {
+        AssetLoaderUpdate(game->assetLoader, game->textures, ASSET_UPLOAD_BUDGET);
+        if (!AssetLoaderIsFinished(game->assetLoader)) return;
+
+        int failedCount = AssetLoaderGetFailedCount(game->assetLoader);
+        AssetLoaderDestroy(game->assetLoader);
+        game->assetLoader = NULL;
+
+        if (failedCount > 0) {
+            TraceLog(LOG_ERROR, "Failed to load %d game assets", failedCount);
+            game->isRunning = false;
+            return;
+        }
+
+        TraceLog(LOG_INFO, "Game assets loaded");
+    }
+
+    if (game->dungeonBuilder) {
+        if (!DungeonBuilderIsFinished(game->dungeonBuilder)) return;
+
+        World* world = DungeonBuilderTakeWorld(game->dungeonBuilder);
+        DungeonBuilderDestroy(game->dungeonBuilder);
+        game->dungeonBuilder = NULL;
+
+        if (world) {
+            GameUseWorld(game, world);
+        }
+        else {
+            TraceLog(LOG_WARNING, "Failed to generate dungeon, playing in the arena");
+        }
+    }
+
+    GameChangeState(game, GAME_STATE_PLAYING);
+}
+
+/**
+ * @brief Swap in a reloaded level file
+ *
+ * Only the world is replaced; entities, the win condition's state and
+ * the score carry over, so a designer can keep playing the same session.
+ *
+ * @param game Pointer to game
+ * @param filePath Path to level file
+ */
+static void GameReloadLevel(Game* game, const char* filePath) {
+    // Keep the current world if the edited file does not load
+    World* world = WorldLoad(filePath);
+    if (!world) {
+        TraceLog(LOG_WARNING, "Failed to reload level: %s", filePath);
+        return;
+    }
+
+    WorldDestroy(game->world);
+    game->world = world;
+
+    // Follow the hole if the level moved it
+    if (game->winCondition && world->holeRadius > 0.0f) {
+        game->winCondition->position = world->holePosition;
+        game->winCondition->radius = world->holeRadius;
+    }
+
+    TraceLog(LOG_INFO, "Reloaded level: %s", filePath);
+}
+
+/**
+ * @brief Quick-save or quick-load the simulation state
+ *
+ * Offline only: loading a save would put a network session out of step
+ * with its peers.
+ *
+ * @param game Pointer to game
+ */
+static void GameHandleQuickSave(Game* game) {
+    if (game->net) return;
+    if (game->state != GAME_STATE_PLAYING && game->state != GAME_STATE_PAUSED) return;
+
+    if (IsKeyPressed(QUICK_SAVE_KEY)) {
+        SimStateSaveFile(game, QUICK_SAVE_PATH);
+    }
+    else if (IsKeyPressed(QUICK_LOAD_KEY)) {
+        SimStateLoadFile(game, QUICK_SAVE_PATH);
+    }
+}
+
+/**
+ * @brief Reload asset files that changed on disk
+ *
+ * Runs at the start of an update, before anything of this frame has been
+ * drawn, so every system sees either the old or the new asset.
+ *
+ * @param game Pointer to game
+ */
+static void GameApplyHotReload(Game* game) {
+    if (!game->hotReloader) return;
+
+    HotReloaderUpdate(game->hotReloader, game->deltaTime);
+
+    HotReloadEntry* entry;
+    while ((entry = HotReloaderNextChange(game->hotReloader)) != NULL) {
+        switch (entry->type) {
+        case HOT_RELOAD_TEXTURE:
+            // Replaces the GPU texture only once the new one is uploaded
+            if (TextureManagerLoad(game->textures, (TextureID)entry->id, entry->filePath, entry->tileWidth, entry->tileHeight)) {
+                TraceLog(LOG_INFO, "Reloaded texture: %s", entry->filePath);
+            }
+            else {
+                TraceLog(LOG_WARNING, "Failed to reload texture: %s", entry->filePath);
+            }
+            break;
+
+        case HOT_RELOAD_LEVEL:
+            // Levels watched earlier may no longer be the one being played
+            if (entry->id == game->levelId) {
+                GameReloadLevel(game, entry->filePath);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Get the number of local player input managers in use
+ *
+ * @param game Pointer to game
+ * @return int Number of input managers (at least one for game->input)
+ */
+static int GameLocalInputCount(Game* game) {
+    return game->playerCount > 1 ? game->playerCount : 1;
+}
+
+/**
+ * @brief Check whether an entity is a local player
+ *
+ * @param game Pointer to game
+ * @param entity Entity to check
+ * @return bool Whether the entity is one of the local players
+ */
+static bool GameIsLocalPlayer(Game* game, Entity* entity) {
+    for (int i = 0; i < game->playerCount; i++) {
+        if (game->players[i] == entity) return true;
+    }
+
+    return entity == game->player;
+}
+
+/**
+ * @brief Check whether an entity is simulated this step
+ *
+ * Local players always are. Everything else sleeps while it is outside
+ * the current room and its neighbours.
+ *
+ * @param game Pointer to game
+ * @param entity Entity to check
+ * @return bool Whether the entity should be updated
+ */
+static bool GameIsEntityAwake(Game* game, Entity* entity) {
+    if (GameIsLocalPlayer(game, entity)) return true;
+
+    return WorldIsPositionActive(game->world, entity->x, entity->y);
+}
+
+/**
+ * @brief Add the players and balls to this step's physics solve
+ *
+ * Must run before they move, so the solve knows where they started.
+ *
+ * @param game Pointer to game
+ */
+static void GameBeginPhysics(Game* game) {
+    PhysicsSolverBegin(&game->physics);
+
+    for (int i = 0; i < game->playerCount; i++) {
+        Entity* player = game->players[i];
+        PlayerData* playerData = PlayerGetData(player);
+        if (!playerData || playerData->state != PLAYER_STATE_ALIVE) continue;
+
+        // Players keep only their center out of walls, as when they move
+        float radius = (player->width + player->height) / 4.0f;
+        PhysicsSolverAddEntity(&game->physics, player, radius, 0.0f, PHYSICS_LAYER_PLAYER);
+    }
+
+    for (int i = 0; i < game->balls->count; i++) {
+        Entity* ball = game->balls->balls[i];
+        BallData* ballData = BallGetData(ball);
+        if (!ballData || !ball->active || !GameIsEntityAwake(game, ball)) continue;
+
+        PhysicsBody* body = PhysicsSolverAddEntity(&game->physics, ball,
+            ballData->radius, ballData->radius, PHYSICS_LAYER_BALL);
+        if (body) {
+            body->restitution = SimRealFromFloat(ballData->bounceFactor);
+        }
+    }
+}
+
+/**
+ * @brief Give the players and balls the surface of the tile they are on
+ *
+ * Runs before they move, so this step's movement uses the friction of
+ * the tile it starts on. Tile damage is dealt here too, and entities
+ * that stepped onto a trigger or door queue a tile event.
+ *
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+static void GameSampleSurfaces(Game* game, float deltaTime) {
+    SurfaceSamplerBegin(&game->surfaces);
+
+    for (int i = 0; i < game->playerCount; i++) {
+        SurfaceSamplerAdd(&game->surfaces, game->players[i]);
+    }
+
+    for (int i = 0; i < game->balls->count; i++) {
+        Entity* ball = game->balls->balls[i];
+        if (ball->active && GameIsEntityAwake(game, ball)) {
+            SurfaceSamplerAdd(&game->surfaces, ball);
+        }
+    }
+
+    SurfaceSamplerSample(&game->surfaces, game->world);
+    SurfaceSamplerApply(&game->surfaces, deltaTime);
+    TileEventDetect(&game->tileEvents, &game->surfaces);
+}
+
+/**
+ * @brief Act on the tile events raised this step
+ *
+ * A player walking into a door takes every local player to the room
+ * behind it; anything entering a switch flips it.
+ *
+ * @param game Pointer to game
+ */
+static void GameHandleTileEvents(Game* game) {
+    TileEvent event;
+    while (TileEventQueuePop(&game->tileEvents, &event)) {
+        switch (event.type) {
+        case TILE_EVENT_TRANSITION: {
+            if (!GameIsLocalPlayer(game, event.entity)) break;
+
+            float arriveX = 0.0f, arriveY = 0.0f;
+            if (!WorldUseDoor(game->world, event.tileX, event.tileY, &arriveX, &arriveY)) break;
+
+            // Arrive together; the physics solve spreads the players out
+            for (int i = 0; i < game->playerCount; i++) {
+                Entity* player = game->players[i];
+                player->x = arriveX;
+                player->y = arriveY;
+                player->speedX = 0.0f;
+                player->speedY = 0.0f;
+                player->tileX = (int)(arriveX / TILE_WIDTH);
+                player->tileY = (int)(arriveY / TILE_HEIGHT);
+            }
+
+            // The rest were raised in the room just left
+            TileEventQueueClear(&game->tileEvents);
+            break;
+        }
+
+        case TILE_EVENT_TRIGGER:
+            WorldActivateTrigger(game->world, event.tileX, event.tileY);
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Find the first local player that is still alive
+ *
+ * @param game Pointer to game
+ * @return Entity* The player, or NULL if every local player is down
+ */
+static Entity* GameFirstLivingPlayer(Game* game) {
+    for (int i = 0; i < game->playerCount; i++) {
+        if (PlayerIsAlive(game->players[i])) return game->players[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bring a player whose death sequence has finished back into play
+ *
+ * The player rejoins beside a living teammate, or on top of them when
+ * the spot beside is a wall.
+ *
+ * @param game Pointer to game
+ * @param player Player to respawn
+ * @param leader Living player to rejoin beside
+ */
+static void GameRespawnPlayer(Game* game, Entity* player, Entity* leader) {
+    float x = leader->x + LOCAL_PLAYER_SPACING;
+    float y = leader->y;
+    if (WorldIsWallAtPosition(game->world, x, y)) {
+        x = leader->x;
+    }
+
+    PlayerReset(player, x, y);
+    player->tileX = (int)(x / TILE_WIDTH);
+    player->tileY = (int)(y / TILE_HEIGHT);
+    TraceLog(LOG_INFO, "Player respawned beside a teammate");
+}
+
+/**
+ * @brief Advance the simulation by one fixed step
+ *
+ * Reads the action states as they are; the caller advances them first.
+ * Touches no clocks or devices, so a step can be re-run from a restored
+ * state with recorded input.
+ *
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+void GameSimulationStep(Game* game, float deltaTime) {
+    if (!game) return;
 
-    // Initialize all tiles as empty
-    for (int x = 0; x < world->width; x++) {
-        for (int y = 0; y < world->height; y++) {
-            WorldSetTileType(world, x, y, TILE_TYPE_EMPTY);
+    // Handle game state transitions based on input
+    GameHandleEvents(game);
+
+    // Update entities based on current game state
+    if (game->state == GAME_STATE_PLAYING) {
+        // Advance the death sequence of every player that is down
+        bool deathFinished[MAX_LOCAL_PLAYERS] = { false };
+        bool anyDeathFinished = false;
+        for (int i = 0; i < game->playerCount; i++) {
+            if (PlayerIsAlive(game->players[i])) continue;
+            deathFinished[i] = PlayerHandleDeath(game->players[i], deltaTime);
+            anyDeathFinished = anyDeathFinished || deathFinished[i];
         }
-    }
 
-    // Define the visible area based on camera properties
-    float cameraZoom = CAMERA_ZOOM;
-    float screenWidthInTiles = (SCREEN_WIDTH / (TILE_WIDTH * cameraZoom));
-    float screenHeightInTiles = (SCREEN_HEIGHT / (TILE_HEIGHT * cameraZoom));
+        Entity* leader = GameFirstLivingPlayer(game);
+        if (!leader) {
+            // Everyone is down: hold the game until a death sequence completes, then restart
+            if (anyDeathFinished) {
+                GameReset(game);
+            }
+            return; // Skip the rest of the step
+        }
 
-    // Calculate the visible portion of the world
-    float centerX = world->width / 2;
-    float centerY = world->height / 2;
-    float leftEdge = centerX - (screenWidthInTiles / 2);
-    float rightEdge = centerX + (screenWidthInTiles / 2);
-    float topEdge = centerY - (screenHeightInTiles / 2);
-    float bottomEdge = centerY + (screenHeightInTiles / 2);
+        // Players whose death sequence is over rejoin beside a living player
+        for (int i = 0; i < game->playerCount; i++) {
+            if (deathFinished[i]) {
+                GameRespawnPlayer(game, game->players[i], leader);
+            }
+        }
 
-    TraceLog(LOG_INFO, "Visible area: left=%d, right=%d, top=%d, bottom=%d",
-        leftEdge, rightEdge, topEdge, bottomEdge);
+        // Stream open world chunks around a living player
+        WorldStreamAround(game->world, leader->x, leader->y);
 
-    // Create walls at the VISIBLE borders
-    for (int i = leftEdge; i <= rightEdge; i++) {
-        WorldSetTileType(world, i, topEdge, TILE_TYPE_WALL);
-        WorldSetTileType(world, i, bottomEdge, TILE_TYPE_WALL);
-    }
+        // Pick up friction, damage and events from the tiles underneath,
+        // going through doors before anything moves
+        GameSampleSurfaces(game, deltaTime);
+        GameHandleTileEvents(game);
 
-    for (int j = topEdge; j <= bottomEdge; j++) {
-        WorldSetTileType(world, leftEdge, j, TILE_TYPE_WALL);
-        WorldSetTileType(world, rightEdge, j, TILE_TYPE_WALL);
-    }
+        // Record where the players and balls start this step
+        GameBeginPhysics(game);
 
-    // Add some walls in the middle for obstacles
-    // Small horizontal wall - scale appropriately for 25x25 tiles
-    for (int i = centerX - 2; i <= centerX + 2; i++) {
-        WorldSetTileType(world, i, centerY, TILE_TYPE_WALL);
-    }
+        // Update the living players, each from their own input
+        for (int i = 0; i < game->playerCount; i++) {
+            if (PlayerIsAlive(game->players[i])) {
+                PlayerUpdate(game->players[i], game->world, deltaTime);
+            }
+        }
 
-    // Small vertical walls - scale appropriately for 25x25 tiles
-    for (int j = centerY - 1; j <= centerY + 1; j++) {
-        WorldSetTileType(world, centerX + 4, j, TILE_TYPE_WALL);
-        WorldSetTileType(world, centerX - 4, j, TILE_TYPE_WALL);
-    }
+        // Update balls, then index where they ended up
+        for (int i = 0; i < game->balls->count; i++) {
+            Entity* ball = game->balls->balls[i];
+            if (!GameIsEntityAwake(game, ball)) continue;
+            BallUpdate(ball, game->world, game->players, game->playerCount, deltaTime);
+        }
+        BallPoolBuildGrid(game->balls);
 
-    // Set up camera
-    if (camera) {
-        camera->camera.target = (Vector2){ (centerX * TILE_WIDTH), (centerY * TILE_HEIGHT) };
-        camera->camera.zoom = CAMERA_ZOOM;
+        // Update all other entities
+        for (int i = 0; i < game->entityCount; i++) {
+            Entity* entity = game->entities[i];
+            // Skip players and balls as they've already been updated
+            if (GameIsLocalPlayer(game, entity) || entity->type == ENTITY_BALL) continue;
+            if (!GameIsEntityAwake(game, entity)) continue;
+            EntityUpdate(entity, deltaTime);
+        }
+
+        // Update world
+        WorldUpdate(game->world, deltaTime);
+
+        // Update snake boss entities
+        for (int i = 0; i < game->entityCount; i++) {
+            Entity* entity = game->entities[i];
+            if (IsSnakeBoss(entity) && GameIsEntityAwake(game, entity)) {
+                // Update the snake boss
+                SnakeBossUpdate(entity, game->world, game->balls, game->players, game->playerCount, deltaTime);
+                SnakeBossAddPhysicsBodies(entity, &game->physics);
+            }
+        }
+
+        // Separate everything that ended up overlapping
+        PhysicsSolverSolve(&game->physics, game->world);
+        BallPoolBuildGrid(game->balls);
+
+        // Update win condition
+        if (game->winCondition) {
+            WinConditionUpdate(
+                game->winCondition,
+                game->balls,
+                game->players,
+                game->playerCount,
+                game->entities,
+                game->entityCount,
+                deltaTime
+            );
+        }
     }
 }
 
 /**
  * @brief Update game state
  *
- * Main game update function that updates all game systems and entities.
+ * Main game update function. Polls input, then runs as many fixed
+ * simulation steps as fit in the time since the last frame.
  *
  * @param game Pointer to game
  */
@@ -308,67 +943,59 @@ void GameUpdate(Game* game) {
     game->gameTime += game->deltaTime;
     game->fps = GetFPS();
 
-    // Update input system
-    InputManagerUpdate(game->input);
+    // Finish loading assets before gameplay starts
+    if (game->state == GAME_STATE_SPLASH) {
+        GameUpdateLoading(game);
+        return;
+    }
 
-    // Handle game state transitions based on input
-    GameHandleEvents(game);
+    // Pick up edited textures and levels between frames
+    GameApplyHotReload(game);
+    GameHandleQuickSave(game);
 
-    // Update entities based on current game state
-    if (game->state == GAME_STATE_PLAYING) {
-        // Check for player death first
-        if (game->player) {
-            PlayerData* playerData = PlayerGetData(game->player);
-            if (playerData && playerData->state != PLAYER_STATE_ALIVE) {
-                // Handle player death
-                if (PlayerHandleDeath(game->player, game->deltaTime)) {
-                    // Death sequence complete, reset the game
-                    GameReset(game);
-                    return; // Skip the rest of the update
-                }
-            }
-            else {
-                // Update player if alive
-                PlayerUpdate(game->player, game->world, game->deltaTime);
-
-                // Update ball
-                BallUpdate(game->ball, game->world, game->player, game->deltaTime);
-
-                // Update all other entities
-                for (int i = 0; i < game->entityCount; i++) {
-                    Entity* entity = game->entities[i];
-                    // Skip player and ball as they've already been updated
-                    if (entity == game->player || entity == game->ball) continue;
-                    EntityUpdate(entity, game->deltaTime);
-                }
-
-                // Update world
-                WorldUpdate(game->world, game->deltaTime);
-
-                // Update snake boss entities
-                for (int i = 0; i < game->entityCount; i++) {
-                    Entity* entity = game->entities[i];
-                    if (IsSnakeBoss(entity)) {
-                        // Update the snake boss
-                        SnakeBossUpdate(entity, game->world, game->ball, game->player, game->deltaTime);
-                    }
-                }
-
-                // Update win condition
-                if (game->winCondition) {
-                    WinConditionUpdate(
-                        game->winCondition,
-                        game->ball,
-                        game->player,
-                        game->entities,
-                        game->entityCount,
-                        game->deltaTime
-                    );
-                }
-            }
+    // Poll devices once for all local players, then turn each player's
+    // input changes since the last frame into timestamped events
+    InputPollDevices(&game->devices, game->playerInputs, GameLocalInputCount(game));
+    for (int i = 0; i < GameLocalInputCount(game); i++) {
+        InputManagerApplyDevices(game->playerInputs[i], &game->devices);
+    }
+
+    // The simulation clock starts with the first frame after loading
+    double now = GetTime();
+    if (game->simulationTime <= 0.0) {
+        game->simulationTime = now;
+    }
+
+    // Remote input and snapshots are taken in before the steps that use them
+    NetSessionReceive(game->net, game);
+
+    // Run the fixed steps that fit in the elapsed time
+    int steps = 0;
+    while (game->simulationTime + SIM_FIXED_TIMESTEP <= now && game->isRunning) {
+        if (steps >= SIM_MAX_STEPS_PER_FRAME) {
+            // Drop the rest after a stall instead of trying to catch up
+            game->simulationTime = now;
+            break;
+        }
+
+        // Consume the input events up to the end of the step first, so
+        // actions take effect in the step they happened in
+        game->simulationTime += SIM_FIXED_TIMESTEP;
+        for (int i = 0; i < GameLocalInputCount(game); i++) {
+            InputManagerAdvance(game->playerInputs[i], game->simulationTime);
+        }
+
+        if (game->net) {
+            NetSessionStep(game->net, game, SIM_FIXED_TIMESTEP);
+        }
+        else {
+            GameSimulationStep(game, SIM_FIXED_TIMESTEP);
         }
+        steps++;
     }
 
+    NetSessionSend(game->net, game);
+
     // Update camera last so it can follow updated entities
     CameraUpdate(game->camera, game->deltaTime);
 }
@@ -386,9 +1013,16 @@ void GameRender(Game* game) {
     // Begin drawing
     RendererBeginFrame(game->renderer);
 
-    // Check if player is dead and showing death screen
+    // Only the loading screen is shown while assets load
+    if (game->state == GAME_STATE_SPLASH) {
+        RendererDrawLoadingScreen(game->renderer, AssetLoaderGetProgress(game->assetLoader));
+        RendererEndFrame(game->renderer);
+        return;
+    }
+
+    // Show the death screen once every local player is down
     PlayerData* playerData = NULL;
-    if (game->player) {
+    if (game->player && !GameFirstLivingPlayer(game)) {
         playerData = PlayerGetData(game->player);
     }
 
@@ -401,17 +1035,17 @@ void GameRender(Game* game) {
         CameraBeginMode(game->camera);
 
         // Render world
-        WorldRender(game->world);
+        WorldRender(game->world, game->renderer, &game->camera->camera);
 
         // Debug visualization - call our new function
         if (DEBUG_SHOW_COLLISIONS) {
-            DebugVisualizeCollisions(game->world);
+            DebugVisualizeCollisions(game->world, &game->camera->camera);
         }
 
         // Render entities in proper order
         for (int i = 0; i < game->entityCount; i++) {
-            // Skip player and ball for now (they'll be rendered separately)
-            if (game->entities[i] == game->player || game->entities[i] == game->ball) continue;
+            // Skip players and balls for now (they'll be rendered separately)
+            if (GameIsLocalPlayer(game, game->entities[i]) || game->entities[i]->type == ENTITY_BALL) continue;
 
             // Special rendering for snake boss
             if (IsSnakeBoss(game->entities[i])) {
@@ -427,14 +1061,18 @@ void GameRender(Game* game) {
             WinConditionRender(game->winCondition);
         }
 
-        // Render ball
-        if (game->ball) {
-            BallRender(game->ball);
+        // Render balls
+        for (int i = 0; i < game->balls->count; i++) {
+            BallRender(game->balls->balls[i]);
+        }
+
+        // Render players on top, local player 0 last
+        for (int i = 1; i < game->playerCount; i++) {
+            PlayerRender(game->players[i], game->renderer);
         }
 
-        // Render player on top
         if (game->player) {
-            PlayerRender(game->player);
+            PlayerRender(game->player, game->renderer);
         }
 
         // End 2D camera mode
@@ -537,28 +1175,111 @@ void GameChangeState(Game* game, GameState newState) {
     }
 }
 
+/**
+ * @brief Get the player spawn point used when the level has none
+ *
+ * The center of the world, moved down past any solid tiles there (the
+ * built-in arena has a wall across its center).
+ *
+ * @param game Pointer to game
+ * @param x Pointer to store X position
+ * @param y Pointer to store Y position
+ */
+static void GameDefaultSpawn(Game* game, float* x, float* y) {
+    *x = (game->world->width * TILE_WIDTH) / 2.0f;
+    *y = (game->world->height * TILE_HEIGHT) / 2.0f;
+
+    // Open world chunks may not be loaded yet, so they all read as walls
+    if (game->world->isOpenWorld) return;
+
+    for (int i = 0; i < game->world->height && WorldIsWallAtPosition(game->world, *x, *y); i++) {
+        *y += TILE_HEIGHT;
+    }
+}
+
+/**
+ * @brief Line the balls up at the ball spawn point
+ *
+ * The first ball goes on the spawn point (or beside player 0 when the
+ * level has none) and the rest fill rings of spots around it, skipping
+ * spots inside walls.
+ *
+ * @param game Pointer to game
+ */
+static void GameResetBalls(Game* game) {
+    if (!game->player || game->balls->count == 0) return;
+
+    float originX = game->player->x + 20;
+    float originY = game->player->y + 20;
+    const WorldSpawn* spawn = WorldFindSpawn(game->world, SPAWN_TYPE_BALL);
+    if (spawn) {
+        originX = (spawn->tileX + 0.5f) * TILE_WIDTH;
+        originY = (spawn->tileY + 0.5f) * TILE_HEIGHT;
+    }
+
+    BallReset(game->balls->balls[0], originX, originY);
+
+    // Walk the rings outward, one spot per free position
+    int next = 1;
+    int maxRing = game->world->width * TILE_WIDTH / (int)BALL_SPAWN_SPACING;
+    for (int ring = 1; ring <= maxRing && next < game->balls->count; ring++) {
+        for (int dy = -ring; dy <= ring && next < game->balls->count; dy++) {
+            for (int dx = -ring; dx <= ring && next < game->balls->count; dx++) {
+                if (abs(dx) != ring && abs(dy) != ring) continue;
+
+                float x = originX + dx * BALL_SPAWN_SPACING;
+                float y = originY + dy * BALL_SPAWN_SPACING;
+                if (WorldIsWallAtPosition(game->world, x, y)) continue;
+
+                BallReset(game->balls->balls[next++], x, y);
+            }
+        }
+    }
+
+    // No free spots left: stack the rest on the spawn point
+    while (next < game->balls->count) {
+        BallReset(game->balls->balls[next++], originX, originY);
+    }
+}
+
 /**
  * @brief Reset game to initial state
  *
- * Resets player, ball, and other game elements to their initial state.
+ * Resets player, balls, and other game elements to their initial state.
  *
  * @param game Pointer to game
  */
 void GameReset(Game* game) {
     if (!game) return;
 
-    // Reset player position to center of world
+    // Reset player position to the level's spawn point, or center of world
     if (game->player) {
-        float centerX = (game->world->width * TILE_WIDTH) / 2.0f;
-        float centerY = (game->world->height * TILE_HEIGHT) / 2.0f;
-        PlayerReset(game->player, centerX, centerY);
-    }
+        float spawnX, spawnY;
+        GameDefaultSpawn(game, &spawnX, &spawnY);
+
+        const WorldSpawn* spawn = WorldFindSpawn(game->world, SPAWN_TYPE_PLAYER);
+        if (spawn) {
+            spawnX = (spawn->tileX + 0.5f) * TILE_WIDTH;
+            spawnY = (spawn->tileY + 0.5f) * TILE_HEIGHT;
+        }
 
-    // Reset ball position near player
-    if (game->ball && game->player) {
-        BallReset(game->ball, game->player->x + 20, game->player->y + 20);
+        PlayerReset(game->player, spawnX, spawnY);
+
+        // Room worlds restart in the room holding the spawn
+        int roomIndex = WorldFindRoomAtPosition(game->world, spawnX, spawnY);
+        if (roomIndex >= 0 && roomIndex != game->world->currentRoom) {
+            WorldChangeRoom(game->world, roomIndex);
+        }
+
+        // Line the other local players up beside player 0
+        for (int i = 1; i < game->playerCount; i++) {
+            PlayerReset(game->players[i], spawnX + i * LOCAL_PLAYER_SPACING, spawnY);
+        }
     }
 
+    // Reset ball positions to their spawn point, or near player
+    GameResetBalls(game);
+
     // Reset other game elements as needed
 
     // Set game state to playing
@@ -566,8 +1287,7 @@ void GameReset(Game* game) {
 
     // Reset win condition if it exists (reinitialize at center of world)
     if (game->winCondition) {
-        WinConditionDestroy(game->winCondition);
-        game->winCondition = InitializeWinCondition(game->world, game->camera);
+        GameCreateWinCondition(game);
     }
 }
 
@@ -633,13 +1353,26 @@ bool GameRemoveEntity(Game* game, Entity* entity) {
     // Decrease entity count
     game->entityCount--;
 
-    // Check if this was the player or ball
+    // Check if this was the player
     if (entity == game->player) game->player = NULL;
-    if (entity == game->ball) game->ball = NULL;
 
     return true;
 }
 
+/**
+ * @brief Apply the game's tuning to a new player
+ *
+ * @param game Pointer to game
+ * @param player Pointer to player entity
+ */
+static void GameApplyPlayerTuning(Game* game, Entity* player) {
+    PlayerData* playerData = PlayerGetData(player);
+    if (!playerData) return;
+
+    playerData->kickForce = game->tuning.playerKickForce;
+    playerData->xpPerHit = game->tuning.playerXpPerHit;
+}
+
 /**
  * @brief Set player for game
  *
@@ -653,14 +1386,15 @@ Entity* GameSetPlayer(Game* game, PlayerType playerType) {
     if (!game) return NULL;
 
     // Create new player at center of world
-    float centerX = (game->world->width * TILE_WIDTH) / 2.0f;
-    float centerY = (game->world->height * TILE_HEIGHT) / 2.0f;
+    float centerX, centerY;
+    GameDefaultSpawn(game, &centerX, &centerY);
 
     Entity* player = PlayerCreate(playerType, centerX, centerY);
     if (!player) {
         TraceLog(LOG_ERROR, "Failed to create player");
         return NULL;
     }
+    GameApplyPlayerTuning(game, player);
 
     // Remove old player if exists
     if (game->player) {
@@ -677,47 +1411,189 @@ Entity* GameSetPlayer(Game* game, PlayerType playerType) {
 
     // Set as current player
     game->player = player;
+    game->players[0] = player;
+    if (game->playerCount < 1) {
+        game->playerCount = 1;
+    }
+    PlayerSetInput(player, game->input);
 
     return player;
 }
 
 /**
- * @brief Set ball for game
+ * @brief Add another local player with their own input
  *
- * Creates a new ball entity or replaces the existing one.
+ * Every player's default bindings are reloaded, since the keyboard is
+ * split differently with more players.
  *
  * @param game Pointer to game
- * @param ballType Ball type
- * @return Entity* Pointer to ball entity
+ * @param playerType Player type
+ * @return Entity* Pointer to the new player, or NULL if failed
  */
-Entity* GameSetBall(Game* game, BallType ballType) {
-    if (!game || !game->player) return NULL;
+Entity* GameAddLocalPlayer(Game* game, PlayerType playerType) {
+    if (!game || !game->player || game->playerCount >= MAX_LOCAL_PLAYERS) return NULL;
 
-    // Create new ball near player
-    float ballX = game->player->x + 20;
-    float ballY = game->player->y + 20;
+    int index = game->playerCount;
+
+    InputManager* input = InputManagerCreate(20);
+    if (!input) {
+        TraceLog(LOG_ERROR, "Failed to create input manager for local player %d", index);
+        return NULL;
+    }
+
+    Entity* player = PlayerCreate(playerType, game->player->x + index * LOCAL_PLAYER_SPACING, game->player->y);
+    if (!player || !GameAddEntity(game, player)) {
+        TraceLog(LOG_ERROR, "Failed to create local player %d", index);
+        EntityDestroy(player);
+        InputManagerDestroy(input);
+        return NULL;
+    }
+
+    GameApplyPlayerTuning(game, player);
+    PlayerSetInput(player, input);
+    game->players[index] = player;
+    game->playerInputs[index] = input;
+    game->playerCount++;
+
+    for (int i = 0; i < game->playerCount; i++) {
+        InputManagerLoadPlayerBindings(game->playerInputs[i], i, game->playerCount);
+    }
+
+    TraceLog(LOG_INFO, "Local player %d joined", index);
+    return player;
+}
+
+/**
+ * @brief Run the simulation for network clients
+ *
+ * @param game Pointer to game
+ * @param port UDP port to listen on
+ * @return bool Whether the server started
+ */
+bool GameHostServer(Game* game, uint16_t port) {
+    if (!game || game->net) return false;
+
+    game->net = NetSessionCreateServer(port);
+    return game->net != NULL;
+}
+
+/**
+ * @brief Play on a network server
+ *
+ * Both sides must run the same level, so entity slots line up.
+ *
+ * @param game Pointer to game
+ * @param address Server host name or address, optionally with ":port"
+ * @return bool Whether the connection was started
+ */
+bool GameConnect(Game* game, const char* address) {
+    if (!game || game->net) return false;
+
+    game->net = NetSessionCreateClient(address);
+    return game->net != NULL;
+}
+
+/**
+ * @brief Add a ball to the game
+ *
+ * @param game Pointer to game
+ * @param ballType Ball type
+ * @param x Initial X position
+ * @param y Initial Y position
+ * @return Entity* Pointer to ball entity, or NULL if the ball pool is full
+ */
+Entity* GameAddBall(Game* game, BallType ballType, float x, float y) {
+    if (!game) return NULL;
 
-    Entity* ball = BallCreate(ballType, ballX, ballY);
+    Entity* ball = BallCreate(game->balls, ballType, x, y);
     if (!ball) {
         TraceLog(LOG_ERROR, "Failed to create ball");
         return NULL;
     }
 
-    // Remove old ball if exists
-    if (game->ball) {
-        GameRemoveEntity(game, game->ball);
-        EntityDestroy(game->ball);
+    // Ball types with their own friction keep it
+    if (ballType == BALL_TYPE_NORMAL) {
+        BallGetData(ball)->friction = game->tuning.ballFriction;
     }
 
-    // Add new ball to entities
     if (!GameAddEntity(game, ball)) {
         TraceLog(LOG_ERROR, "Failed to add ball to entities");
-        EntityDestroy(ball);
+        BallDestroy(game->balls, ball);
         return NULL;
     }
 
-    // Set as current ball
-    game->ball = ball;
+    return ball;
+}
+
+/**
+ * @brief Set how many balls are in play
+ *
+ * @param game Pointer to game
+ * @param count Number of balls (1 to BALL_POOL_CAPACITY)
+ * @return bool Whether every ball could be added
+ */
+bool GameSetBallCount(Game* game, int count) {
+    if (!game || game->balls->count == 0) return false;
+    if (count < 1) count = 1;
+
+    // Remove the newest balls first
+    while (game->balls->count > count) {
+        GameDestroyEntity(game, game->balls->balls[game->balls->count - 1]);
+    }
+
+    BallType ballType = BallGetData(game->balls->balls[0])->type;
+    bool success = true;
+    while (game->balls->count < count) {
+        if (!GameAddBall(game, ballType, 0.0f, 0.0f)) {
+            success = false;
+            break;
+        }
+    }
+
+    GameResetBalls(game);
+    BallPoolBuildGrid(game->balls);
+
+    return success;
+}
+
+/**
+ * @brief Remove an entity from the game and free it
+ *
+ * @param game Pointer to game
+ * @param entity Pointer to entity
+ */
+void GameDestroyEntity(Game* game, Entity* entity) {
+    if (!game || !entity) return;
+
+    GameRemoveEntity(game, entity);
+    if (entity->type == ENTITY_BALL) {
+        BallDestroy(game->balls, entity);
+    }
+    else {
+        EntityDestroy(entity);
+    }
+}
+
+/**
+ * @brief Set ball for game
+ *
+ * Replaces every ball in play with one ball of the given type.
+ *
+ * @param game Pointer to game
+ * @param ballType Ball type
+ * @return Entity* Pointer to ball entity
+ */
+Entity* GameSetBall(Game* game, BallType ballType) {
+    if (!game || !game->player) return NULL;
+
+    // Remove old balls
+    while (game->balls->count > 0) {
+        GameDestroyEntity(game, game->balls->balls[game->balls->count - 1]);
+    }
+
+    // Create new ball near player
+    Entity* ball = GameAddBall(game, ballType, game->player->x + 20, game->player->y + 20);
+    BallPoolBuildGrid(game->balls);
 
     return ball;
 }
@@ -736,6 +1612,25 @@ void GameShutdown(Game* game) {
     // Other cleanup as needed
 }
 
+/**
+ * @brief Set the gameplay random seed
+ *
+ * Reseeds the win condition's generator now. Worlds, dungeons and open
+ * world chunks created after this call are generated from the new seed;
+ * ones that already exist keep the seed they were built with.
+ *
+ * @param game Pointer to game
+ * @param seed New seed
+ */
+void GameSetSeed(Game* game, uint64_t seed) {
+    if (!game) return;
+
+    game->seed = seed;
+    WinConditionSeed(game->winCondition, seed);
+
+    TraceLog(LOG_INFO, "Game seed set to %llu", (unsigned long long)seed);
+}
+
 /**
  * @brief Load game level
  *
@@ -746,29 +1641,22 @@ void GameShutdown(Game* game) {
 bool GameLoadLevel(Game* game, int levelId) {
     if (!game) return false;
 
-    // Free current world if exists
-    if (game->world) {
-        WorldDestroy(game->world);
-    }
-
     // Load new world from file
     char filename[64];
     sprintf_s(filename, sizeof(filename), "Assets/Levels/level_%d.dat", levelId);
 
-    game->world = WorldLoad(filename);
-    if (!game->world) {
+    // Keep the current world until the new one has loaded
+    World* world = WorldLoad(filename);
+    if (!world) {
         TraceLog(LOG_ERROR, "Failed to load level %d", levelId);
         return false;
     }
 
-    // Create a new win condition for the loaded level
-    if (game->winCondition) {
-        WinConditionDestroy(game->winCondition);
-    }
-    game->winCondition = InitializeWinCondition(game->world, game->camera);
+    GameUseWorld(game, world);
+    game->levelId = levelId;
 
-    // Reset player and ball positions
-    GameReset(game);
+    // Reload the level whenever its file is edited
+    HotReloaderWatchLevel(game->hotReloader, levelId, filename);
 
     return true;
 }
@@ -797,6 +1685,7 @@ Entity* GameSetSnakeBoss(Game* game, int gridX, int gridY, int initialLength) {
         TraceLog(LOG_ERROR, "Failed to create snake boss");
         return NULL;
     }
+    SnakeBossGetData(snakeBoss)->intervalStep = game->tuning.snakeIntervalDecrease;
 
     // Add snake boss to entities
     if (!GameAddEntity(game, snakeBoss)) {
@@ -805,13 +1694,14 @@ Entity* GameSetSnakeBoss(Game* game, int gridX, int gridY, int initialLength) {
         return NULL;
     }
 
-    // Force the snake to start tracking the ball immediately
-    if (game->ball) {
+    // Force the snake to start tracking the nearest ball immediately
+    Entity* ball = BallPoolFindNearest(game->balls, (gridX + 0.5f) * TILE_WIDTH, (gridY + 0.5f) * TILE_HEIGHT);
+    if (ball) {
         SnakeBossData* bossData = SnakeBossGetData(snakeBoss);
         if (bossData) {
             // Convert ball position to grid coordinates
-            int ballGridX = (int)(game->ball->x / TILE_WIDTH);
-            int ballGridY = (int)(game->ball->y / TILE_HEIGHT);
+            int ballGridX = (int)(ball->x / TILE_WIDTH);
+            int ballGridY = (int)(ball->y / TILE_HEIGHT);
 
             // Set target to ball position
             bossData->targetGridX = ballGridX;
@@ -868,25 +1758,14 @@ void InitializeWorldLayoutWithSnakeBoss(World* world, GameCamera* camera) {
     int clearAreaWidth = 5; // Adjusted for 25x25 tiles
     int clearAreaHeight = 4; // Adjusted for 25x25 tiles
 
-    // Clear any walls in this area
-    for (int x = clearAreaLeft; x < clearAreaLeft + clearAreaWidth; x++) {
-        for (int y = clearAreaTop; y < clearAreaTop + clearAreaHeight; y++) {
-            if (x >= 0 && x < world->width && y >= 0 && y < world->height) {
-                WorldSetTileType(world, x, y, TILE_TYPE_EMPTY);
-            }
-        }
-    }
+    // Clear any walls in this area (the edit is clipped to the world)
+    WorldEditRegion(world, clearAreaLeft, clearAreaTop, clearAreaWidth, clearAreaHeight, TILE_TYPE_EMPTY);
 
     // Add walls around the perimeter of the clear area
-    for (int x = clearAreaLeft; x < clearAreaLeft + clearAreaWidth; x++) {
-        WorldSetTileType(world, x, clearAreaTop, TILE_TYPE_WALL);
-        WorldSetTileType(world, x, clearAreaTop + clearAreaHeight - 1, TILE_TYPE_WALL);
-    }
-
-    for (int y = clearAreaTop; y < clearAreaTop + clearAreaHeight; y++) {
-        WorldSetTileType(world, clearAreaLeft, y, TILE_TYPE_WALL);
-        WorldSetTileType(world, clearAreaLeft + clearAreaWidth - 1, y, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, clearAreaLeft, clearAreaTop, clearAreaWidth, 1, TILE_TYPE_WALL);
+    WorldEditRegion(world, clearAreaLeft, clearAreaTop + clearAreaHeight - 1, clearAreaWidth, 1, TILE_TYPE_WALL);
+    WorldEditRegion(world, clearAreaLeft, clearAreaTop, 1, clearAreaHeight, TILE_TYPE_WALL);
+    WorldEditRegion(world, clearAreaLeft + clearAreaWidth - 1, clearAreaTop, 1, clearAreaHeight, TILE_TYPE_WALL);
 
     TraceLog(LOG_INFO, "Created custom arena for snake boss");
 }
@@ -906,14 +1785,22 @@ WinCondition* InitializeWinCondition(World* world, GameCamera* camera) {
     // Calculate center of the world in pixels
     float centerX = WIN_HOLE_DEFAULT_X*(world->width * TILE_WIDTH) / 2.0f;
     float centerY = WIN_HOLE_DEFAULT_Y*(world->height * TILE_HEIGHT) / 2.0f;
+    float radius = WIN_HOLE_RADIUS;
     //float centerX = (world->width * TILE_WIDTH) / 2.0f;
     //float centerY = (world->height * TILE_HEIGHT) / 2.0f;
 
+    // Use the level's hole if it defines one
+    if (world->holeRadius > 0.0f) {
+        centerX = world->holePosition.x;
+        centerY = world->holePosition.y;
+        radius = world->holeRadius;
+    }
+
     // Create the win condition at the center of the world
     WinCondition* winCondition = WinConditionCreate(
         centerX,
         centerY,
-        WIN_HOLE_RADIUS
+        radius
     );
 
     if (!winCondition) {
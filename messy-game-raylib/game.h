@@ -10,6 +10,8 @@
 #include "renderer.h"
 #include "camera.h"
 #include "textures.h"
+#include "asset_loader.h"
+#include "hot_reload.h"
 
 #include "entity.h"
 #include "player.h"
@@ -18,6 +20,11 @@
 #include "input.h"
 #include "snake_boss.h"
 #include "win_condition.h" // Added win condition header
+#include "tuning.h"
+#include "physics.h"
+#include "surface.h"
+#include "tile_event.h"
+#include "config.h"
 
  /**
   * @brief Game states enumeration
@@ -45,17 +52,33 @@ typedef struct {
     GameState state; // Current game state
     GameState prevState; // Previous game state
     bool isRunning; // Whether game is running
+    bool headless; // Simulation only: no window, textures, audio or camera
 
     float gameTime; // Total game time
     float deltaTime; // Time since last update
+    double simulationTime; // Time the fixed-step simulation has reached (GetTime clock)
     int fps; // Current FPS
+    uint64_t seed; // Seed for all gameplay random streams
+    GameTuning tuning; // Balancing parameters applied to new entities
+    PhysicsSolver physics; // Resolves collisions between players, balls and enemies
+    SurfaceSampler surfaces; // Tiles under the players and balls this step
+    TileEventQueue tileEvents; // Trigger and door events raised this step
     Renderer* renderer; // Rendering system
     GameCamera* camera; // Camera system
     TextureManager* textures; // Texture manager
-    InputManager* input; // Input system
+    AssetLoader* assetLoader; // Background asset loader (NULL once loading is done)
+    DungeonBuilder* dungeonBuilder; // Generates the dungeon during the splash screen (NULL when done or disabled)
+    HotReloader* hotReloader; // Reloads changed asset files (NULL if disabled)
+    struct NetSession* net; // Network session (NULL when playing offline)
+    InputManager* input; // Input system (local player 0)
+    InputManager* playerInputs[MAX_LOCAL_PLAYERS]; // Input per local player (0 is input)
+    InputDeviceState devices; // Devices polled this frame, shared by all players
     World* world; // Game world
-    Entity* player; // Player entity
-    Entity* ball; // Ball entity
+    int levelId; // ID of the loaded level file (-1 for the built-in arena)
+    Entity* player; // Player entity (local player 0)
+    Entity* players[MAX_LOCAL_PLAYERS]; // Local player entities (0 is player)
+    int playerCount; // Number of local players
+    BallPool* balls; // Balls in play (each is also in entities)
     Entity** entities; // Array of all entities
     int entityCount; // Number of entities
     int entityCapacity; // Capacity of entities array
@@ -72,6 +95,21 @@ typedef struct {
  */
 Game* GameCreate(int screenWidth, int screenHeight);
 
+/**
+ * @brief Create a game that only runs the simulation
+ *
+ * The match is set up and playing on return. Nothing in a headless game
+ * touches the window, GPU, audio or any global state, so several can run
+ * at once on different threads. Drive it with GameSimulationStep after
+ * setting each player's actions with InputManagerSetActions.
+ *
+ * @param seed Gameplay random seed
+ * @param tuning Balancing parameters, or NULL for the config values
+ * @param playerCount Number of players (1 to MAX_LOCAL_PLAYERS)
+ * @return Game* Pointer to created game, or NULL if failed
+ */
+Game* GameCreateHeadless(uint64_t seed, const GameTuning* tuning, int playerCount);
+
 /**
  * @brief Destroy game and free resources
  *
@@ -101,6 +139,14 @@ void GameRun(Game* game);
  */
 void GameUpdate(Game* game);
 
+/**
+ * @brief Advance the simulation by one fixed step
+ *
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+void GameSimulationStep(Game* game, float deltaTime);
+
 /**
  * @brief Render game
  *
@@ -185,15 +231,85 @@ void GameReset(Game* game);
  */
 Entity* GameSetPlayer(Game* game, PlayerType playerType);
 
+/**
+ * @brief Add another local player with their own input
+ *
+ * @param game Pointer to game
+ * @param playerType Player type
+ * @return Entity* Pointer to the new player, or NULL if failed
+ */
+Entity* GameAddLocalPlayer(Game* game, PlayerType playerType);
+
+/**
+ * @brief Run the simulation for network clients
+ *
+ * @param game Pointer to game
+ * @param port UDP port to listen on
+ * @return bool Whether the server started
+ */
+bool GameHostServer(Game* game, uint16_t port);
+
+/**
+ * @brief Play on a network server
+ *
+ * @param game Pointer to game
+ * @param address Server host name or address, optionally with ":port"
+ * @return bool Whether the connection was started
+ */
+bool GameConnect(Game* game, const char* address);
+
+/**
+ * @brief Add a ball to the game
+ *
+ * @param game Pointer to game
+ * @param ballType Ball type
+ * @param x Initial X position
+ * @param y Initial Y position
+ * @return Entity* Pointer to ball entity, or NULL if the ball pool is full
+ */
+Entity* GameAddBall(Game* game, BallType ballType, float x, float y);
+
+/**
+ * @brief Set how many balls are in play
+ *
+ * Adds balls like the first one, or removes the newest, then lines them
+ * all up at the ball spawn point.
+ *
+ * @param game Pointer to game
+ * @param count Number of balls (1 to BALL_POOL_CAPACITY)
+ * @return bool Whether every ball could be added
+ */
+bool GameSetBallCount(Game* game, int count);
+
+/**
+ * @brief Remove an entity from the game and free it
+ *
+ * Balls go back to the ball pool; other entities are freed.
+ *
+ * @param game Pointer to game
+ * @param entity Pointer to entity
+ */
+void GameDestroyEntity(Game* game, Entity* entity);
+
 /**
  * @brief Set ball for game
  *
+ * Replaces every ball in play with one ball of the given type.
+ *
  * @param game Pointer to game
  * @param ballType Ball type
  * @return Entity* Pointer to ball entity
  */
 Entity* GameSetBall(Game* game, BallType ballType);
 
+/**
+ * @brief Set the gameplay random seed
+ *
+ * @param game Pointer to game
+ * @param seed New seed
+ */
+void GameSetSeed(Game* game, uint64_t seed);
+
 /**
  * @brief Load game level
  *
@@ -0,0 +1,228 @@
+/**
+ * @file hot_reload.c
+ * @brief Implementation of asset hot reloading
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "hot_reload.h"
+#include "config.h"
+
+/**
+ * @brief Mark an entry as changed and restart its settle timer
+ *
+ * @param entry Pointer to entry
+ */
+static void HotReloaderMarkChanged(HotReloadEntry* entry) {
+    entry->pending = true;
+    entry->settleTimer = HOT_RELOAD_SETTLE_TIME;
+}
+
+/**
+ * @brief Add a file to the watch list
+ *
+ * @param reloader Pointer to reloader
+ * @param type Asset type
+ * @param id TextureID or level ID
+ * @param filePath Path to file
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the file is being watched
+ */
+static bool HotReloaderWatch(HotReloader* reloader, HotReloadType type, int id, const char* filePath, int tileWidth, int tileHeight) {
+    if (!reloader || !filePath) return false;
+
+    // Watching the same file again only refreshes its parameters
+    for (int i = 0; i < reloader->count; i++) {
+        HotReloadEntry* entry = &reloader->entries[i];
+        if (entry->type == type && strcmp(entry->filePath, filePath) == 0) {
+            entry->id = id;
+            entry->tileWidth = tileWidth;
+            entry->tileHeight = tileHeight;
+            return true;
+        }
+    }
+
+    // Grow the entry array if needed
+    if (reloader->count >= reloader->capacity) {
+        int newCapacity = reloader->capacity > 0 ? reloader->capacity * 2 : 8;
+        HotReloadEntry* newEntries = (HotReloadEntry*)realloc(reloader->entries, sizeof(HotReloadEntry) * newCapacity);
+        if (!newEntries) {
+            TraceLog(LOG_ERROR, "Failed to expand hot reload entry array");
+            return false;
+        }
+
+        reloader->entries = newEntries;
+        reloader->capacity = newCapacity;
+    }
+
+    // The watcher reports changes as "directory/name" built from the
+    // directory it was given, which GetDirectoryPath may have rewritten
+    // (e.g. a "./" prefix on relative paths), so build the same string
+    const char* directory = GetDirectoryPath(filePath);
+    char watchPath[512];
+    snprintf(watchPath, sizeof(watchPath), "%s/%s", directory, GetFileName(filePath));
+
+    char* pathCopy = _strdup(filePath);
+    char* watchPathCopy = _strdup(watchPath);
+    if (!pathCopy || !watchPathCopy) {
+        free(pathCopy);
+        free(watchPathCopy);
+        return false;
+    }
+
+    HotReloadEntry* entry = &reloader->entries[reloader->count++];
+    entry->type = type;
+    entry->filePath = pathCopy;
+    entry->watchPath = watchPathCopy;
+    entry->id = id;
+    entry->tileWidth = tileWidth;
+    entry->tileHeight = tileHeight;
+    entry->modTime = FileExists(filePath) ? GetFileModTime(filePath) : 0;
+    entry->pending = false;
+    entry->settleTimer = 0.0f;
+
+    if (reloader->watcher) {
+        if (!PlatformFileWatcherAddDirectory(reloader->watcher, directory)) {
+            TraceLog(LOG_WARNING, "Failed to watch %s, falling back to polling", directory);
+            PlatformFileWatcherDestroy(reloader->watcher);
+            reloader->watcher = NULL;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Create a hot reloader
+ *
+ * @return HotReloader* Pointer to created reloader or NULL if failed
+ */
+HotReloader* HotReloaderCreate(void) {
+    HotReloader* reloader = (HotReloader*)calloc(1, sizeof(HotReloader));
+    if (!reloader) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for hot reloader");
+        return NULL;
+    }
+
+    reloader->watcher = PlatformFileWatcherCreate();
+    if (!reloader->watcher) {
+        TraceLog(LOG_INFO, "File change notifications unavailable, polling for asset changes");
+    }
+
+    return reloader;
+}
+
+/**
+ * @brief Destroy a hot reloader
+ *
+ * @param reloader Pointer to reloader
+ */
+void HotReloaderDestroy(HotReloader* reloader) {
+    if (!reloader) return;
+
+    for (int i = 0; i < reloader->count; i++) {
+        free(reloader->entries[i].filePath);
+        free(reloader->entries[i].watchPath);
+    }
+
+    PlatformFileWatcherDestroy(reloader->watcher);
+    free(reloader->entries);
+    free(reloader);
+}
+
+/**
+ * @brief Watch the image file backing a texture
+ *
+ * @param reloader Pointer to reloader
+ * @param id Texture ID
+ * @param filePath Path to image file
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the file is being watched
+ */
+bool HotReloaderWatchTexture(HotReloader* reloader, TextureID id, const char* filePath, int tileWidth, int tileHeight) {
+    if (id < 0 || id >= TEXTURE_COUNT) return false;
+
+    return HotReloaderWatch(reloader, HOT_RELOAD_TEXTURE, id, filePath, tileWidth, tileHeight);
+}
+
+/**
+ * @brief Watch a level file
+ *
+ * @param reloader Pointer to reloader
+ * @param levelId Level ID
+ * @param filePath Path to level file
+ * @return bool Whether the file is being watched
+ */
+bool HotReloaderWatchLevel(HotReloader* reloader, int levelId, const char* filePath) {
+    return HotReloaderWatch(reloader, HOT_RELOAD_LEVEL, levelId, filePath, 0, 0);
+}
+
+/**
+ * @brief Collect file changes
+ *
+ * @param reloader Pointer to reloader
+ * @param deltaTime Time since last update
+ */
+void HotReloaderUpdate(HotReloader* reloader, float deltaTime) {
+    if (!reloader) return;
+
+    if (reloader->watcher) {
+        // Match notified paths against the watch list
+        char path[512];
+        while (PlatformFileWatcherPoll(reloader->watcher, path, sizeof(path))) {
+            for (int i = 0; i < reloader->count; i++) {
+                if (strcmp(reloader->entries[i].watchPath, path) == 0) {
+                    HotReloaderMarkChanged(&reloader->entries[i]);
+                }
+            }
+        }
+    }
+    else {
+        // Compare modification times a few times a second
+        reloader->pollTimer -= deltaTime;
+        if (reloader->pollTimer <= 0.0f) {
+            reloader->pollTimer = HOT_RELOAD_POLL_INTERVAL;
+
+            for (int i = 0; i < reloader->count; i++) {
+                HotReloadEntry* entry = &reloader->entries[i];
+                if (!FileExists(entry->filePath)) continue;
+
+                long modTime = GetFileModTime(entry->filePath);
+                if (modTime != entry->modTime) {
+                    entry->modTime = modTime;
+                    HotReloaderMarkChanged(entry);
+                }
+            }
+        }
+    }
+
+    // Count down settle timers
+    for (int i = 0; i < reloader->count; i++) {
+        if (reloader->entries[i].pending) {
+            reloader->entries[i].settleTimer -= deltaTime;
+        }
+    }
+}
+
+/**
+ * @brief Take the next settled change
+ *
+ * @param reloader Pointer to reloader
+ * @return HotReloadEntry* Changed entry or NULL if there are no more
+ */
+HotReloadEntry* HotReloaderNextChange(HotReloader* reloader) {
+    if (!reloader) return NULL;
+
+    for (int i = 0; i < reloader->count; i++) {
+        HotReloadEntry* entry = &reloader->entries[i];
+        if (entry->pending && entry->settleTimer <= 0.0f) {
+            entry->pending = false;
+            return entry;
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file hot_reload.h
+ * @brief Hot reloading of assets during development
+ *
+ * This file defines the hot reloader, which watches texture and level
+ * files and reports the ones that changed on disk so the game can reload
+ * them in place between frames. Change notifications come from the
+ * platform file watcher where one exists, otherwise file modification
+ * times are polled.
+ */
+#ifndef MESSY_GAME_HOT_RELOAD_H
+#define MESSY_GAME_HOT_RELOAD_H
+
+#include <stdbool.h>
+#include "textures.h"
+#include "platform.h"
+
+/**
+ * @brief Hot reload asset types enumeration
+ */
+typedef enum {
+    HOT_RELOAD_TEXTURE,        // Image file backing a texture slot
+    HOT_RELOAD_LEVEL,          // Binary level file
+    HOT_RELOAD_COUNT
+} HotReloadType;
+
+/**
+ * @brief Watched file entry
+ */
+typedef struct {
+    HotReloadType type;        // What kind of asset the file holds
+    char* filePath;            // Path to watched file
+    char* watchPath;           // Path the file watcher reports for the file ("directory/name")
+    int id;                    // TextureID or level ID
+    int tileWidth;             // Width of tiles (if tileset) or 0
+    int tileHeight;            // Height of tiles (if tileset) or 0
+    long modTime;              // Last seen modification time
+    bool pending;              // Whether a change is waiting to settle
+    float settleTimer;         // Time left before a pending change is reported
+} HotReloadEntry;
+
+/**
+ * @brief Hot reloader structure
+ */
+typedef struct {
+    HotReloadEntry* entries;   // Array of watched files
+    int count;                 // Number of watched files
+    int capacity;              // Capacity of entries array
+    PlatformFileWatcher* watcher; // OS change notifications (NULL when polling)
+    float pollTimer;           // Time until the next modification time poll
+} HotReloader;
+
+/**
+ * @brief Create a hot reloader
+ *
+ * @return HotReloader* Pointer to created reloader or NULL if failed
+ */
+HotReloader* HotReloaderCreate(void);
+
+/**
+ * @brief Destroy a hot reloader
+ *
+ * @param reloader Pointer to reloader
+ */
+void HotReloaderDestroy(HotReloader* reloader);
+
+/**
+ * @brief Watch the image file backing a texture
+ *
+ * @param reloader Pointer to reloader
+ * @param id Texture ID
+ * @param filePath Path to image file
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the file is being watched
+ */
+bool HotReloaderWatchTexture(HotReloader* reloader, TextureID id, const char* filePath, int tileWidth, int tileHeight);
+
+/**
+ * @brief Watch a level file
+ *
+ * @param reloader Pointer to reloader
+ * @param levelId Level ID
+ * @param filePath Path to level file
+ * @return bool Whether the file is being watched
+ */
+bool HotReloaderWatchLevel(HotReloader* reloader, int levelId, const char* filePath);
+
+/**
+ * @brief Collect file changes
+ *
+ * A change is only reported once the file has been quiet for
+ * HOT_RELOAD_SETTLE_TIME, so a file is not read while it is still being
+ * written.
+ *
+ * @param reloader Pointer to reloader
+ * @param deltaTime Time since last update
+ */
+void HotReloaderUpdate(HotReloader* reloader, float deltaTime);
+
+/**
+ * @brief Take the next settled change
+ *
+ * @param reloader Pointer to reloader
+ * @return HotReloadEntry* Changed entry or NULL if there are no more
+ */
+HotReloadEntry* HotReloaderNextChange(HotReloader* reloader);
+
+#endif // MESSY_GAME_HOT_RELOAD_H
@@ -9,32 +9,17 @@
 #include <stdio.h>
 #include "input.h"
 
-bool IsTouchAvailable(void) {
-    return false; // Stub implementation for desktop
-}
+// Binding file layout (see InputManagerSaveBindings)
+#define INPUT_BINDINGS_HEADER_SIZE 16  // Bytes before the first record
+#define INPUT_BINDINGS_RECORD_SIZE 12  // Bytes per record written by this build
+#define INPUT_BINDING_FLAG_AXIS 0x01   // Record flag: input is an axis
+#define INPUT_BINDING_FLAG_POSITIVE 0x02 // Record flag: positive axis triggers action
 
- // Singleton instance for global access
-static InputManager* gInputManager = NULL;
-
-/**
- * @brief Get global input manager instance
- *
- * @return InputManager* Pointer to the global input manager
- */
-InputManager* GetInputManager(void) {
-    if (gInputManager == NULL) {
-        TraceLog(LOG_WARNING, "Trying to access InputManager before initialization");
-    }
-    return gInputManager;
-}
+// Compile-time check: every action needs a bit in InputActionMask and must fit a record byte
+typedef char InputActionMaskSizeCheck[(ACTION_COUNT <= 32) ? 1 : -1];
 
-/**
- * @brief Set global input manager instance
- *
- * @param manager Pointer to input manager
- */
-void SetInputManager(InputManager* manager) {
-    gInputManager = manager;
+bool IsTouchAvailable(void) {
+    return false; // Stub implementation for desktop
 }
 
 /**
@@ -58,28 +43,11 @@ InputManager* InputManagerCreate(int initialBindingCapacity) {
         return NULL;
     }
 
-    // Allocate action state arrays
-    manager->actionStates = (bool*)calloc(ACTION_COUNT, sizeof(bool));
-    manager->prevActionStates = (bool*)calloc(ACTION_COUNT, sizeof(bool));
+    // Allocate action value array
     manager->actionValues = (float*)calloc(ACTION_COUNT, sizeof(float));
-
-    if (!manager->actionStates || !manager->prevActionStates || !manager->actionValues) {
-        TraceLog(LOG_ERROR, "Failed to allocate memory for action states");
-        free(manager->bindings);
-        free(manager->actionStates);
-        free(manager->prevActionStates);
-        free(manager->actionValues);
-        free(manager);
-        return NULL;
-    }
-
     if (!manager->actionValues) {
-        // Handle allocation failure
         TraceLog(LOG_ERROR, "Failed to allocate actionValues array");
-        // Clean up other allocations
         free(manager->bindings);
-        free(manager->actionStates);
-        free(manager->prevActionStates);
         free(manager);
         return NULL;
     }
@@ -87,13 +55,19 @@ InputManager* InputManagerCreate(int initialBindingCapacity) {
     // Initialize manager
     manager->bindingCount = 0;
     manager->bindingCapacity = initialBindingCapacity;
+    manager->bindingsDirty = true;
+    memset(&manager->table, 0, sizeof(InputBindingTable));
+    manager->actionStates = 0;
+    manager->prevActionStates = 0;
+    manager->deviceStates = 0;
+    memset(manager->deviceValues, 0, sizeof(manager->deviceValues));
+    manager->lastPollTime = 0.0;
+    manager->events.head = 0;
+    manager->events.count = 0;
     manager->gamepadsConnected = 0;
     manager->touchSupported = IsTouchAvailable();
     manager->keyboardConnected = true; // Assume keyboard is always available
 
-    // Set as global instance
-    SetInputManager(manager);
-
     return manager;
 }
 
@@ -107,161 +81,523 @@ void InputManagerDestroy(InputManager* manager) {
 
     // Free resources
     free(manager->bindings);
-    free(manager->actionStates);
-    free(manager->prevActionStates);
+    free(manager->table.axes);
     free(manager->actionValues);
 
-    // Clear global reference if this is the current manager
-    if (gInputManager == manager) {
-        gInputManager = NULL;
-    }
-
     // Free manager
     free(manager);
 }
 
 /**
- * @brief Update input state
+ * @brief Compile bindings into per-device lookup tables
+ *
+ * Bindings naming an input outside the table ranges are ignored.
  *
  * @param manager Pointer to input manager
+ * @return bool Whether the tables were rebuilt
  */
-void InputManagerUpdate(InputManager* manager) {
-    if (!manager) return;
-
-    // Copy current states to previous states
-    memcpy(manager->prevActionStates, manager->actionStates, sizeof(bool) * ACTION_COUNT);
-
-    // Reset current states and values
-    memset(manager->actionStates, 0, sizeof(bool) * ACTION_COUNT);
-    memset(manager->actionValues, 0, sizeof(float) * ACTION_COUNT);
+static bool InputManagerCompileBindings(InputManager* manager) {
+    InputBindingTable* table = &manager->table;
+
+    // Make sure every binding fits before clearing the old tables
+    if (table->axisCapacity < manager->bindingCount) {
+        InputAxisBinding* newAxes = (InputAxisBinding*)realloc(
+            table->axes,
+            sizeof(InputAxisBinding) * manager->bindingCount
+        );
 
-    // Update gamepad connection status
-    manager->gamepadsConnected = 0;
-    for (int i = 0; i < MAX_GAMEPADS; i++) {
-        if (IsGamepadAvailable(i)) {
-            manager->gamepadsConnected++;
+        if (!newAxes) {
+            TraceLog(LOG_ERROR, "Failed to expand compiled axis bindings");
+            return false;
         }
+
+        table->axes = newAxes;
+        table->axisCapacity = manager->bindingCount;
     }
 
-    // Process each binding
+    InputAxisBinding* axes = table->axes;
+    int axisCapacity = table->axisCapacity;
+    memset(table, 0, sizeof(InputBindingTable));
+    table->axes = axes;
+    table->axisCapacity = axisCapacity;
+
     for (int i = 0; i < manager->bindingCount; i++) {
-        InputBinding* binding = &manager->bindings[i];
-        bool isActive = false;
-        float value = 0.0f;
+        const InputBinding* binding = &manager->bindings[i];
+        if (binding->action <= ACTION_NONE || binding->action >= ACTION_COUNT) continue;
+
+        InputActionMask actionBit = (InputActionMask)1 << binding->action;
+        int inputId = binding->inputId;
+        int deviceId = binding->deviceId;
+        bool isAxis = binding->isAxis;
 
-        // Check input state based on device type
         switch (binding->deviceType) {
         case INPUT_DEVICE_KEYBOARD:
-            if (binding->isAxis) {
-                // Keyboard doesn't support axis directly, but we can simulate
-                // (e.g., W/S for Y axis, A/D for X axis)
-                if (binding->axisPositive) {
-                    isActive = IsKeyDown(binding->inputId);
-                }
-                else {
-                    isActive = IsKeyDown(binding->inputId);
-                }
-                value = isActive ? 1.0f : 0.0f;
-            }
-            else {
-                isActive = IsKeyDown(binding->inputId);
-                value = isActive ? 1.0f : 0.0f;
+            // Keyboard "axes" are plain keys
+            if (inputId < 0 || inputId >= INPUT_MAX_KEYS) break;
+
+            if (table->keyActions[inputId] == 0) {
+                table->boundKeys[table->boundKeyCount++] = inputId;
             }
+            table->keyActions[inputId] |= actionBit;
             break;
 
         case INPUT_DEVICE_GAMEPAD:
-            if (IsGamepadAvailable(binding->deviceId)) {
-                if (binding->isAxis) {
-                    float axisValue = GetGamepadAxisMovement(binding->deviceId, binding->inputId);
-
-                    // Apply deadzone and threshold
-                    if (binding->axisPositive && axisValue > binding->axisThreshold) {
-                        isActive = true;
-                        value = (axisValue - binding->axisThreshold) / (1.0f - binding->axisThreshold);
-                    }
-                    else if (!binding->axisPositive && axisValue < -binding->axisThreshold) {
-                        isActive = true;
-                        value = (-axisValue - binding->axisThreshold) / (1.0f - binding->axisThreshold);
-                    }
-                }
-                else {
-                    isActive = IsGamepadButtonDown(binding->deviceId, binding->inputId);
-                    value = isActive ? 1.0f : 0.0f;
-                }
-            }
-            break;
+            if (deviceId < 0 || deviceId >= MAX_GAMEPADS) break;
 
-        case INPUT_DEVICE_TOUCH:
-            if (manager->touchSupported) {
-                // Touch handling would depend on your specific requirements
-                // This is just a basic example
-                if (GetTouchPointCount() > 0) {
-                    // Check if touch is in a specific region
-                    Vector2 touchPos = GetTouchPosition(0);
-
-                    // Example: binding->inputId could represent a specific touch zone
-                    // This is a simplified approach; real implementation would be more complex
-                    Rectangle touchZone = { 0, 0, 0, 0 };
-
-                    switch (binding->inputId) {
-                    case 0: // Left zone
-                        touchZone = (Rectangle){ 0, 0, (float)(GetScreenWidth() / 4), GetScreenHeight() };
-                        break;
-                    case 1: // Right zone
-                        touchZone = (Rectangle){ GetScreenWidth() * 3 / 4, 0, GetScreenWidth() / 4, GetScreenHeight() };
-                        break;
-                    case 2: // Up zone
-                        touchZone = (Rectangle){ 0, 0, GetScreenWidth(), GetScreenHeight() / 4 };
-                        break;
-                    case 3: // Down zone
-                        touchZone = (Rectangle){ 0, GetScreenHeight() * 3 / 4, GetScreenWidth(), GetScreenHeight() / 4 };
-                        break;
-                        // Add more zones as needed
-                    }
-
-                    isActive = CheckCollisionPointRec(touchPos, touchZone);
-                    value = isActive ? 1.0f : 0.0f;
-                }
+            if (isAxis) {
+                if (inputId < 0 || inputId >= INPUT_MAX_GAMEPAD_AXES) break;
+                table->boundAxes[deviceId] |= 1u << inputId;
+            }
+            else {
+                if (inputId < 0 || inputId >= INPUT_MAX_GAMEPAD_BUTTONS) break;
+                table->buttonActions[deviceId][inputId] |= actionBit;
+                table->boundButtons[deviceId] |= 1u << inputId;
             }
             break;
 
         case INPUT_DEVICE_MOUSE:
-            if (binding->isAxis) {
-                switch (binding->inputId) {
-                case 0: // X axis
-                    value = GetMouseDelta().x / 10.0f; // Scale as needed
-                    isActive = fabs(value) > binding->axisThreshold;
-                    break;
-                case 1: // Y axis
-                    value = GetMouseDelta().y / 10.0f; // Scale as needed
-                    isActive = fabs(value) > binding->axisThreshold;
-                    break;
-                case 2: // Wheel
-                    value = GetMouseWheelMove();
-                    isActive = fabs(value) > binding->axisThreshold;
-                    break;
-                }
+            if (isAxis) {
+                if (inputId < 0 || inputId >= INPUT_MOUSE_AXIS_COUNT) break;
+                table->mouseAxesBound = true;
             }
             else {
-                isActive = IsMouseButtonDown(binding->inputId);
-                value = isActive ? 1.0f : 0.0f;
+                if (inputId < 0 || inputId >= INPUT_MAX_MOUSE_BUTTONS) break;
+                table->mouseButtonActions[inputId] |= actionBit;
+                table->boundMouseButtons |= 1u << inputId;
             }
             break;
 
+        case INPUT_DEVICE_TOUCH:
+            if (inputId < 0 || inputId >= INPUT_TOUCH_ZONE_COUNT) break;
+            table->touchZoneActions[inputId] |= actionBit;
+            table->touchActions |= actionBit;
+            isAxis = false;
+            break;
+
         default:
+            isAxis = false;
             break;
         }
 
-        // Update action state if this input is active
+        // Analog bindings keep their threshold and direction
+        if (isAxis && (binding->deviceType == INPUT_DEVICE_GAMEPAD || binding->deviceType == INPUT_DEVICE_MOUSE)) {
+            InputAxisBinding* axis = &table->axes[table->axisCount++];
+            axis->action = binding->action;
+            axis->deviceType = binding->deviceType;
+            axis->deviceId = deviceId;
+            axis->inputId = inputId;
+            axis->axisThreshold = binding->axisThreshold;
+            axis->axisPositive = binding->axisPositive;
+        }
+    }
+
+    manager->bindingsDirty = false;
+    return true;
+}
+
+/**
+ * @brief Poll every input any of the managers is bound to
+ *
+ * Each input is read once however many managers bind it, and the key
+ * press queue, which raylib empties as it is read, is drained here for
+ * all of them.
+ *
+ * @param devices Pointer to device state to fill
+ * @param managers Managers whose bindings decide what is polled
+ * @param managerCount Number of managers
+ */
+void InputPollDevices(InputDeviceState* devices, InputManager* const* managers, int managerCount) {
+    if (!devices) return;
+
+    memset(devices, 0, sizeof(InputDeviceState));
+    devices->time = GetTime();
+
+    // Merge what the managers are bound to
+    uint32_t keysPolled[INPUT_MAX_KEYS / 32] = { 0 };
+    uint32_t gamepadButtons[MAX_GAMEPADS] = { 0 };
+    uint32_t gamepadAxes[MAX_GAMEPADS] = { 0 };
+    uint32_t mouseButtons = 0;
+    bool mouseAxes = false;
+    bool touch = false;
+
+    for (int m = 0; m < managerCount; m++) {
+        InputManager* manager = managers[m];
+        if (!manager) continue;
+
+        // Recompile the lookup tables if bindings changed since the last update
+        if (manager->bindingsDirty) {
+            InputManagerCompileBindings(manager);
+        }
+
+        const InputBindingTable* table = &manager->table;
+
+        // Keys
+        for (int i = 0; i < table->boundKeyCount; i++) {
+            int key = table->boundKeys[i];
+            uint32_t keyBit = 1u << (key & 31);
+            if (keysPolled[key >> 5] & keyBit) continue;
+
+            keysPolled[key >> 5] |= keyBit;
+            if (IsKeyDown(key)) {
+                devices->keysDown[key >> 5] |= keyBit;
+            }
+        }
+
+        for (int pad = 0; pad < MAX_GAMEPADS; pad++) {
+            gamepadButtons[pad] |= table->boundButtons[pad];
+            gamepadAxes[pad] |= table->boundAxes[pad];
+        }
+
+        mouseButtons |= table->boundMouseButtons;
+        mouseAxes |= table->mouseAxesBound;
+        touch |= manager->touchSupported && table->touchActions != 0;
+    }
+
+    // Gamepads
+    for (int pad = 0; pad < MAX_GAMEPADS; pad++) {
+        devices->gamepadAvailable[pad] = IsGamepadAvailable(pad);
+        if (!devices->gamepadAvailable[pad]) continue;
+
+        uint32_t buttons = gamepadButtons[pad];
+        for (int button = 0; buttons != 0; button++, buttons >>= 1) {
+            if ((buttons & 1u) && IsGamepadButtonDown(pad, button)) {
+                devices->gamepadButtons[pad] |= 1u << button;
+            }
+        }
+
+        uint32_t axes = gamepadAxes[pad];
+        for (int axis = 0; axes != 0; axis++, axes >>= 1) {
+            if (axes & 1u) {
+                devices->gamepadAxes[pad][axis] = GetGamepadAxisMovement(pad, axis);
+            }
+        }
+    }
+
+    // Mouse
+    for (int button = 0; mouseButtons != 0; button++, mouseButtons >>= 1) {
+        if ((mouseButtons & 1u) && IsMouseButtonDown(button)) {
+            devices->mouseButtons |= 1u << button;
+        }
+    }
+
+    if (mouseAxes) {
+        Vector2 mouseDelta = GetMouseDelta();
+        devices->mouseAxes[0] = mouseDelta.x / 10.0f; // Scale as needed
+        devices->mouseAxes[1] = mouseDelta.y / 10.0f; // Scale as needed
+        devices->mouseAxes[2] = GetMouseWheelMove();
+    }
+
+    // Touch
+    if (touch && GetTouchPointCount() > 0) {
+        devices->touchActive = true;
+        devices->touchPosition = GetTouchPosition(0);
+        devices->screenWidth = (float)GetScreenWidth();
+        devices->screenHeight = (float)GetScreenHeight();
+    }
+
+    // Keys pressed since the last poll, including ones already released
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+        if (key < 0 || key >= INPUT_MAX_KEYS) continue;
+        if (devices->pressedKeyCount >= INPUT_MAX_PRESSED_KEYS) continue;
+
+        devices->pressedKeys[devices->pressedKeyCount++] = key;
+    }
+}
+
+/**
+ * @brief Resolve polled devices to actions and queue the changes as events
+ *
+ * Digital inputs are resolved to actions with the compiled bitmasks;
+ * analog inputs are matched against the compiled axis bindings. The
+ * result is compared with the previous poll and every difference is
+ * queued as an event.
+ *
+ * @param manager Pointer to input manager
+ * @param devices Device state from InputPollDevices
+ */
+void InputManagerApplyDevices(InputManager* manager, const InputDeviceState* devices) {
+    if (!manager || !devices) return;
+
+    // Recompile the lookup tables if bindings changed since the poll
+    if (manager->bindingsDirty) {
+        InputManagerCompileBindings(manager);
+    }
+
+    const InputBindingTable* table = &manager->table;
+    float values[ACTION_COUNT] = { 0 };
+
+    // Update gamepad connection status
+    manager->gamepadsConnected = 0;
+    for (int i = 0; i < MAX_GAMEPADS; i++) {
+        if (devices->gamepadAvailable[i]) {
+            manager->gamepadsConnected++;
+        }
+    }
+
+    // Keys
+    InputActionMask digitalActions = 0;
+    for (int i = 0; i < table->boundKeyCount; i++) {
+        int key = table->boundKeys[i];
+        if (devices->keysDown[key >> 5] & (1u << (key & 31))) {
+            digitalActions |= table->keyActions[key];
+        }
+    }
+
+    // Gamepad buttons
+    for (int pad = 0; pad < MAX_GAMEPADS; pad++) {
+        uint32_t buttons = table->boundButtons[pad] & devices->gamepadButtons[pad];
+        for (int button = 0; buttons != 0; button++, buttons >>= 1) {
+            if (buttons & 1u) {
+                digitalActions |= table->buttonActions[pad][button];
+            }
+        }
+    }
+
+    // Mouse buttons
+    uint32_t mouseButtons = table->boundMouseButtons & devices->mouseButtons;
+    for (int button = 0; mouseButtons != 0; button++, mouseButtons >>= 1) {
+        if (mouseButtons & 1u) {
+            digitalActions |= table->mouseButtonActions[button];
+        }
+    }
+
+    // Touch zones, built from the screen size at the poll
+    if (manager->touchSupported && table->touchActions != 0 && devices->touchActive) {
+        float screenWidth = devices->screenWidth;
+        float screenHeight = devices->screenHeight;
+
+        Rectangle touchZones[INPUT_TOUCH_ZONE_COUNT] = {
+            { 0, 0, screenWidth / 4, screenHeight },                       // Left zone
+            { screenWidth * 3 / 4, 0, screenWidth / 4, screenHeight },     // Right zone
+            { 0, 0, screenWidth, screenHeight / 4 },                       // Up zone
+            { 0, screenHeight * 3 / 4, screenWidth, screenHeight / 4 }     // Down zone
+        };
+
+        for (int zone = 0; zone < INPUT_TOUCH_ZONE_COUNT; zone++) {
+            if (table->touchZoneActions[zone] != 0 && CheckCollisionPointRec(devices->touchPosition, touchZones[zone])) {
+                digitalActions |= table->touchZoneActions[zone];
+            }
+        }
+    }
+
+    // Digital inputs are either fully on or off
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        if (digitalActions & ((InputActionMask)1 << action)) {
+            values[action] = 1.0f;
+        }
+    }
+
+    // Analog bindings
+    InputActionMask analogActions = 0;
+    for (int i = 0; i < table->axisCount; i++) {
+        const InputAxisBinding* binding = &table->axes[i];
+        bool isActive = false;
+        float value = 0.0f;
+
+        if (binding->deviceType == INPUT_DEVICE_GAMEPAD) {
+            if (!devices->gamepadAvailable[binding->deviceId]) continue;
+
+            float axisValue = devices->gamepadAxes[binding->deviceId][binding->inputId];
+
+            // Apply deadzone and threshold
+            if (binding->axisPositive && axisValue > binding->axisThreshold) {
+                isActive = true;
+                value = (axisValue - binding->axisThreshold) / (1.0f - binding->axisThreshold);
+            }
+            else if (!binding->axisPositive && axisValue < -binding->axisThreshold) {
+                isActive = true;
+                value = (-axisValue - binding->axisThreshold) / (1.0f - binding->axisThreshold);
+            }
+        }
+        else {
+            value = devices->mouseAxes[binding->inputId];
+            isActive = fabsf(value) > binding->axisThreshold;
+        }
+
         if (isActive) {
-            manager->actionStates[binding->action] = true;
+            analogActions |= (InputActionMask)1 << binding->action;
+
+            // Take highest value if multiple bindings affect same action
+            if (fabsf(value) > fabsf(values[binding->action])) {
+                values[binding->action] = value;
+            }
+        }
+    }
+
+    InputActionMask states = digitalActions | analogActions;
+
+    // Changes happened some time since the last poll; the midpoint is
+    // the best estimate without OS event timestamps
+    double now = devices->time;
+    double eventTime = manager->lastPollTime > 0.0 ? (manager->lastPollTime + now) * 0.5 : now;
+    manager->lastPollTime = now;
+
+    InputActionMask pressed = states & ~manager->deviceStates;
+    InputActionMask released = ~states & manager->deviceStates;
+
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        InputActionMask actionBit = (InputActionMask)1 << action;
+
+        if (pressed & actionBit) {
+            InputManagerPushEvent(manager, INPUT_EVENT_PRESS, (GameAction)action, values[action], eventTime);
+        }
+        else if (released & actionBit) {
+            InputManagerPushEvent(manager, INPUT_EVENT_RELEASE, (GameAction)action, 0.0f, eventTime);
+        }
+        else if ((states & actionBit) && values[action] != manager->deviceValues[action]) {
+            InputManagerPushEvent(manager, INPUT_EVENT_AXIS, (GameAction)action, values[action], eventTime);
+        }
+    }
 
-            // Update action value (take highest value if multiple bindings affect same action)
-            if (fabs(value) > fabs(manager->actionValues[binding->action])) {
-                manager->actionValues[binding->action] = value;
+    // Keys pressed and released between two polls are only in the key queue
+    for (int i = 0; i < devices->pressedKeyCount; i++) {
+        int key = devices->pressedKeys[i];
+
+        InputActionMask tapped = table->keyActions[key] & ~states & ~manager->deviceStates;
+        for (int action = 0; tapped != 0; action++, tapped >>= 1) {
+            if (tapped & 1u) {
+                InputManagerPushEvent(manager, INPUT_EVENT_PRESS, (GameAction)action, 1.0f, eventTime);
+                InputManagerPushEvent(manager, INPUT_EVENT_RELEASE, (GameAction)action, 0.0f, eventTime);
             }
         }
     }
+
+    manager->deviceStates = states;
+    memcpy(manager->deviceValues, values, sizeof(values));
+}
+
+/**
+ * @brief Poll input devices and queue the changes as events
+ *
+ * Shortcut for a single manager; with several managers, poll once with
+ * InputPollDevices and apply the result to each.
+ *
+ * @param manager Pointer to input manager
+ */
+void InputManagerUpdate(InputManager* manager) {
+    if (!manager) return;
+
+    InputDeviceState devices;
+    InputPollDevices(&devices, &manager, 1);
+    InputManagerApplyDevices(manager, &devices);
+}
+
+/**
+ * @brief Apply an event to the action states
+ *
+ * @param manager Pointer to input manager
+ * @param event Event to apply
+ */
+static void InputManagerApplyEvent(InputManager* manager, const InputEvent* event) {
+    InputActionMask actionBit = (InputActionMask)1 << event->action;
+
+    switch (event->type) {
+    case INPUT_EVENT_PRESS:
+        manager->actionStates |= actionBit;
+        manager->actionValues[event->action] = event->value;
+        break;
+
+    case INPUT_EVENT_RELEASE:
+        manager->actionStates &= ~actionBit;
+        manager->actionValues[event->action] = 0.0f;
+        break;
+
+    case INPUT_EVENT_AXIS:
+        manager->actionValues[event->action] = event->value;
+        break;
+
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Queue an input event
+ *
+ * @param manager Pointer to input manager
+ * @param type Event type
+ * @param action Game action
+ * @param value Analog value after the event
+ * @param time When the event happened (GetTime clock)
+ */
+void InputManagerPushEvent(InputManager* manager, InputEventType type, GameAction action, float value, double time) {
+    if (!manager || action < 0 || action >= ACTION_COUNT) return;
+
+    InputEventQueue* queue = &manager->events;
+
+    // Apply the oldest event early rather than lose it, so states stay consistent
+    if (queue->count >= INPUT_EVENT_QUEUE_CAPACITY) {
+        TraceLog(LOG_WARNING, "Input event queue full, applying oldest event early");
+        InputManagerApplyEvent(manager, &queue->events[queue->head]);
+        queue->head = (queue->head + 1) % INPUT_EVENT_QUEUE_CAPACITY;
+        queue->count--;
+    }
+
+    InputEvent* event = &queue->events[(queue->head + queue->count) % INPUT_EVENT_QUEUE_CAPACITY];
+    event->time = time;
+    event->type = type;
+    event->action = action;
+    event->value = value;
+    queue->count++;
+}
+
+/**
+ * @brief Advance action states to a point in time
+ *
+ * @param manager Pointer to input manager
+ * @param time Time to advance to (GetTime clock)
+ */
+void InputManagerAdvance(InputManager* manager, double time) {
+    if (!manager) return;
+
+    // Copy current states to previous states
+    manager->prevActionStates = manager->actionStates;
+
+    InputEventQueue* queue = &manager->events;
+    InputActionMask pressedThisStep = 0;
+    InputActionMask releasedThisStep = 0;
+
+    while (queue->count > 0) {
+        const InputEvent* event = &queue->events[queue->head];
+        if (event->time > time) break;
+
+        // A second transition of the same action waits for the next step,
+        // along with everything queued after it
+        InputActionMask actionBit = (InputActionMask)1 << event->action;
+        if (event->type == INPUT_EVENT_PRESS && (releasedThisStep & actionBit)) break;
+        if (event->type == INPUT_EVENT_RELEASE && (pressedThisStep & actionBit)) break;
+
+        if (event->type == INPUT_EVENT_PRESS) pressedThisStep |= actionBit;
+        if (event->type == INPUT_EVENT_RELEASE) releasedThisStep |= actionBit;
+
+        InputManagerApplyEvent(manager, event);
+        queue->head = (queue->head + 1) % INPUT_EVENT_QUEUE_CAPACITY;
+        queue->count--;
+    }
+}
+
+/**
+ * @brief Replace the action states for the next simulation step
+ *
+ * @param manager Pointer to input manager
+ * @param actions New action states
+ * @param values New action values, or NULL for 1.0 on every active action
+ */
+void InputManagerSetActions(InputManager* manager, InputActionMask actions, const float* values) {
+    if (!manager) return;
+
+    manager->prevActionStates = manager->actionStates;
+    manager->actionStates = actions;
+
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        bool isActive = (actions & ((InputActionMask)1 << action)) != 0;
+        if (!isActive) {
+            manager->actionValues[action] = 0.0f;
+        }
+        else {
+            manager->actionValues[action] = values ? values[action] : 1.0f;
+        }
+    }
 }
 
 /**
@@ -317,6 +653,7 @@ bool InputManagerAddBinding(
     binding->axisPositive = axisPositive;
 
     manager->bindingCount++;
+    manager->bindingsDirty = true;
     return true;
 }
 
@@ -350,6 +687,10 @@ int InputManagerRemoveBindings(InputManager* manager, GameAction action) {
         }
     }
 
+    if (removedCount > 0) {
+        manager->bindingsDirty = true;
+    }
+
     return removedCount;
 }
 
@@ -362,7 +703,7 @@ int InputManagerRemoveBindings(InputManager* manager, GameAction action) {
  */
 bool InputManagerIsActionActive(InputManager* manager, GameAction action) {
     if (!manager || action < 0 || action >= ACTION_COUNT) return false;
-    return manager->actionStates[action];
+    return (manager->actionStates >> action) & 1u;
 }
 
 /**
@@ -374,7 +715,8 @@ bool InputManagerIsActionActive(InputManager* manager, GameAction action) {
  */
 bool InputManagerIsActionJustPressed(InputManager* manager, GameAction action) {
     if (!manager || action < 0 || action >= ACTION_COUNT) return false;
-    return manager->actionStates[action] && !manager->prevActionStates[action];
+    InputActionMask pressed = manager->actionStates & ~manager->prevActionStates;
+    return (pressed >> action) & 1u;
 }
 
 /**
@@ -386,7 +728,8 @@ bool InputManagerIsActionJustPressed(InputManager* manager, GameAction action) {
  */
 bool InputManagerIsActionJustReleased(InputManager* manager, GameAction action) {
     if (!manager || action < 0 || action >= ACTION_COUNT) return false;
-    return !manager->actionStates[action] && manager->prevActionStates[action];
+    InputActionMask released = ~manager->actionStates & manager->prevActionStates;
+    return (released >> action) & 1u;
 }
 
 /**
@@ -432,6 +775,36 @@ Vector2 InputManagerGetMovementVector(InputManager* manager) {
     return movement;
 }
 
+/**
+ * @brief Add the default bindings for one gamepad
+ *
+ * @param manager Pointer to input manager
+ * @param gamepad Gamepad number
+ */
+static void InputManagerAddGamepadBindings(InputManager* manager, int gamepad) {
+    float axisThreshold = 0.2f; // Ignore small movements
+
+    // Left stick movement
+    InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_AXIS_LEFT_X, true, axisThreshold, true);
+    InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_AXIS_LEFT_X, true, axisThreshold, false);
+    InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_AXIS_LEFT_Y, true, axisThreshold, true);
+    InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_AXIS_LEFT_Y, true, axisThreshold, false);
+
+    // D-pad movement
+    InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_LEFT_FACE_UP, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_LEFT_FACE_LEFT, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_LEFT_FACE_DOWN, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, false, 0, false);
+
+    // Other gamepad actions
+    InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_SPECIAL, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_INTERACT, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_RIGHT_FACE_LEFT, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_PAUSE, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_MIDDLE_RIGHT, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_MENU, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_MIDDLE_LEFT, false, 0, false);
+    InputManagerAddBinding(manager, ACTION_RESET, INPUT_DEVICE_GAMEPAD, gamepad, GAMEPAD_BUTTON_RIGHT_TRIGGER_1, false, 0, false);
+}
+
 /**
  * @brief Load default bindings
  *
@@ -442,6 +815,7 @@ void InputManagerLoadDefaultBindings(InputManager* manager) {
 
     // Clear existing bindings
     manager->bindingCount = 0;
+    manager->bindingsDirty = true;
 
     // Keyboard bindings
     InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_KEYBOARD, 0, KEY_W, false, 0, false);
@@ -462,27 +836,7 @@ void InputManagerLoadDefaultBindings(InputManager* manager) {
     InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_KEYBOARD, 0, KEY_RIGHT, false, 0, false);
 
     // Gamepad bindings (for first gamepad)
-    float axisThreshold = 0.2f; // Ignore small movements
-
-    // Left stick movement
-    InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_AXIS_LEFT_X, true, axisThreshold, true);
-    InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_AXIS_LEFT_X, true, axisThreshold, false);
-    InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_AXIS_LEFT_Y, true, axisThreshold, true);
-    InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_AXIS_LEFT_Y, true, axisThreshold, false);
-
-    // D-pad movement
-    InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_LEFT_FACE_UP, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_LEFT_FACE_LEFT, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_LEFT_FACE_DOWN, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_LEFT_FACE_RIGHT, false, 0, false);
-
-    // Other gamepad actions
-    InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_RIGHT_FACE_DOWN, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_SPECIAL, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_INTERACT, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_RIGHT_FACE_LEFT, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_PAUSE, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_MIDDLE_RIGHT, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_MENU, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_MIDDLE_LEFT, false, 0, false);
-    InputManagerAddBinding(manager, ACTION_RESET, INPUT_DEVICE_GAMEPAD, 0, GAMEPAD_BUTTON_RIGHT_TRIGGER_1, false, 0, false);
+    InputManagerAddGamepadBindings(manager, 0);
 
     // Mouse bindings
     InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_MOUSE, 0, MOUSE_BUTTON_LEFT, false, 0, false);
@@ -498,6 +852,101 @@ void InputManagerLoadDefaultBindings(InputManager* manager) {
     }
 }
 
+/**
+ * @brief Load default bindings for one of several local players
+ *
+ * @param manager Pointer to input manager
+ * @param playerIndex Local player index
+ * @param playerCount Number of local players
+ */
+void InputManagerLoadPlayerBindings(InputManager* manager, int playerIndex, int playerCount) {
+    if (!manager) return;
+
+    if (playerCount <= 1) {
+        InputManagerLoadDefaultBindings(manager);
+        return;
+    }
+
+    // Clear existing bindings
+    manager->bindingCount = 0;
+    manager->bindingsDirty = true;
+
+    if (playerIndex == 0) {
+        // Left side of the keyboard, the mouse and the game-wide keys
+        InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_KEYBOARD, 0, KEY_W, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_KEYBOARD, 0, KEY_A, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_KEYBOARD, 0, KEY_S, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_KEYBOARD, 0, KEY_D, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_KEYBOARD, 0, KEY_SPACE, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_SPECIAL, INPUT_DEVICE_KEYBOARD, 0, KEY_LEFT_SHIFT, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_INTERACT, INPUT_DEVICE_KEYBOARD, 0, KEY_E, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_PAUSE, INPUT_DEVICE_KEYBOARD, 0, KEY_ESCAPE, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MENU, INPUT_DEVICE_KEYBOARD, 0, KEY_TAB, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_RESET, INPUT_DEVICE_KEYBOARD, 0, KEY_R, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_MOUSE, 0, MOUSE_BUTTON_LEFT, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_SPECIAL, INPUT_DEVICE_MOUSE, 0, MOUSE_BUTTON_RIGHT, false, 0, false);
+    }
+    else if (playerIndex == 1) {
+        // Right side of the keyboard
+        InputManagerAddBinding(manager, ACTION_MOVE_UP, INPUT_DEVICE_KEYBOARD, 0, KEY_UP, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_LEFT, INPUT_DEVICE_KEYBOARD, 0, KEY_LEFT, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_DOWN, INPUT_DEVICE_KEYBOARD, 0, KEY_DOWN, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_MOVE_RIGHT, INPUT_DEVICE_KEYBOARD, 0, KEY_RIGHT, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_ATTACK, INPUT_DEVICE_KEYBOARD, 0, KEY_RIGHT_CONTROL, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_SPECIAL, INPUT_DEVICE_KEYBOARD, 0, KEY_RIGHT_SHIFT, false, 0, false);
+        InputManagerAddBinding(manager, ACTION_INTERACT, INPUT_DEVICE_KEYBOARD, 0, KEY_ENTER, false, 0, false);
+    }
+
+    // Every player has their own gamepad
+    if (playerIndex >= 0 && playerIndex < MAX_GAMEPADS) {
+        InputManagerAddGamepadBindings(manager, playerIndex);
+    }
+}
+
+/**
+ * @brief Store a 16-bit value little-endian
+ *
+ * @param out Destination bytes
+ * @param value Value to store
+ */
+static void InputWriteU16(unsigned char* out, uint16_t value) {
+    out[0] = (unsigned char)(value & 0xFF);
+    out[1] = (unsigned char)(value >> 8);
+}
+
+/**
+ * @brief Store a 32-bit value little-endian
+ *
+ * @param out Destination bytes
+ * @param value Value to store
+ */
+static void InputWriteU32(unsigned char* out, uint32_t value) {
+    out[0] = (unsigned char)(value & 0xFF);
+    out[1] = (unsigned char)((value >> 8) & 0xFF);
+    out[2] = (unsigned char)((value >> 16) & 0xFF);
+    out[3] = (unsigned char)(value >> 24);
+}
+
+/**
+ * @brief Read a little-endian 16-bit value
+ *
+ * @param in Source bytes
+ * @return uint16_t Value
+ */
+static uint16_t InputReadU16(const unsigned char* in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+/**
+ * @brief Read a little-endian 32-bit value
+ *
+ * @param in Source bytes
+ * @return uint32_t Value
+ */
+static uint32_t InputReadU32(const unsigned char* in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
 /**
  * @brief Save bindings to file
  *
@@ -508,23 +957,53 @@ void InputManagerLoadDefaultBindings(InputManager* manager) {
 bool InputManagerSaveBindings(InputManager* manager, const char* filename) {
     if (!manager || !filename) return false;
 
+    size_t fileSize = INPUT_BINDINGS_HEADER_SIZE + (size_t)manager->bindingCount * INPUT_BINDINGS_RECORD_SIZE;
+    unsigned char* buffer = (unsigned char*)calloc(1, fileSize);
+    if (!buffer) {
+        TraceLog(LOG_ERROR, "Failed to allocate binding file buffer");
+        return false;
+    }
+
+    // Header
+    memcpy(buffer, INPUT_BINDINGS_MAGIC, 4);
+    InputWriteU16(buffer + 4, INPUT_BINDINGS_VERSION);
+    InputWriteU16(buffer + 6, INPUT_BINDINGS_RECORD_SIZE);
+    InputWriteU32(buffer + 8, (uint32_t)manager->bindingCount);
+
+    // Records
+    for (int i = 0; i < manager->bindingCount; i++) {
+        const InputBinding* binding = &manager->bindings[i];
+        unsigned char* record = buffer + INPUT_BINDINGS_HEADER_SIZE + (size_t)i * INPUT_BINDINGS_RECORD_SIZE;
+
+        uint32_t thresholdBits;
+        memcpy(&thresholdBits, &binding->axisThreshold, sizeof(thresholdBits));
+
+        record[0] = (unsigned char)binding->action;
+        record[1] = (unsigned char)binding->deviceType;
+        record[2] = (unsigned char)binding->deviceId;
+        record[3] = (unsigned char)((binding->isAxis ? INPUT_BINDING_FLAG_AXIS : 0) |
+            (binding->axisPositive ? INPUT_BINDING_FLAG_POSITIVE : 0));
+        InputWriteU16(record + 4, (uint16_t)binding->inputId);
+        InputWriteU32(record + 8, thresholdBits);
+    }
+
     // Open file for writing
     FILE* file = fopen(filename, "wb");
     if (!file) {
         TraceLog(LOG_ERROR, "Failed to open file for writing: %s", filename);
+        free(buffer);
         return false;
     }
 
-    // Write binding count
-    fwrite(&manager->bindingCount, sizeof(int), 1, file);
+    bool success = fwrite(buffer, 1, fileSize, file) == fileSize;
+    success &= fclose(file) == 0;
+    free(buffer);
 
-    // Write bindings
-    fwrite(manager->bindings, sizeof(InputBinding), manager->bindingCount, file);
-
-    // Close file
-    fclose(file);
+    if (!success) {
+        TraceLog(LOG_ERROR, "Failed to write bindings to file: %s", filename);
+    }
 
-    return true;
+    return success;
 }
 
 /**
@@ -537,50 +1016,83 @@ bool InputManagerSaveBindings(InputManager* manager, const char* filename) {
 bool InputManagerLoadBindings(InputManager* manager, const char* filename) {
     if (!manager || !filename) return false;
 
-    // Open file for reading
-    FILE* file = fopen(filename, "rb");
-    if (!file) {
+    // Read the whole file at once
+    int dataSize = 0;
+    unsigned char* data = LoadFileData(filename, &dataSize);
+    if (!data) {
         TraceLog(LOG_ERROR, "Failed to open file for reading: %s", filename);
         return false;
     }
 
-    // Read binding count
-    int bindingCount;
-    if (fread(&bindingCount, sizeof(int), 1, file) != 1) {
-        TraceLog(LOG_ERROR, "Failed to read binding count from file: %s", filename);
-        fclose(file);
+    // Validate the header and that every record is inside the file
+    uint16_t version = dataSize >= INPUT_BINDINGS_HEADER_SIZE ? InputReadU16(data + 4) : 0;
+    uint16_t recordSize = dataSize >= INPUT_BINDINGS_HEADER_SIZE ? InputReadU16(data + 6) : 0;
+    uint32_t recordCount = dataSize >= INPUT_BINDINGS_HEADER_SIZE ? InputReadU32(data + 8) : 0;
+
+    bool valid = dataSize >= INPUT_BINDINGS_HEADER_SIZE &&
+        memcmp(data, INPUT_BINDINGS_MAGIC, 4) == 0 &&
+        version == INPUT_BINDINGS_VERSION &&
+        recordSize >= INPUT_BINDINGS_RECORD_SIZE &&
+        (uint64_t)recordCount * recordSize <= (uint64_t)(dataSize - INPUT_BINDINGS_HEADER_SIZE);
+
+    if (!valid) {
+        TraceLog(LOG_ERROR, "Invalid or unsupported binding file: %s", filename);
+        UnloadFileData(data);
         return false;
     }
 
-    // Check if we need to expand the bindings array
-    if (bindingCount > manager->bindingCapacity) {
-        InputBinding* newBindings = (InputBinding*)realloc(
-            manager->bindings,
-            sizeof(InputBinding) * bindingCount
-        );
+    // Decode into a new array so a bad file leaves the current bindings alone
+    int capacity = recordCount > 0 ? (int)recordCount : 1;
+    InputBinding* bindings = (InputBinding*)malloc(sizeof(InputBinding) * capacity);
+    if (!bindings) {
+        TraceLog(LOG_ERROR, "Failed to allocate bindings array");
+        UnloadFileData(data);
+        return false;
+    }
 
-        if (!newBindings) {
-            TraceLog(LOG_ERROR, "Failed to expand bindings array");
-            fclose(file);
-            return false;
+    int bindingCount = 0;
+    int skippedCount = 0;
+    for (uint32_t i = 0; i < recordCount; i++) {
+        const unsigned char* record = data + INPUT_BINDINGS_HEADER_SIZE + (size_t)i * recordSize;
+
+        int action = record[0];
+        int deviceType = record[1];
+        int deviceId = record[2];
+        uint32_t thresholdBits = InputReadU32(record + 8);
+
+        float axisThreshold;
+        memcpy(&axisThreshold, &thresholdBits, sizeof(axisThreshold));
+
+        // Skip what this build does not know
+        if (action <= ACTION_NONE || action >= ACTION_COUNT ||
+            deviceType >= INPUT_DEVICE_COUNT ||
+            !(axisThreshold >= 0.0f && axisThreshold < 1.0f)) {
+            skippedCount++;
+            continue;
         }
 
-        manager->bindings = newBindings;
-        manager->bindingCapacity = bindingCount;
+        InputBinding* binding = &bindings[bindingCount++];
+        binding->action = (GameAction)action;
+        binding->deviceType = (InputDeviceType)deviceType;
+        binding->deviceId = deviceId;
+        binding->inputId = InputReadU16(record + 4);
+        binding->isAxis = (record[3] & INPUT_BINDING_FLAG_AXIS) != 0;
+        binding->axisThreshold = axisThreshold;
+        binding->axisPositive = (record[3] & INPUT_BINDING_FLAG_POSITIVE) != 0;
     }
 
-    // Read bindings
-    if (fread(manager->bindings, sizeof(InputBinding), bindingCount, file) != bindingCount) {
-        TraceLog(LOG_ERROR, "Failed to read bindings from file: %s", filename);
-        fclose(file);
-        return false;
+    UnloadFileData(data);
+
+    if (skippedCount > 0) {
+        TraceLog(LOG_WARNING, "Skipped %d unknown bindings in %s", skippedCount, filename);
     }
 
-    // Update binding count
+    // Swap in the loaded bindings
+    free(manager->bindings);
+    manager->bindings = bindings;
+    manager->bindingCapacity = capacity;
     manager->bindingCount = bindingCount;
-
-    // Close file
-    fclose(file);
+    manager->bindingsDirty = true;
 
     return true;
 }
\ No newline at end of file
@@ -9,15 +9,30 @@
 #ifndef MESSY_GAME_INPUT_H
 #define MESSY_GAME_INPUT_H
 
+#include <stdint.h>
 #include <stdbool.h>
 #include "raylib.h"
 
-#define MAX_GAMEPADS 2
+#define MAX_GAMEPADS 4
+#define INPUT_MAX_KEYS 512             // Size of the key lookup table (raylib key codes are below this)
+#define INPUT_MAX_GAMEPAD_BUTTONS 32   // Size of the per-gamepad button lookup table
+#define INPUT_MAX_GAMEPAD_AXES 8       // Gamepad axes that can be bound
+#define INPUT_MAX_MOUSE_BUTTONS 8      // Size of the mouse button lookup table
+#define INPUT_MOUSE_AXIS_COUNT 3       // Mouse X, mouse Y and wheel
+#define INPUT_TOUCH_ZONE_COUNT 4       // Left, right, up and down touch zones
+#define INPUT_EVENT_QUEUE_CAPACITY 256 // Input events buffered between polling and simulation
+#define INPUT_MAX_PRESSED_KEYS 16      // Key presses kept per poll (size of raylib's key queue)
+
+// Binding file identification
+#define INPUT_BINDINGS_MAGIC "MGIB"    // First four bytes of every binding file
+#define INPUT_BINDINGS_VERSION 1       // Bump when the record meaning changes
 
  /**
   * @brief Game actions enumeration
   *
   * Defines all possible game actions that can be triggered by input.
+  * The values are stored in binding files, so new actions must be added
+  * just before ACTION_COUNT.
   */
 typedef enum {
     ACTION_NONE = 0,
@@ -49,6 +64,11 @@ typedef enum {
     INPUT_DEVICE_COUNT
 } InputDeviceType;
 
+/**
+ * @brief Set of game actions, one bit per GameAction
+ */
+typedef uint32_t InputActionMask;
+
 /**
  * @brief Input binding structure
  *
@@ -65,18 +85,116 @@ typedef struct {
     // Add more binding attributes as needed
 } InputBinding;
 
+/**
+ * @brief Compiled analog binding
+ *
+ * Axis bindings keep a threshold and direction, so they cannot be folded
+ * into a bitmask like buttons.
+ */
+typedef struct {
+    GameAction action;           // Game action
+    InputDeviceType deviceType;  // INPUT_DEVICE_GAMEPAD or INPUT_DEVICE_MOUSE
+    int deviceId;                // Gamepad number
+    int inputId;                 // Axis index
+    float axisThreshold;         // Threshold for axis
+    bool axisPositive;           // Whether positive axis triggers action
+} InputAxisBinding;
+
+/**
+ * @brief Bindings compiled into per-device lookup tables
+ *
+ * Rebuilt whenever the bindings change, so that an update only polls the
+ * inputs something is bound to, each once, and resolves digital inputs to
+ * actions with bitwise ORs.
+ */
+typedef struct {
+    InputActionMask keyActions[INPUT_MAX_KEYS];   // Actions triggered by each key
+    int boundKeys[INPUT_MAX_KEYS];                // Keys with at least one binding
+    int boundKeyCount;                            // Number of bound keys
+    InputActionMask buttonActions[MAX_GAMEPADS][INPUT_MAX_GAMEPAD_BUTTONS]; // Actions triggered by each gamepad button
+    uint32_t boundButtons[MAX_GAMEPADS];          // Bit per gamepad button with a binding
+    uint32_t boundAxes[MAX_GAMEPADS];             // Bit per gamepad axis with a binding
+    InputActionMask mouseButtonActions[INPUT_MAX_MOUSE_BUTTONS]; // Actions triggered by each mouse button
+    uint32_t boundMouseButtons;                   // Bit per mouse button with a binding
+    bool mouseAxesBound;                          // Whether any mouse axis has a binding
+    InputActionMask touchZoneActions[INPUT_TOUCH_ZONE_COUNT]; // Actions triggered by each touch zone
+    InputActionMask touchActions;                 // Union of touchZoneActions
+    InputAxisBinding* axes;                       // Analog bindings
+    int axisCount;                                // Number of analog bindings
+    int axisCapacity;                             // Capacity of axes array
+} InputBindingTable;
+
+/**
+ * @brief Raw device state from one poll
+ *
+ * Shared by every input manager, so each device is polled once per frame
+ * however many local players there are.
+ */
+typedef struct {
+    double time;                 // When the devices were polled (GetTime clock)
+    bool gamepadAvailable[MAX_GAMEPADS];     // Whether each gamepad is connected
+    uint32_t keysDown[INPUT_MAX_KEYS / 32];  // Bit per polled key that is down
+    int pressedKeys[INPUT_MAX_PRESSED_KEYS]; // Keys pressed since the last poll
+    int pressedKeyCount;         // Number of pressed keys
+    uint32_t gamepadButtons[MAX_GAMEPADS];   // Bit per polled gamepad button that is down
+    float gamepadAxes[MAX_GAMEPADS][INPUT_MAX_GAMEPAD_AXES]; // Polled gamepad axis values
+    uint32_t mouseButtons;       // Bit per polled mouse button that is down
+    float mouseAxes[INPUT_MOUSE_AXIS_COUNT]; // Mouse X, mouse Y and wheel movement
+    bool touchActive;            // Whether a touch point was polled
+    Vector2 touchPosition;       // Position of the first touch point
+    float screenWidth;           // Screen width at the poll (for touch zones)
+    float screenHeight;          // Screen height at the poll (for touch zones)
+} InputDeviceState;
+
+/**
+ * @brief Input event types
+ */
+typedef enum {
+    INPUT_EVENT_PRESS,           // Action became active
+    INPUT_EVENT_RELEASE,         // Action became inactive
+    INPUT_EVENT_AXIS,            // Analog value of an active action changed
+    INPUT_EVENT_COUNT
+} InputEventType;
+
+/**
+ * @brief Timestamped input event
+ */
+typedef struct {
+    double time;                 // When the event happened (GetTime clock)
+    InputEventType type;         // Event type
+    GameAction action;           // Game action
+    float value;                 // Analog value after the event
+} InputEvent;
+
+/**
+ * @brief Fixed-capacity input event ring buffer
+ */
+typedef struct {
+    InputEvent events[INPUT_EVENT_QUEUE_CAPACITY]; // Event storage
+    int head;                    // Index of oldest event
+    int count;                   // Number of queued events
+} InputEventQueue;
+
 /**
  * @brief Input manager structure
  *
- * Manages input state and bindings.
+ * Manages input state and bindings. Polling the devices turns changes into
+ * timestamped events; the simulation then advances the action states
+ * through those events one fixed step at a time.
  */
 typedef struct {
     InputBinding* bindings;      // Array of input bindings
     int bindingCount;            // Number of bindings
     int bindingCapacity;         // Capacity of bindings array
-    bool* actionStates;          // Current state of each action
-    bool* prevActionStates;      // Previous state of each action
+    bool bindingsDirty;          // Whether table must be recompiled before the next update
+    InputBindingTable table;     // Bindings compiled for fast evaluation
+    InputActionMask actionStates;     // Current state of each action
+    InputActionMask prevActionStates; // Previous state of each action
     float* actionValues;         // Analog values of actions (0.0-1.0)
+    InputActionMask deviceStates;     // Action states at the last device poll
+    float deviceValues[ACTION_COUNT]; // Action values at the last device poll
+    double lastPollTime;         // Time of the last device poll (0 before the first)
+    InputEventQueue events;      // Events not yet consumed by the simulation
     int gamepadsConnected;       // Number of connected gamepads
     bool touchSupported;         // Whether touch is supported
     bool keyboardConnected;      // Whether keyboard is connected
@@ -102,12 +220,68 @@ InputManager* InputManagerCreate(int initialBindingCapacity);
 void InputManagerDestroy(InputManager* manager);
 
 /**
- * @brief Update input state
+ * @brief Poll every input any of the managers is bound to
+ *
+ * @param devices Pointer to device state to fill
+ * @param managers Managers whose bindings decide what is polled
+ * @param managerCount Number of managers
+ */
+void InputPollDevices(InputDeviceState* devices, InputManager* const* managers, int managerCount);
+
+/**
+ * @brief Resolve polled devices to actions and queue the changes as events
+ *
+ * @param manager Pointer to input manager
+ * @param devices Device state from InputPollDevices
+ */
+void InputManagerApplyDevices(InputManager* manager, const InputDeviceState* devices);
+
+/**
+ * @brief Poll input devices and queue the changes as events
+ *
+ * Called once per frame when there is a single manager. Keys pressed and released again since the last
+ * poll are still queued, as a press followed by a release.
  *
  * @param manager Pointer to input manager
  */
 void InputManagerUpdate(InputManager* manager);
 
+/**
+ * @brief Queue an input event
+ *
+ * @param manager Pointer to input manager
+ * @param type Event type
+ * @param action Game action
+ * @param value Analog value after the event
+ * @param time When the event happened (GetTime clock)
+ */
+void InputManagerPushEvent(InputManager* manager, InputEventType type, GameAction action, float value, double time);
+
+/**
+ * @brief Advance action states to a point in time
+ *
+ * Called once per simulation step with the time the step ends at. Applies
+ * every queued event up to that time, except that an action is never both
+ * pressed and released within one step, so short taps are still seen.
+ *
+ * @param manager Pointer to input manager
+ * @param time Time to advance to (GetTime clock)
+ */
+void InputManagerAdvance(InputManager* manager, double time);
+
+/**
+ * @brief Replace the action states for the next simulation step
+ *
+ * Used when the states come from elsewhere than the devices, such as a
+ * remote player or a replayed step. The current states become the
+ * previous ones, as with InputManagerAdvance.
+ *
+ * @param manager Pointer to input manager
+ * @param actions New action states
+ * @param values New action values, or NULL for 1.0 on every active action
+ */
+void InputManagerSetActions(InputManager* manager, InputActionMask actions, const float* values);
+
 /**
  * @brief Add an input binding
  *
@@ -192,9 +366,29 @@ Vector2 InputManagerGetMovementVector(InputManager* manager);
  */
 void InputManagerLoadDefaultBindings(InputManager* manager);
 
+/**
+ * @brief Load default bindings for one of several local players
+ *
+ * Player N gets gamepad N. With more than one player, the keyboard is
+ * split: player 0 keeps WASD and the mouse, player 1 gets the arrow keys.
+ * A single player gets the full default bindings.
+ *
+ * @param manager Pointer to input manager
+ * @param playerIndex Local player index
+ * @param playerCount Number of local players
+ */
+void InputManagerLoadPlayerBindings(InputManager* manager, int playerIndex, int playerCount);
+
 /**
  * @brief Save bindings to file
  *
+ * The file is a 16-byte header followed by one 12-byte record per
+ * binding, all fields little-endian regardless of platform:
+ *
+ *   header: magic[4] | version u16 | recordSize u16 | count u32 | reserved u32
+ *   record: action u8 | device u8 | deviceId u8 | flags u8 | inputId u16 |
+ *           reserved u16 | axisThreshold f32
+ *
  * @param manager Pointer to input manager
  * @param filename Path to save file
  * @return bool Whether save was successful
@@ -204,12 +398,15 @@ bool InputManagerSaveBindings(InputManager* manager, const char* filename);
 /**
  * @brief Load bindings from file
  *
+ * Reads the file in one call and validates it before touching the current
+ * bindings. Records naming actions or devices this build does not know
+ * are skipped; records longer than this build writes are accepted, so
+ * newer files still load.
+ *
  * @param manager Pointer to input manager
  * @param filename Path to bindings file
  * @return bool Whether load was successful
  */
 bool InputManagerLoadBindings(InputManager* manager, const char* filename);
 
-InputManager* GetInputManager(void);
-
 #endif // MESSY_GAME_INPUT_H
\ No newline at end of file
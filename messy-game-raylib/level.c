@@ -0,0 +1,218 @@
+/**
+ * @file level.c
+ * @brief Implementation of binary level file format
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+#include "level.h"
+#include "tile.h"
+
+// Compile-time layout checks: the format must not depend on compiler padding
+typedef char LevelHeaderSizeCheck[(sizeof(LevelFileHeader) == 96) ? 1 : -1];
+typedef char LevelRoomSizeCheck[(sizeof(LevelRoomRecord) == 32) ? 1 : -1];
+typedef char LevelConnectionSizeCheck[(sizeof(LevelConnectionRecord) == 12) ? 1 : -1];
+typedef char LevelSpawnSizeCheck[(sizeof(LevelSpawnRecord) == 16) ? 1 : -1];
+
+/**
+ * @brief Round a size up to the section alignment
+ *
+ * @param size Size in bytes
+ * @return uint64_t Aligned size
+ */
+static uint64_t LevelAlign(uint64_t size) {
+    return (size + (LEVEL_SECTION_ALIGNMENT - 1)) & ~(uint64_t)(LEVEL_SECTION_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Check that a section lies inside the file
+ *
+ * @param offset Section offset in bytes
+ * @param length Section length in bytes
+ * @param fileSize Total file size in bytes
+ * @return true If the section is aligned and in bounds
+ * @return false Otherwise
+ */
+static bool LevelSectionInBounds(uint64_t offset, uint64_t length, uint64_t fileSize) {
+    if (offset % LEVEL_SECTION_ALIGNMENT != 0) return false;
+    return offset <= fileSize && length <= fileSize - offset;
+}
+
+/**
+ * @brief Validate a level file in memory and locate its sections
+ *
+ * @param data Pointer to file contents
+ * @param size Size of file contents in bytes
+ * @param view Pointer to view to fill
+ * @return true If the data is a valid level file
+ * @return false If the data is invalid
+ */
+bool LevelOpenView(void* data, size_t size, LevelView* view) {
+    if (!data || !view) return false;
+
+    // Check header identification
+    if (size < sizeof(LevelFileHeader)) {
+        TraceLog(LOG_ERROR, "Level file too small (%d bytes)", (int)size);
+        return false;
+    }
+
+    const LevelFileHeader* header = (const LevelFileHeader*)data;
+    if (memcmp(header->magic, LEVEL_FILE_MAGIC, 4) != 0) {
+        TraceLog(LOG_ERROR, "Not a level file (bad magic)");
+        return false;
+    }
+
+    if (header->byteOrder != LEVEL_BYTE_ORDER_MARK) {
+        TraceLog(LOG_ERROR, "Level file was written with a different byte order");
+        return false;
+    }
+
+    if (header->version != LEVEL_FILE_VERSION) {
+        TraceLog(LOG_ERROR, "Unsupported level file version %d (expected %d)",
+            header->version, LEVEL_FILE_VERSION);
+        return false;
+    }
+
+    if (header->headerSize != sizeof(LevelFileHeader) || header->fileSize != size) {
+        TraceLog(LOG_ERROR, "Level file header does not match file size");
+        return false;
+    }
+
+    if (header->width <= 0 || header->height <= 0) {
+        TraceLog(LOG_ERROR, "Invalid level dimensions %dx%d", header->width, header->height);
+        return false;
+    }
+
+    // Check every section against the file bounds
+    uint64_t tileBytes = (uint64_t)header->width * (uint64_t)header->height;
+    uint64_t roomBytes = (uint64_t)header->roomCount * sizeof(LevelRoomRecord);
+    uint64_t connectionBytes = (uint64_t)header->connectionCount * sizeof(LevelConnectionRecord);
+    uint64_t spawnBytes = (uint64_t)header->spawnCount * sizeof(LevelSpawnRecord);
+
+    if (!LevelSectionInBounds(header->tilesOffset, tileBytes, size) ||
+        !LevelSectionInBounds(header->roomsOffset, roomBytes, size) ||
+        !LevelSectionInBounds(header->connectionsOffset, connectionBytes, size) ||
+        !LevelSectionInBounds(header->spawnsOffset, spawnBytes, size)) {
+        TraceLog(LOG_ERROR, "Level file section out of bounds");
+        return false;
+    }
+
+    if (header->tilesOffset < sizeof(LevelFileHeader)) {
+        TraceLog(LOG_ERROR, "Level tile section overlaps header");
+        return false;
+    }
+
+    // Point the view into the caller's buffer
+    unsigned char* bytes = (unsigned char*)data;
+    view->header = header;
+    view->tiles = bytes + header->tilesOffset;
+    view->rooms = (const LevelRoomRecord*)(bytes + header->roomsOffset);
+    view->connections = (const LevelConnectionRecord*)(bytes + header->connectionsOffset);
+    view->spawns = (const LevelSpawnRecord*)(bytes + header->spawnsOffset);
+
+    return true;
+}
+
+/**
+ * @brief Write a level file
+ *
+ * @param filename Path to save file
+ * @param header Pointer to header with dimensions, counts and metadata set
+ * @param tiles Tile section (header->width * header->height bytes)
+ * @param rooms Room records (header->roomCount entries)
+ * @param connections Connection records (header->connectionCount entries)
+ * @param spawns Spawn records (header->spawnCount entries)
+ * @return true If the file was written
+ * @return false If writing failed
+ */
+bool LevelWriteFile(
+    const char* filename,
+    LevelFileHeader* header,
+    const unsigned char* tiles,
+    const LevelRoomRecord* rooms,
+    const LevelConnectionRecord* connections,
+    const LevelSpawnRecord* spawns
+) {
+    if (!filename || !header || !tiles) return false;
+    if (header->width <= 0 || header->height <= 0) return false;
+    if ((header->roomCount && !rooms) || (header->connectionCount && !connections) ||
+        (header->spawnCount && !spawns)) return false;
+
+    // Fill identification fields
+    memcpy(header->magic, LEVEL_FILE_MAGIC, 4);
+    header->version = LEVEL_FILE_VERSION;
+    header->byteOrder = LEVEL_BYTE_ORDER_MARK;
+    header->headerSize = sizeof(LevelFileHeader);
+    memset(header->reserved, 0, sizeof(header->reserved));
+
+    // Lay out the sections
+    uint64_t tileBytes = (uint64_t)header->width * (uint64_t)header->height;
+    uint64_t roomBytes = (uint64_t)header->roomCount * sizeof(LevelRoomRecord);
+    uint64_t connectionBytes = (uint64_t)header->connectionCount * sizeof(LevelConnectionRecord);
+    uint64_t spawnBytes = (uint64_t)header->spawnCount * sizeof(LevelSpawnRecord);
+
+    uint64_t tilesOffset = LevelAlign(sizeof(LevelFileHeader));
+    uint64_t roomsOffset = LevelAlign(tilesOffset + tileBytes);
+    uint64_t connectionsOffset = LevelAlign(roomsOffset + roomBytes);
+    uint64_t spawnsOffset = LevelAlign(connectionsOffset + connectionBytes);
+    uint64_t fileSize = spawnsOffset + spawnBytes;
+
+    if (fileSize > UINT32_MAX) {
+        TraceLog(LOG_ERROR, "Level too large to save (%llu bytes)", (unsigned long long)fileSize);
+        return false;
+    }
+
+    header->tilesOffset = (uint32_t)tilesOffset;
+    header->roomsOffset = (uint32_t)roomsOffset;
+    header->connectionsOffset = (uint32_t)connectionsOffset;
+    header->spawnsOffset = (uint32_t)spawnsOffset;
+    header->fileSize = (uint32_t)fileSize;
+
+    // Assemble the file in memory (zeroed, so padding is deterministic)
+    unsigned char* buffer = (unsigned char*)calloc(1, (size_t)fileSize);
+    if (!buffer) {
+        TraceLog(LOG_ERROR, "Failed to allocate level write buffer");
+        return false;
+    }
+
+    memcpy(buffer, header, sizeof(LevelFileHeader));
+    memcpy(buffer + tilesOffset, tiles, (size_t)tileBytes);
+
+    // Unknown tile types become floor, so loaders can copy the section as-is
+    int unknownTiles = 0;
+    for (uint64_t i = 0; i < tileBytes; i++) {
+        if (buffer[tilesOffset + i] >= TILE_TYPE_COUNT) {
+            buffer[tilesOffset + i] = TILE_TYPE_EMPTY;
+            unknownTiles++;
+        }
+    }
+    if (unknownTiles > 0) {
+        TraceLog(LOG_WARNING, "Wrote %d tiles of unknown type as floor in %s", unknownTiles, filename);
+    }
+    if (roomBytes) memcpy(buffer + roomsOffset, rooms, (size_t)roomBytes);
+    if (connectionBytes) memcpy(buffer + connectionsOffset, connections, (size_t)connectionBytes);
+    if (spawnBytes) memcpy(buffer + spawnsOffset, spawns, (size_t)spawnBytes);
+
+    // Write everything at once
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        TraceLog(LOG_ERROR, "Failed to open level file for writing: %s", filename);
+        free(buffer);
+        return false;
+    }
+
+    bool success = fwrite(buffer, 1, (size_t)fileSize, file) == (size_t)fileSize;
+    fclose(file);
+    free(buffer);
+
+    if (!success) {
+        TraceLog(LOG_ERROR, "Failed to write level file: %s", filename);
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "Saved level %s (%dx%d, %d bytes)",
+        filename, header->width, header->height, (int)fileSize);
+    return true;
+}
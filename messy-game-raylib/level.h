@@ -0,0 +1,158 @@
+/**
+ * @file level.h
+ * @brief Binary level file format
+ *
+ * This file defines the on-disk layout shared by WorldLoad/WorldSave and
+ * RoomLoad/RoomSave. A level file is a fixed header followed by aligned
+ * sections:
+ *
+ *   header | tiles | rooms | connections | spawns
+ *
+ * The tile section is one byte per tile (a TileType), row-major, so the
+ * world's tile grid is a single copy out of the memory-mapped file.
+ * Unknown tile types are turned into floor when the file is written, so
+ * loading never has to look at individual tiles.
+ * All fields are fixed-width and stored in the writer's host byte order;
+ * files written on a machine of the other byte order are rejected on load
+ * (see LEVEL_BYTE_ORDER_MARK).
+ */
+#ifndef MESSY_GAME_LEVEL_H
+#define MESSY_GAME_LEVEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Format identification
+#define LEVEL_FILE_MAGIC "MGLV"          // First four bytes of every level file
+#define LEVEL_FILE_VERSION 1             // Bump when the layout changes
+#define LEVEL_BYTE_ORDER_MARK 0xFEFF     // Reads as 0xFFFE on a foreign-endian machine
+#define LEVEL_SECTION_ALIGNMENT 16       // Every section starts on this boundary
+
+/**
+ * @brief Level-wide flags
+ */
+typedef enum {
+    LEVEL_FLAG_NONE = 0,
+    LEVEL_FLAG_OPEN_WORLD = (1 << 0),    // World is an open area rather than rooms
+    // Add more flags as needed
+} LevelFlags;
+
+/**
+ * @brief Level file header
+ *
+ * Offsets are in bytes from the start of the file.
+ */
+typedef struct {
+    char magic[4];                 // LEVEL_FILE_MAGIC
+    uint16_t version;              // LEVEL_FILE_VERSION
+    uint16_t byteOrder;            // LEVEL_BYTE_ORDER_MARK
+    uint32_t headerSize;           // sizeof(LevelFileHeader)
+    uint32_t fileSize;             // Total file size in bytes
+    int32_t width;                 // World width in tiles
+    int32_t height;                // World height in tiles
+    uint32_t tilesOffset;          // Tile section (width * height bytes)
+    uint32_t roomCount;            // Number of LevelRoomRecord entries
+    uint32_t roomsOffset;          // Room section
+    uint32_t connectionCount;      // Number of LevelConnectionRecord entries
+    uint32_t connectionsOffset;    // Connection section
+    uint32_t spawnCount;           // Number of LevelSpawnRecord entries
+    uint32_t spawnsOffset;         // Spawn section
+    int32_t startRoom;             // Index of the room the level starts in
+    uint32_t flags;                // Combination of LevelFlags
+    float holeX;                   // Win hole X position in pixels
+    float holeY;                   // Win hole Y position in pixels
+    float holeRadius;              // Win hole radius in pixels (0 = no hole)
+    int32_t goalX;                 // Goal area X in tiles
+    int32_t goalY;                 // Goal area Y in tiles
+    int32_t goalWidth;             // Goal area width in tiles (0 = no goal)
+    int32_t goalHeight;            // Goal area height in tiles
+    uint32_t reserved[2];          // Must be zero
+} LevelFileHeader;
+
+/**
+ * @brief Room record
+ */
+typedef struct {
+    int32_t id;                    // Unique room ID
+    int32_t type;                  // RoomType
+    int32_t x;                     // Room X position in world grid
+    int32_t y;                     // Room Y position in world grid
+    int32_t width;                 // Width of room in tiles
+    int32_t height;                // Height of room in tiles
+    uint32_t flags;                // Reserved for room state, must be zero
+    int32_t reserved;              // Must be zero
+} LevelRoomRecord;
+
+/**
+ * @brief Room connection record
+ */
+typedef struct {
+    int32_t fromRoom;              // Index of source room
+    int32_t toRoom;                // Index of destination room
+    int32_t direction;             // ConnectionDirection (single bit)
+} LevelConnectionRecord;
+
+/**
+ * @brief Entity spawn record
+ */
+typedef struct {
+    int32_t type;                  // SpawnType
+    int32_t tileX;                 // Spawn X position in tiles
+    int32_t tileY;                 // Spawn Y position in tiles
+    int32_t param;                 // Type-specific parameter (snake length, or ball count)
+} LevelSpawnRecord;
+
+/**
+ * @brief Validated view into a level file in memory
+ *
+ * All pointers point into the caller's buffer; nothing is copied.
+ */
+typedef struct {
+    const LevelFileHeader* header;             // File header
+    unsigned char* tiles;                      // Tile section
+    const LevelRoomRecord* rooms;              // Room section
+    const LevelConnectionRecord* connections;  // Connection section
+    const LevelSpawnRecord* spawns;            // Spawn section
+} LevelView;
+
+/**
+ * @brief Validate a level file in memory and locate its sections
+ *
+ * Only the header and section bounds are checked; the tile section is
+ * used as-is.
+ *
+ * @param data Pointer to file contents
+ * @param size Size of file contents in bytes
+ * @param view Pointer to view to fill
+ * @return true If the data is a valid level file
+ * @return false If the data is invalid
+ */
+bool LevelOpenView(void* data, size_t size, LevelView* view);
+
+/**
+ * @brief Write a level file
+ *
+ * Fills in the identification fields, section offsets and file size
+ * of the header, then writes all sections in a single write. Unknown
+ * tile types are written as floor.
+ *
+ * @param filename Path to save file
+ * @param header Pointer to header with dimensions, counts and metadata set
+ * @param tiles Tile section (header->width * header->height bytes)
+ * @param rooms Room records (header->roomCount entries)
+ * @param connections Connection records (header->connectionCount entries)
+ * @param spawns Spawn records (header->spawnCount entries)
+ * @return true If the file was written
+ * @return false If writing failed
+ */
+bool LevelWriteFile(
+    const char* filename,
+    LevelFileHeader* header,
+    const unsigned char* tiles,
+    const LevelRoomRecord* rooms,
+    const LevelConnectionRecord* connections,
+    const LevelSpawnRecord* spawns
+);
+
+#endif // MESSY_GAME_LEVEL_H
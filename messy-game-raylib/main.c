@@ -6,20 +6,141 @@
  * and runs the main game loop.
  */
 
+#include <string.h>
+#include <stdlib.h>
 #include "raylib.h"
 #include "game.h"
 #include "config.h"
+#include "texture_cache.h"
+#include "net.h"
+#include "batch_sim.h"
+
+/**
+ * @brief Run the batch match simulator from the command line
+ *
+ * Usage: --simulate matches [--threads n] [--players n] [--balls n]
+ * [--max-time s] [--seed n] [--sweep NAME from to step]. The statistics are written to
+ * stdout as CSV.
+ *
+ * @param argc Number of command-line arguments
+ * @param argv Command-line arguments, with argv[1] being --simulate
+ * @return int Exit status
+ */
+static int RunBatchSimulation(int argc, char** argv) {
+    BatchSimConfig config;
+    BatchSimConfigDefaults(&config);
+
+    if (argc > 2 && argv[2][0] != '-') {
+        config.matches = atoi(argv[2]);
+    }
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            config.threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--players") == 0 && i + 1 < argc) {
+            config.playerCount = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--balls") == 0 && i + 1 < argc) {
+            config.tuning.ballCount = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--max-time") == 0 && i + 1 < argc) {
+            config.maxMatchTime = (float)atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            config.seed = strtoull(argv[++i], NULL, 0);
+        }
+        else if (strcmp(argv[i], "--sweep") == 0 && i + 4 < argc) {
+            config.sweepName = argv[++i];
+            config.sweepFrom = (float)atof(argv[++i]);
+            config.sweepTo = (float)atof(argv[++i]);
+            config.sweepStep = (float)atof(argv[++i]);
+        }
+    }
+
+    if (config.playerCount < 1) config.playerCount = 1;
+    if (config.playerCount > MAX_LOCAL_PLAYERS) config.playerCount = MAX_LOCAL_PLAYERS;
+
+    // Per-event logging from thousands of matches would drown the results
+    SetTraceLogLevel(LOG_WARNING);
+
+    return BatchSimRun(&config, stdout) ? 0 : 1;
+}
 
  /**
   * @brief Application entry point
   *
   * Initializes the game, runs the main loop, and cleans up resources.
+  * With --cook-assets, bakes the texture cache and exits instead; with
+  * --simulate, plays headless bot matches for balancing and exits.
+  * With --server [port], runs the simulation for network clients in a
+  * hidden window; with --connect host[:port], plays on such a server.
+  * --net-latency ms and --net-loss percent hold back and drop outgoing
+  * packets, so prediction can be tested with both on one machine.
+  * --physics-quality low|medium|high picks how many sub-steps and
+  * iterations the collision solver spends; peers must use the same level.
+  * --balls n starts a multi-ball match with n balls in play.
   *
+  * @param argc Number of command-line arguments
+  * @param argv Command-line arguments
   * @return int Exit status
   */
-int main(void) {
+int main(int argc, char** argv) {
+    // Offline asset cook: no window or game needed
+    if (argc > 1 && strcmp(argv[1], "--cook-assets") == 0) {
+        return TextureCacheCookGameAssets() == 0 ? 0 : 1;
+    }
+
+    // Balancing simulation: headless, no window needed either
+    if (argc > 1 && strcmp(argv[1], "--simulate") == 0) {
+        return RunBatchSimulation(argc, argv);
+    }
+
+    // Network role
+    bool server = false;
+    int serverPort = NET_DEFAULT_PORT;
+    const char* connectAddress = NULL;
+    float simulatedLatency = 0.0f;
+    float simulatedLoss = 0.0f;
+    PhysicsQuality physicsQuality = PHYSICS_DEFAULT_QUALITY;
+    int ballCount = BALL_COUNT;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--server") == 0) {
+            server = true;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                serverPort = atoi(argv[++i]);
+            }
+        }
+        else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc) {
+            connectAddress = argv[++i];
+        }
+        else if (strcmp(argv[i], "--net-latency") == 0 && i + 1 < argc) {
+            simulatedLatency = (float)atof(argv[++i]) / 1000.0f;
+        }
+        else if (strcmp(argv[i], "--net-loss") == 0 && i + 1 < argc) {
+            simulatedLoss = (float)atof(argv[++i]) / 100.0f;
+        }
+        else if (strcmp(argv[i], "--physics-quality") == 0 && i + 1 < argc) {
+            if (!PhysicsQualityFromName(argv[++i], &physicsQuality)) {
+                TraceLog(LOG_WARNING, "Unknown physics quality: %s", argv[i]);
+            }
+        }
+        else if (strcmp(argv[i], "--balls") == 0 && i + 1 < argc) {
+            ballCount = atoi(argv[++i]);
+        }
+    }
+
     // Initialize the game
     Game* game = GameCreate(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (game) {
+        PhysicsSolverSetQuality(&game->physics, physicsQuality);
+        game->tuning.ballCount = ballCount;
+    }
+
+    // A dedicated server still needs a window for raylib's frame timing
+    if (server) {
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    }
 
     // Initialize window
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, GAME_TITLE);
@@ -34,6 +155,26 @@ int main(void) {
         return 1;
     }
 
+    // Start networking
+    bool networkStarted = true;
+    if (server) {
+        networkStarted = GameHostServer(game, (uint16_t)serverPort);
+    }
+    else if (connectAddress) {
+        networkStarted = GameConnect(game, connectAddress);
+    }
+
+    if (networkStarted && game->net && (simulatedLatency > 0.0f || simulatedLoss > 0.0f)) {
+        networkStarted = NetSessionSimulateConditions(game->net, simulatedLatency, simulatedLoss);
+    }
+
+    if (!networkStarted) {
+        TraceLog(LOG_ERROR, "Failed to start networking");
+        GameDestroy(game);
+        CloseWindow();
+        return 1;
+    }
+
     // Run the game loop until window should close or game ends
     while (!WindowShouldClose() && game->isRunning) {
         // Update and render game
@@ -15,9 +15,10 @@
   * Initializes match structure with default values
   *
   * @param world Pointer to game world
+  * @param seed Game seed
   * @return Match* Pointer to the created match
   */
-Match* MatchCreate(World* world) {
+Match* MatchCreate(World* world, uint64_t seed) {
     Match* match = (Match*)malloc(sizeof(Match));
     if (!match) {
         TraceLog(LOG_ERROR, "Failed to allocate memory for match");
@@ -34,6 +35,7 @@ Match* MatchCreate(World* world) {
     match->goalCelebrationTime = 0.0f;
     match->goalCelebrationDuration = GOAL_CELEBRATION_DURATION;
     match->isActive = true;
+    MatchSeed(match, seed);
 
     // Initialize goal
     MatchInitializeGoal(match, world);
@@ -42,6 +44,21 @@ Match* MatchCreate(World* world) {
     return match;
 }
 
+/**
+ * @brief Seed the match's random generator
+ *
+ * Celebration effects are drawn from this generator, so the same seed
+ * always reproduces the same sequence.
+ *
+ * @param match Pointer to match
+ * @param seed Game seed
+ */
+void MatchSeed(Match* match, uint64_t seed) {
+    if (!match) return;
+
+    RngSeed(&match->rng, seed, RNG_STREAM_MATCH);
+}
+
 /**
  * @brief Destroy match and free resources
  *
@@ -637,42 +654,24 @@ void MatchInitializeGoal(Match* match, World* world) {
         (goalHeightTiles - 2) * TILE_HEIGHT    // Height minus two tiles for crossbars
     };//*/
 
-    // Clear any existing walls in this area
-    for (int x = 0; x < world->width; x++) {
-        for (int y = 0; y < world->height; y++) {
-            // Only clear walls in the area we'll use for the goal
-            if (x >= goalX && x < goalX + goalWidthTiles &&
-                y >= goalY && y < goalY + goalHeightTiles) {
-                WorldSetTileType(world, x, y, TILE_TYPE_EMPTY);
-            }
-        }
-    }
+    // Clear any existing walls in the area we'll use for the goal
+    WorldEditRegion(world, goalX, goalY, goalWidthTiles, goalHeightTiles, TILE_TYPE_EMPTY);
 
     // Draw the goal frame with walls
     // Top crossbar
-    for (int x = goalX; x < goalX + goalWidthTiles; x++) {
-        WorldSetTileType(world, x, goalY, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, goalX, goalY, goalWidthTiles, 1, TILE_TYPE_WALL);
 
     // Bottom crossbar
-    for (int x = goalX; x < goalX + goalWidthTiles; x++) {
-        WorldSetTileType(world, x, goalY + goalHeightTiles - 1, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, goalX, goalY + goalHeightTiles - 1, goalWidthTiles, 1, TILE_TYPE_WALL);
 
     // Left post
-    for (int y = goalY; y < goalY + goalHeightTiles; y++) {
-        WorldSetTileType(world, goalX, y, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, goalX, goalY, 1, goalHeightTiles, TILE_TYPE_WALL);
 
     // Right post
-    for (int y = goalY; y < goalY + goalHeightTiles; y++) {
-        WorldSetTileType(world, goalX + goalWidthTiles - 1, y, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, goalX + goalWidthTiles - 1, goalY, 1, goalHeightTiles, TILE_TYPE_WALL);
 
     // Additional visual elements - goal line (middle)
-    for (int x = goalX + 2; x < goalX + goalWidthTiles - 2; x++) {
-        WorldSetTileType(world, x, goalY + goalHeightTiles / 2, TILE_TYPE_WALL);
-    }
+    WorldEditRegion(world, goalX + 2, goalY + goalHeightTiles / 2, goalWidthTiles - 4, 1, TILE_TYPE_WALL);
 
     TraceLog(LOG_INFO, "Goal initialized at (%d,%d) with size %dx%d tiles",
         goalX, goalY, goalWidthTiles, goalHeightTiles);
@@ -738,8 +737,8 @@ static void DrawCelebrationParticles(Match* match) {
 
     // Draw celebration particles
     for (int i = 0; i < 20; i++) {
-        float x = GetRandomValue(0, screenWidth);
-        float y = GetRandomValue(0, screenHeight);
+        float x = (float)RngRange(&match->rng, 0, screenWidth);
+        float y = (float)RngRange(&match->rng, 0, screenHeight);
         Color particleColor;
 
         if (match->lastScorer == GOAL_SCORER_PLAYER) {
@@ -749,7 +748,7 @@ static void DrawCelebrationParticles(Match* match) {
             particleColor = RED;
         }
 
-        DrawCircle((int)x, (int)y, GetRandomValue(2, 5), particleColor);
+        DrawCircle((int)x, (int)y, (float)RngRange(&match->rng, 2, 5), particleColor);
     }
 }
 
@@ -13,6 +13,7 @@
 #include "ball.h"
 #include "world.h"
 #include "camera.h" // Required for GameCamera type
+#include "rng.h"
 
  /**
   * @brief Match states enumeration
@@ -65,15 +66,25 @@ typedef struct {
     float goalCelebrationTime;     // Current goal celebration time
     float goalCelebrationDuration; // Duration of goal celebration
     bool isActive;                 // Whether match is active
+    Rng rng;                       // Random generator for celebration effects
 } Match;
 
 /**
  * @brief Create a new match
  *
  * @param world Pointer to game world
+ * @param seed Game seed
  * @return Match* Pointer to the created match
  */
-Match* MatchCreate(World* world);
+Match* MatchCreate(World* world, uint64_t seed);
+
+/**
+ * @brief Seed the match's random generator
+ *
+ * @param match Pointer to match
+ * @param seed Game seed
+ */
+void MatchSeed(Match* match, uint64_t seed);
 
 /**
  * @brief Destroy match and free resources
@@ -0,0 +1,999 @@
+/**
+ * @file net.c
+ * @brief Implementation of server-authoritative network multiplayer
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "net.h"
+#include "player.h"
+#include "camera.h"
+
+// Packet header: protocol id (u32) and packet type (u8)
+#define NET_HEADER_SIZE 5
+// Snapshot packet: header, tick (u32), baseline tick (u32), server time in ms (u32),
+// newest input step applied for the receiving client (u32), fragment index (u8),
+// fragment count (u8), then up to NET_SNAPSHOT_FRAGMENT_SIZE encoded bytes
+#define NET_SNAPSHOT_HEADER_SIZE (NET_HEADER_SIZE + 18)
+// Accept packet: header, entity slot of the client's player (u32)
+#define NET_ACCEPT_SIZE (NET_HEADER_SIZE + 4)
+// Input packet: header, acked tick (u32), newest step (u32), step count (u8),
+// then per step, newest first, the action mask (u32) and a value (s8) per active action
+#define NET_INPUT_HEADER_SIZE (NET_HEADER_SIZE + 9)
+
+/**
+ * @brief Write a 32-bit value in little-endian byte order
+ *
+ * @param data Destination
+ * @param value Value to write
+ */
+static void NetWriteU32(unsigned char* data, uint32_t value) {
+    data[0] = (unsigned char)(value & 0xFF);
+    data[1] = (unsigned char)((value >> 8) & 0xFF);
+    data[2] = (unsigned char)((value >> 16) & 0xFF);
+    data[3] = (unsigned char)((value >> 24) & 0xFF);
+}
+
+/**
+ * @brief Read a little-endian 32-bit value
+ *
+ * @param data Source
+ * @return uint32_t Value read
+ */
+static uint32_t NetReadU32(const unsigned char* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/**
+ * @brief Write a packet header
+ *
+ * @param data Destination
+ * @param type Packet type
+ * @return int Number of bytes written
+ */
+static int NetWriteHeader(unsigned char* data, NetPacketType type) {
+    NetWriteU32(data, NET_PROTOCOL_ID);
+    data[4] = (unsigned char)type;
+    return NET_HEADER_SIZE;
+}
+
+/**
+ * @brief Send a packet, or hold it back when simulating latency
+ *
+ * @param session Pointer to session
+ * @param address Destination
+ * @param data Packet bytes
+ * @param size Packet size
+ */
+static void NetSend(NetSession* session, const PlatformAddress* address, const unsigned char* data, int size) {
+    if (session->simulatedLoss > 0.0f && RngFloat(&session->rng) < session->simulatedLoss) return;
+
+    if (!session->delayed) {
+        PlatformSocketSend(session->socket, address, data, size);
+        return;
+    }
+
+    if (session->delayedCount >= NET_DELAY_QUEUE_CAPACITY) {
+        TraceLog(LOG_WARNING, "Simulated latency queue is full, dropping packet");
+        return;
+    }
+
+    int index = (session->delayedHead + session->delayedCount) % NET_DELAY_QUEUE_CAPACITY;
+    NetDelayedPacket* packet = &session->delayed[index];
+    packet->sendTime = GetTime() + session->simulatedLatency;
+    packet->address = *address;
+    packet->size = size;
+    memcpy(packet->data, data, size);
+    session->delayedCount++;
+}
+
+/**
+ * @brief Send held-back packets that are due
+ *
+ * @param session Pointer to session
+ */
+static void NetFlushDelayed(NetSession* session) {
+    double now = GetTime();
+    while (session->delayedCount > 0) {
+        NetDelayedPacket* packet = &session->delayed[session->delayedHead];
+        if (packet->sendTime > now) break;
+
+        PlatformSocketSend(session->socket, &packet->address, packet->data, packet->size);
+        session->delayedHead = (session->delayedHead + 1) % NET_DELAY_QUEUE_CAPACITY;
+        session->delayedCount--;
+    }
+}
+
+/**
+ * @brief Send a packet that is only a header
+ *
+ * @param session Pointer to session
+ * @param address Destination
+ * @param type Packet type
+ */
+static void NetSendEmpty(NetSession* session, const PlatformAddress* address, NetPacketType type) {
+    unsigned char data[NET_HEADER_SIZE];
+    NetWriteHeader(data, type);
+    NetSend(session, address, data, sizeof(data));
+}
+
+/**
+ * @brief Check whether two addresses are the same
+ *
+ * @param a First address
+ * @param b Second address
+ * @return bool Whether IP and port match
+ */
+static bool NetAddressEqual(const PlatformAddress* a, const PlatformAddress* b) {
+    return a->ip == b->ip && a->port == b->port;
+}
+
+/**
+ * @brief Find a stored snapshot by tick
+ *
+ * @param session Pointer to session
+ * @param tick Snapshot tick
+ * @return NetSnapshot* The snapshot, or NULL if it was never stored or has been overwritten
+ */
+static NetSnapshot* NetSessionFindSnapshot(NetSession* session, uint32_t tick) {
+    if (tick == 0) return NULL;
+
+    NetSnapshot* snapshot = &session->history[tick % NET_SNAPSHOT_HISTORY];
+    return snapshot->tick == tick ? snapshot : NULL;
+}
+
+/**
+ * @brief Find a predicted step by step number
+ *
+ * @param session Pointer to session
+ * @param step Step number
+ * @return NetRollbackFrame* The step, or NULL if it was never predicted or has been overwritten
+ */
+static NetRollbackFrame* NetSessionFindFrame(NetSession* session, uint32_t step) {
+    if (step == 0 || !session->frames) return NULL;
+
+    NetRollbackFrame* frame = &session->frames[step % NET_ROLLBACK_FRAMES];
+    return frame->input.step == step ? frame : NULL;
+}
+
+/**
+ * @brief Create a session with an open socket
+ *
+ * @param mode Session mode
+ * @param port Local UDP port (0 for any)
+ * @return NetSession* Pointer to created session or NULL if failed
+ */
+static NetSession* NetSessionCreate(NetMode mode, uint16_t port) {
+    NetSession* session = (NetSession*)calloc(1, sizeof(NetSession));
+    if (!session) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for network session");
+        return NULL;
+    }
+
+    session->mode = mode;
+    session->entityIndex = -1;
+    session->history = (NetSnapshot*)calloc(NET_SNAPSHOT_HISTORY, sizeof(NetSnapshot));
+    session->snapshotData = (unsigned char*)malloc(NET_MAX_SNAPSHOT_SIZE);
+    if (mode == NET_MODE_CLIENT) {
+        session->frames = (NetRollbackFrame*)calloc(NET_ROLLBACK_FRAMES, sizeof(NetRollbackFrame));
+        session->predicted = (NetSnapshot*)calloc(1, sizeof(NetSnapshot));
+        session->states = SimStateRingCreate(NET_ROLLBACK_FRAMES, 0);
+    }
+
+    if (!session->history || !session->snapshotData || (mode == NET_MODE_CLIENT && (!session->frames || !session->predicted || !session->states))) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for network history");
+        NetSessionDestroy(session);
+        return NULL;
+    }
+
+    session->socket = PlatformSocketOpen(port);
+    if (!session->socket) {
+        TraceLog(LOG_ERROR, "Failed to open UDP socket on port %d", (int)port);
+        NetSessionDestroy(session);
+        return NULL;
+    }
+
+    RngSeed(&session->rng, GAME_DEFAULT_SEED, RNG_STREAM_NETWORK);
+    return session;
+}
+
+/**
+ * @brief Start a server
+ *
+ * @param port UDP port to listen on
+ * @return NetSession* Pointer to created session or NULL if failed
+ */
+NetSession* NetSessionCreateServer(uint16_t port) {
+    NetSession* session = NetSessionCreate(NET_MODE_SERVER, port);
+    if (!session) return NULL;
+
+    TraceLog(LOG_INFO, "Server listening on UDP port %d", (int)port);
+    return session;
+}
+
+/**
+ * @brief Start connecting to a server
+ *
+ * @param address Server host name or address, optionally with ":port"
+ * @return NetSession* Pointer to created session or NULL if failed
+ */
+NetSession* NetSessionCreateClient(const char* address) {
+    if (!address) return NULL;
+
+    PlatformAddress serverAddress;
+    if (!PlatformAddressParse(address, NET_DEFAULT_PORT, &serverAddress)) {
+        TraceLog(LOG_ERROR, "Failed to resolve server address: %s", address);
+        return NULL;
+    }
+
+    NetSession* session = NetSessionCreate(NET_MODE_CLIENT, 0);
+    if (!session) return NULL;
+
+    session->serverAddress = serverAddress;
+    TraceLog(LOG_INFO, "Connecting to %s", address);
+    return session;
+}
+
+/**
+ * @brief Tell the other side we are leaving and free the session
+ *
+ * @param session Pointer to session
+ */
+void NetSessionDestroy(NetSession* session) {
+    if (!session) return;
+
+    if (session->socket) {
+        // Leave without waiting for simulated latency
+        free(session->delayed);
+        session->delayed = NULL;
+        session->simulatedLoss = 0.0f;
+
+        if (session->mode == NET_MODE_SERVER) {
+            for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+                if (session->clients[i].connected) {
+                    NetSendEmpty(session, &session->clients[i].address, NET_PACKET_DISCONNECT);
+                }
+            }
+        }
+        else if (session->connected) {
+            NetSendEmpty(session, &session->serverAddress, NET_PACKET_DISCONNECT);
+        }
+
+        PlatformSocketClose(session->socket);
+    }
+
+    for (int i = 0; i < MAX_LOCAL_PLAYERS; i++) {
+        InputManagerDestroy(session->remoteInputs[i]);
+    }
+
+    free(session->delayed);
+    free(session->predicted);
+    SimStateRingDestroy(session->states);
+    free(session->frames);
+    free(session->snapshotData);
+    free(session->history);
+    free(session);
+}
+
+/**
+ * @brief Hold back and drop outgoing packets, to test on one machine
+ *
+ * @param session Pointer to session
+ * @param latency Seconds every outgoing packet is held back
+ * @param loss Fraction of outgoing packets dropped (0.0 to 1.0)
+ * @return bool Whether the conditions were applied
+ */
+bool NetSessionSimulateConditions(NetSession* session, float latency, float loss) {
+    if (!session) return false;
+
+    if (latency > 0.0f && !session->delayed) {
+        session->delayed = (NetDelayedPacket*)malloc(sizeof(NetDelayedPacket) * NET_DELAY_QUEUE_CAPACITY);
+        if (!session->delayed) {
+            TraceLog(LOG_ERROR, "Failed to allocate simulated latency queue");
+            return false;
+        }
+        session->delayedHead = 0;
+        session->delayedCount = 0;
+    }
+
+    session->simulatedLatency = latency > 0.0f ? latency : 0.0f;
+    session->simulatedLoss = loss < 0.0f ? 0.0f : (loss > 1.0f ? 1.0f : loss);
+
+    TraceLog(LOG_INFO, "Simulating %.0f ms latency and %.0f%% packet loss",
+        session->simulatedLatency * 1000.0f, session->simulatedLoss * 100.0f);
+    return true;
+}
+
+/**
+ * @brief Release everything a client holds and free its slot
+ *
+ * @param game Pointer to game
+ * @param client Pointer to client
+ */
+static void NetServerDropClient(Game* game, NetClient* client) {
+    InputManagerSetActions(game->playerInputs[client->playerIndex], 0, NULL);
+
+    TraceLog(LOG_INFO, "Client for player %d left", client->playerIndex);
+    memset(client, 0, sizeof(NetClient));
+}
+
+/**
+ * @brief Find the entity slot of a player
+ *
+ * @param game Pointer to game
+ * @param player Player entity
+ * @return int Index in game->entities, or -1
+ */
+static int NetFindEntityIndex(Game* game, Entity* player) {
+    for (int i = 0; i < game->entityCount; i++) {
+        if (game->entities[i] == player) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Handle a connection request
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param address Client address
+ */
+static void NetServerHandleConnect(NetSession* session, Game* game, const PlatformAddress* address) {
+    NetClient* client = NULL;
+    int slot = -1;
+
+    // A repeated request means our accept was lost
+    for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+        if (session->clients[i].connected && NetAddressEqual(&session->clients[i].address, address)) {
+            client = &session->clients[i];
+            slot = i;
+            break;
+        }
+    }
+
+    if (!client) {
+        for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+            if (!session->clients[i].connected) {
+                slot = i;
+                break;
+            }
+        }
+
+        // Each client plays the local player with its slot's index
+        while (slot >= 0 && game->playerCount <= slot) {
+            if (!GameAddLocalPlayer(game, PLAYER_TYPE_KNIGHT)) {
+                slot = -1;
+            }
+        }
+
+        if (slot < 0) {
+            TraceLog(LOG_WARNING, "Rejected client: server is full");
+            NetSendEmpty(session, address, NET_PACKET_DISCONNECT);
+            return;
+        }
+
+        client = &session->clients[slot];
+        memset(client, 0, sizeof(NetClient));
+        client->connected = true;
+        client->address = *address;
+        client->playerIndex = slot;
+        TraceLog(LOG_INFO, "Client joined as player %d", slot);
+    }
+
+    client->lastReceiveTime = GetTime();
+
+    unsigned char data[NET_ACCEPT_SIZE];
+    NetWriteHeader(data, NET_PACKET_ACCEPT);
+    NetWriteU32(data + NET_HEADER_SIZE, (uint32_t)NetFindEntityIndex(game, game->players[client->playerIndex]));
+    NetSend(session, address, data, sizeof(data));
+}
+
+/**
+ * @brief Handle an input packet
+ *
+ * @param session Pointer to session
+ * @param client Sending client
+ * @param data Packet bytes
+ * @param size Packet size
+ */
+static void NetServerHandleInput(NetSession* session, NetClient* client, const unsigned char* data, int size) {
+    if (size < NET_INPUT_HEADER_SIZE) return;
+
+    uint32_t ackedTick = NetReadU32(data + NET_HEADER_SIZE);
+    uint32_t newestStep = NetReadU32(data + NET_HEADER_SIZE + 4);
+    int count = data[NET_HEADER_SIZE + 8];
+    if (count == 0 || newestStep < (uint32_t)count) return;
+
+    if (ackedTick > client->ackedTick && ackedTick <= session->tick) {
+        client->ackedTick = ackedTick;
+    }
+
+    // The first steps we hear of are where this client's input starts
+    if (client->receivedStep == 0) {
+        client->appliedStep = newestStep - count;
+    }
+
+    int offset = NET_INPUT_HEADER_SIZE;
+    for (int i = 0; i < count; i++) {
+        if (offset + 4 > size) return;
+
+        uint32_t step = newestStep - (uint32_t)i;
+        InputActionMask actions = NetReadU32(data + offset);
+        offset += 4;
+
+        float values[ACTION_COUNT] = { 0 };
+        for (int action = 0; action < ACTION_COUNT; action++) {
+            if (!(actions & ((InputActionMask)1 << action))) continue;
+            if (offset >= size) return;
+
+            values[action] = (float)(signed char)data[offset++] / 127.0f;
+        }
+
+        // Steps already applied, or already buffered, arrive again on purpose
+        if (step <= client->appliedStep) continue;
+
+        NetInputFrame* frame = &client->inputs[step % NET_INPUT_BUFFER];
+        if (frame->step == step) continue;
+
+        frame->step = step;
+        frame->actions = actions;
+        memcpy(frame->values, values, sizeof(values));
+        if (step > client->receivedStep) {
+            client->receivedStep = step;
+        }
+    }
+}
+
+/**
+ * @brief Handle every packet that arrived at a server
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+static void NetServerReceive(NetSession* session, Game* game) {
+    PlatformAddress address;
+    int size;
+    while ((size = PlatformSocketReceive(session->socket, &address, session->packet, NET_MAX_PACKET_SIZE)) > 0) {
+        if (size < NET_HEADER_SIZE || NetReadU32(session->packet) != NET_PROTOCOL_ID) continue;
+
+        NetPacketType type = (NetPacketType)session->packet[4];
+        if (type == NET_PACKET_CONNECT) {
+            NetServerHandleConnect(session, game, &address);
+            continue;
+        }
+
+        NetClient* client = NULL;
+        for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+            if (session->clients[i].connected && NetAddressEqual(&session->clients[i].address, &address)) {
+                client = &session->clients[i];
+                break;
+            }
+        }
+        if (!client) continue;
+
+        client->lastReceiveTime = GetTime();
+
+        if (type == NET_PACKET_INPUT) {
+            NetServerHandleInput(session, client, session->packet, size);
+        }
+        else if (type == NET_PACKET_DISCONNECT) {
+            NetServerDropClient(game, client);
+        }
+    }
+
+    // Drop clients that went silent
+    double now = GetTime();
+    for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+        NetClient* client = &session->clients[i];
+        if (client->connected && now - client->lastReceiveTime > NET_TIMEOUT) {
+            TraceLog(LOG_WARNING, "Client for player %d timed out", client->playerIndex);
+            NetServerDropClient(game, client);
+        }
+    }
+}
+
+/**
+ * @brief Apply the next input step of every client and run the step
+ *
+ * A client whose next step has not arrived keeps its last input.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+static void NetServerStep(NetSession* session, Game* game, float deltaTime) {
+    for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+        NetClient* client = &session->clients[i];
+        if (!client->connected || client->receivedStep == 0) continue;
+
+        // Catch up after a stall rather than stay behind for good
+        if (client->receivedStep - client->appliedStep > NET_INPUT_MAX_BACKLOG) {
+            client->appliedStep = client->receivedStep - 1;
+        }
+
+        uint32_t next = client->appliedStep + 1;
+        NetInputFrame* frame = &client->inputs[next % NET_INPUT_BUFFER];
+        if (frame->step != next) continue;
+
+        InputManagerSetActions(game->playerInputs[client->playerIndex], frame->actions, frame->values);
+        client->appliedStep = next;
+    }
+
+    GameSimulationStep(game, deltaTime);
+}
+
+/**
+ * @brief Send a snapshot to every client if one is due
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+static void NetServerSend(NetSession* session, Game* game) {
+    double now = GetTime();
+    if (now < session->nextSendTime) return;
+
+    session->nextSendTime += 1.0 / NET_SNAPSHOT_RATE;
+    if (session->nextSendTime < now) {
+        session->nextSendTime = now + 1.0 / NET_SNAPSHOT_RATE;
+    }
+
+    // Capture once; every client gets the same snapshot against its own baseline
+    session->tick++;
+    NetSnapshot* snapshot = &session->history[session->tick % NET_SNAPSHOT_HISTORY];
+    NetSnapshotCapture(snapshot, game);
+    snapshot->tick = session->tick;
+    snapshot->time = game->simulationTime;
+
+    for (int i = 0; i < NET_MAX_CLIENTS; i++) {
+        NetClient* client = &session->clients[i];
+        if (!client->connected) continue;
+
+        NetSnapshot* baseline = NetSessionFindSnapshot(session, client->ackedTick);
+
+        int size = NetSnapshotWrite(snapshot, baseline, session->snapshotData, NET_MAX_SNAPSHOT_SIZE);
+        if (size < 0) {
+            TraceLog(LOG_WARNING, "Snapshot %u is larger than %d bytes", snapshot->tick, NET_MAX_SNAPSHOT_SIZE);
+            continue;
+        }
+
+        // Split the snapshot across as many packets as it needs
+        int fragmentCount = (size + NET_SNAPSHOT_FRAGMENT_SIZE - 1) / NET_SNAPSHOT_FRAGMENT_SIZE;
+        if (fragmentCount < 1) fragmentCount = 1;
+
+        for (int fragment = 0; fragment < fragmentCount; fragment++) {
+            int offset = fragment * NET_SNAPSHOT_FRAGMENT_SIZE;
+            int length = size - offset < NET_SNAPSHOT_FRAGMENT_SIZE ? size - offset : NET_SNAPSHOT_FRAGMENT_SIZE;
+
+            unsigned char* data = session->packet;
+            NetWriteHeader(data, NET_PACKET_SNAPSHOT);
+            NetWriteU32(data + NET_HEADER_SIZE, snapshot->tick);
+            NetWriteU32(data + NET_HEADER_SIZE + 4, baseline ? baseline->tick : 0);
+            NetWriteU32(data + NET_HEADER_SIZE + 8, (uint32_t)llround(snapshot->time * 1000.0));
+            NetWriteU32(data + NET_HEADER_SIZE + 12, client->appliedStep);
+            data[NET_HEADER_SIZE + 16] = (unsigned char)fragment;
+            data[NET_HEADER_SIZE + 17] = (unsigned char)fragmentCount;
+            memcpy(data + NET_SNAPSHOT_HEADER_SIZE, session->snapshotData + offset, length);
+
+            NetSend(session, &client->address, data, NET_SNAPSHOT_HEADER_SIZE + length);
+        }
+    }
+}
+
+/**
+ * @brief Get our own player entity
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @return Entity* Our player (player 0 until the server has told us ours)
+ */
+static Entity* NetClientOwnPlayer(NetSession* session, Game* game) {
+    if (session->entityIndex >= 0 && session->entityIndex < game->entityCount) {
+        Entity* player = game->entities[session->entityIndex];
+        if (player && player->type == ENTITY_PLAYER) return player;
+    }
+    return game->player;
+}
+
+/**
+ * @brief Drive every player with the input we expect for them
+ *
+ * Our player follows our own input. Other players repeat the input the
+ * newest snapshot reported for them.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+static void NetClientAssignInputs(NetSession* session, Game* game) {
+    NetSnapshot* latest = NetSessionFindSnapshot(session, session->tick);
+    Entity* ownPlayer = NetClientOwnPlayer(session, game);
+
+    for (int i = 0; i < game->playerCount; i++) {
+        Entity* player = game->players[i];
+        if (!player) continue;
+
+        if (player == ownPlayer) {
+            PlayerSetInput(player, game->input);
+            continue;
+        }
+
+        if (!session->remoteInputs[i]) {
+            session->remoteInputs[i] = InputManagerCreate(1);
+            if (!session->remoteInputs[i]) continue;
+        }
+
+        InputActionMask actions = 0;
+        int slot = NetFindEntityIndex(game, player);
+        if (latest && slot >= 0 && slot < latest->entityCount) {
+            actions = latest->entities[slot].actions;
+        }
+
+        PlayerSetInput(player, session->remoteInputs[i]);
+        InputManagerSetActions(session->remoteInputs[i], actions, NULL);
+    }
+}
+
+/**
+ * @brief Run one predicted step and save it for rollback
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+static void NetClientStep(NetSession* session, Game* game, float deltaTime) {
+    NetClientAssignInputs(session, game);
+    GameSimulationStep(game, deltaTime);
+
+    session->step++;
+    NetRollbackFrame* frame = &session->frames[session->step % NET_ROLLBACK_FRAMES];
+    frame->input.step = session->step;
+    frame->input.actions = game->input ? game->input->actionStates : 0;
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        frame->input.values[action] = game->input ? game->input->actionValues[action] : 0.0f;
+    }
+    SimStateRingSave(session->states, session->step, game);
+}
+
+/**
+ * @brief Re-simulate the steps after a corrected one
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game (holding the corrected state of fromStep)
+ * @param fromStep Corrected step
+ */
+static void NetClientResimulate(NetSession* session, Game* game, uint32_t fromStep) {
+    NetRollbackFrame* base = NetSessionFindFrame(session, fromStep);
+    InputManager* input = game->input;
+    if (!base || !input) return;
+
+    // Our input as it was after the corrected step
+    input->actionStates = base->input.actions;
+    memcpy(input->actionValues, base->input.values, sizeof(float) * ACTION_COUNT);
+
+    int count = 0;
+    for (uint32_t step = fromStep + 1; step <= session->step; step++) {
+        NetRollbackFrame* frame = NetSessionFindFrame(session, step);
+        if (!frame) break;
+
+        NetClientAssignInputs(session, game);
+        InputManagerSetActions(input, frame->input.actions, frame->input.values);
+        GameSimulationStep(game, SIM_FIXED_TIMESTEP);
+        SimStateRingSave(session->states, step, game);
+        count++;
+    }
+
+    TraceLog(LOG_DEBUG, "Rolled back to step %u and re-simulated %d steps", fromStep, count);
+}
+
+/**
+ * @brief Check whether another player's reported input has changed
+ *
+ * @param session Pointer to session
+ * @param previous Previous newest snapshot (or NULL)
+ * @param snapshot New snapshot
+ * @return bool Whether any other player's actions differ
+ */
+static bool NetClientRemoteInputChanged(NetSession* session, const NetSnapshot* previous, const NetSnapshot* snapshot) {
+    for (int i = 0; i < snapshot->entityCount; i++) {
+        if (i == session->entityIndex || snapshot->entities[i].type != ENTITY_PLAYER + 1) continue;
+
+        InputActionMask before = previous && i < previous->entityCount ? previous->entities[i].actions : 0;
+        if (snapshot->entities[i].actions != before) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Correct our prediction with a snapshot
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param previous Previous newest snapshot (or NULL)
+ * @param snapshot New snapshot
+ * @param appliedStep Newest of our steps the server had applied
+ */
+static void NetClientReconcile(NetSession* session, Game* game, const NetSnapshot* previous, const NetSnapshot* snapshot, uint32_t appliedStep) {
+    if (appliedStep > session->ackedStep) {
+        session->ackedStep = appliedStep;
+    }
+
+    NetRollbackFrame* frame = NetSessionFindFrame(session, appliedStep);
+    if (!frame || !SimStateRingRestore(session->states, appliedStep, game)) {
+        // Nothing to replay from; take the server's state as it is
+        NetSnapshotApply(game, NULL, snapshot, 1.0f);
+        return;
+    }
+
+    // Compare what we predicted for that step with what the server got.
+    // Our own actions are left out, since the live input manager has moved on.
+    NetSnapshotCapture(session->predicted, game);
+    for (int i = 0; i < session->predicted->entityCount && i < snapshot->entityCount; i++) {
+        session->predicted->entities[i].actions = snapshot->entities[i].actions;
+    }
+
+    if (NetSnapshotEqual(session->predicted, snapshot) && !NetClientRemoteInputChanged(session, previous, snapshot)) {
+        SimStateRingRestore(session->states, session->step, game);
+        return;
+    }
+
+    NetSnapshotApply(game, NULL, snapshot, 1.0f);
+    SimStateRingSave(session->states, appliedStep, game);
+    NetClientResimulate(session, game, appliedStep);
+}
+
+/**
+ * @brief Handle a snapshot packet
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param data Packet bytes
+ * @param size Packet size
+ */
+static void NetClientHandleSnapshot(NetSession* session, Game* game, const unsigned char* data, int size) {
+    if (size < NET_SNAPSHOT_HEADER_SIZE) return;
+
+    uint32_t tick = NetReadU32(data + NET_HEADER_SIZE);
+    uint32_t baselineTick = NetReadU32(data + NET_HEADER_SIZE + 4);
+    uint32_t timeMs = NetReadU32(data + NET_HEADER_SIZE + 8);
+    uint32_t appliedStep = NetReadU32(data + NET_HEADER_SIZE + 12);
+    int fragment = data[NET_HEADER_SIZE + 16];
+    int fragmentCount = data[NET_HEADER_SIZE + 17];
+    int length = size - NET_SNAPSHOT_HEADER_SIZE;
+
+    // Late and duplicate snapshots are of no use
+    if (tick <= session->tick) return;
+
+    // Every fragment but the last is full
+    if (fragmentCount < 1 || fragmentCount > NET_MAX_SNAPSHOT_FRAGMENTS || fragment >= fragmentCount) return;
+    if (length > NET_SNAPSHOT_FRAGMENT_SIZE || (fragment < fragmentCount - 1 && length != NET_SNAPSHOT_FRAGMENT_SIZE)) return;
+
+    // A newer snapshot replaces one still missing fragments
+    if (tick != session->fragmentTick) {
+        if (tick < session->fragmentTick) return;
+
+        session->fragmentTick = tick;
+        session->fragmentMask = 0;
+        session->fragmentCount = fragmentCount;
+        session->snapshotSize = 0;
+    }
+    if (fragmentCount != session->fragmentCount) return;
+
+    memcpy(session->snapshotData + fragment * NET_SNAPSHOT_FRAGMENT_SIZE, data + NET_SNAPSHOT_HEADER_SIZE, length);
+    session->fragmentMask |= 1u << fragment;
+    if (fragment == fragmentCount - 1) {
+        session->snapshotSize = fragment * NET_SNAPSHOT_FRAGMENT_SIZE + length;
+    }
+    if (session->fragmentMask != (1u << fragmentCount) - 1u) return;
+
+    // Without the baseline the differences cannot be applied; the server
+    // sends a full snapshot once our acknowledgement moves past it
+    NetSnapshot* baseline = NetSessionFindSnapshot(session, baselineTick);
+    if (baselineTick != 0 && !baseline) return;
+
+    NetSnapshot* snapshot = &session->history[tick % NET_SNAPSHOT_HISTORY];
+    if (!NetSnapshotRead(snapshot, baseline, session->snapshotData, session->snapshotSize)) {
+        TraceLog(LOG_WARNING, "Dropped malformed snapshot %u", tick);
+        snapshot->tick = 0;
+        return;
+    }
+
+    NetSnapshot* previous = NetSessionFindSnapshot(session, session->tick);
+
+    snapshot->tick = tick;
+    snapshot->time = timeMs / 1000.0;
+    session->tick = tick;
+
+    NetClientReconcile(session, game, previous, snapshot, appliedStep);
+}
+
+/**
+ * @brief Point the camera at our own player
+ *
+ * Player order stays the same as on the server, so the simulation treats
+ * every player the same way on both sides.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+static void NetClientFocusPlayer(NetSession* session, Game* game) {
+    Entity* ownPlayer = NetClientOwnPlayer(session, game);
+    if (ownPlayer && game->camera && game->camera->target != ownPlayer) {
+        CameraFollowTarget(game->camera, ownPlayer);
+    }
+}
+
+/**
+ * @brief Forget the server and its snapshots
+ *
+ * @param session Pointer to session
+ */
+static void NetClientReset(NetSession* session) {
+    session->connected = false;
+    session->entityIndex = -1;
+    session->tick = 0;
+    session->ackedStep = 0;
+    session->fragmentTick = 0;
+    session->fragmentMask = 0;
+    memset(session->history, 0, sizeof(NetSnapshot) * NET_SNAPSHOT_HISTORY);
+}
+
+/**
+ * @brief Handle every packet that arrived at a client
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+static void NetClientReceive(NetSession* session, Game* game) {
+    PlatformAddress address;
+    int size;
+    while ((size = PlatformSocketReceive(session->socket, &address, session->packet, NET_MAX_PACKET_SIZE)) > 0) {
+        if (size < NET_HEADER_SIZE || NetReadU32(session->packet) != NET_PROTOCOL_ID) continue;
+        if (!NetAddressEqual(&address, &session->serverAddress)) continue;
+
+        session->lastReceiveTime = GetTime();
+
+        switch ((NetPacketType)session->packet[4]) {
+        case NET_PACKET_ACCEPT:
+            if (size < NET_ACCEPT_SIZE) break;
+            if (!session->connected) {
+                TraceLog(LOG_INFO, "Connected to server");
+            }
+            session->connected = true;
+            session->entityIndex = (int)NetReadU32(session->packet + NET_HEADER_SIZE);
+            break;
+
+        case NET_PACKET_SNAPSHOT:
+            if (session->connected) {
+                NetClientHandleSnapshot(session, game, session->packet, size);
+            }
+            break;
+
+        case NET_PACKET_DISCONNECT:
+            TraceLog(LOG_WARNING, "Server closed the connection");
+            NetClientReset(session);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (session->connected && GetTime() - session->lastReceiveTime > NET_TIMEOUT) {
+        TraceLog(LOG_WARNING, "Lost connection to server");
+        NetClientReset(session);
+    }
+
+    NetClientFocusPlayer(session, game);
+}
+
+/**
+ * @brief Send our unacknowledged input steps, or ask to connect
+ *
+ * @param session Pointer to session
+ */
+static void NetClientSend(NetSession* session) {
+    double now = GetTime();
+
+    if (!session->connected) {
+        if (now >= session->nextSendTime) {
+            NetSendEmpty(session, &session->serverAddress, NET_PACKET_CONNECT);
+            session->nextSendTime = now + NET_CONNECT_RETRY_INTERVAL;
+        }
+        return;
+    }
+
+    // Every step the server has not applied yet, newest first, so a lost
+    // packet is covered by the next one
+    uint32_t oldest = session->ackedStep + 1;
+    if (session->step >= NET_INPUT_REDUNDANCY && oldest < session->step - NET_INPUT_REDUNDANCY + 1) {
+        oldest = session->step - NET_INPUT_REDUNDANCY + 1;
+    }
+    if (oldest < 1) oldest = 1;
+    if (session->step < oldest) return;
+
+    unsigned char* data = session->packet;
+    int size = NetWriteHeader(data, NET_PACKET_INPUT);
+    NetWriteU32(data + size, session->tick);
+    NetWriteU32(data + size + 4, session->step);
+    size += 9;
+
+    int count = 0;
+    for (uint32_t step = session->step; step >= oldest; step--) {
+        NetRollbackFrame* frame = NetSessionFindFrame(session, step);
+        if (!frame) break;
+
+        NetWriteU32(data + size, frame->input.actions);
+        size += 4;
+
+        for (int action = 0; action < ACTION_COUNT; action++) {
+            if (!(frame->input.actions & ((InputActionMask)1 << action))) continue;
+
+            float value = frame->input.values[action];
+            if (value > 1.0f) value = 1.0f;
+            if (value < -1.0f) value = -1.0f;
+            data[size++] = (unsigned char)(signed char)lroundf(value * 127.0f);
+        }
+        count++;
+    }
+
+    if (count == 0) return;
+    data[NET_INPUT_HEADER_SIZE - 1] = (unsigned char)count;
+    NetSend(session, &session->serverAddress, data, size);
+}
+
+/**
+ * @brief Handle every packet that has arrived
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+void NetSessionReceive(NetSession* session, Game* game) {
+    if (!session || !game) return;
+
+    if (session->mode == NET_MODE_SERVER) {
+        NetServerReceive(session, game);
+    }
+    else if (session->mode == NET_MODE_CLIENT) {
+        NetClientReceive(session, game);
+    }
+}
+
+/**
+ * @brief Run one fixed simulation step
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+void NetSessionStep(NetSession* session, Game* game, float deltaTime) {
+    if (!session || !game) return;
+
+    if (session->mode == NET_MODE_SERVER) {
+        NetServerStep(session, game, deltaTime);
+    }
+    else if (session->mode == NET_MODE_CLIENT) {
+        NetClientStep(session, game, deltaTime);
+    }
+    else {
+        GameSimulationStep(game, deltaTime);
+    }
+}
+
+/**
+ * @brief Send whatever is due
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+void NetSessionSend(NetSession* session, Game* game) {
+    if (!session || !game) return;
+
+    if (session->mode == NET_MODE_SERVER) {
+        NetServerSend(session, game);
+    }
+    else if (session->mode == NET_MODE_CLIENT) {
+        NetClientSend(session);
+    }
+
+    NetFlushDelayed(session);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file net.h
+ * @brief Server-authoritative network multiplayer
+ *
+ * This file defines the network session. The server's simulation is the
+ * authoritative one. Clients send it their input for every fixed step,
+ * and run the same simulation ahead of it so their own player moves at
+ * once. Each snapshot tells the client which of its steps the server has
+ * applied; if the state differs from what the client predicted for that
+ * step, or another player's input changed, the client restores its saved
+ * state for the step, takes the server's values and re-simulates the
+ * steps since. Snapshots are delta encoded against the newest one each
+ * client has acknowledged, so a lost packet costs nothing but a slightly
+ * larger next one. A snapshot too large for one packet (a full one with
+ * many balls, say) is split into fragments the client puts back together.
+ */
+#ifndef MESSY_GAME_NET_H
+#define MESSY_GAME_NET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game.h"
+#include "input.h"
+#include "platform.h"
+#include "net_snapshot.h"
+#include "sim_state.h"
+#include "rng.h"
+
+#define NET_PROTOCOL_ID 0x4D474E31u    // "MGN1", first four bytes of every packet
+#define NET_MAX_PACKET_SIZE 1200       // Largest datagram sent, below common path MTUs
+#define NET_MAX_CLIENTS MAX_LOCAL_PLAYERS // Clients per server (client 0 plays player 0)
+#define NET_SNAPSHOT_HISTORY 32        // Snapshots kept as delta baselines
+#define NET_SNAPSHOT_FRAGMENT_SIZE 1024 // Encoded snapshot bytes per packet
+#define NET_MAX_SNAPSHOT_FRAGMENTS 16  // Packets one snapshot can be split into (at most 32)
+#define NET_MAX_SNAPSHOT_SIZE (NET_SNAPSHOT_FRAGMENT_SIZE * NET_MAX_SNAPSHOT_FRAGMENTS) // Largest encoded snapshot
+#define NET_INPUT_BUFFER 64            // Client input steps buffered by the server
+#define NET_INPUT_REDUNDANCY 16        // Unacknowledged input steps repeated in every input packet
+#define NET_INPUT_MAX_BACKLOG 12       // Buffered input steps before the server skips ahead
+#define NET_ROLLBACK_FRAMES 64         // Predicted steps a client can roll back
+#define NET_DELAY_QUEUE_CAPACITY 256   // Packets held back by simulated latency
+
+/**
+ * @brief Network session modes enumeration
+ */
+typedef enum {
+    NET_MODE_NONE,             // Offline
+    NET_MODE_SERVER,           // Runs the simulation for remote clients
+    NET_MODE_CLIENT,           // Shows a remote server's simulation
+    NET_MODE_COUNT
+} NetMode;
+
+/**
+ * @brief Packet types enumeration
+ */
+typedef enum {
+    NET_PACKET_CONNECT,        // Client asks to join
+    NET_PACKET_ACCEPT,         // Server assigns the client a player
+    NET_PACKET_INPUT,          // Client action states
+    NET_PACKET_SNAPSHOT,       // Server simulation state
+    NET_PACKET_DISCONNECT,     // Either side leaves, or the server is full
+    NET_PACKET_COUNT
+} NetPacketType;
+
+/**
+ * @brief Action states used for one simulation step
+ */
+typedef struct {
+    uint32_t step;             // Client step number (0 = empty)
+    InputActionMask actions;   // Action states
+    float values[ACTION_COUNT]; // Action values
+} NetInputFrame;
+
+/**
+ * @brief Server-side view of a connected client
+ */
+typedef struct {
+    bool connected;            // Whether the slot is in use
+    PlatformAddress address;   // Client address
+    int playerIndex;           // Index in game->players driven by this client
+    uint32_t ackedTick;        // Newest snapshot the client has received
+    double lastReceiveTime;    // When the last packet arrived (GetTime clock)
+    NetInputFrame inputs[NET_INPUT_BUFFER]; // Received input steps, indexed by step
+    uint32_t receivedStep;     // Newest input step received
+    uint32_t appliedStep;      // Newest input step applied to the simulation
+} NetClient;
+
+/**
+ * @brief Client-side predicted step
+ */
+typedef struct {
+    NetInputFrame input;       // Our input for the step
+} NetRollbackFrame;
+
+/**
+ * @brief Packet held back by simulated latency
+ */
+typedef struct {
+    double sendTime;           // When the packet is due to leave
+    PlatformAddress address;   // Destination
+    int size;                  // Packet size
+    unsigned char data[NET_MAX_PACKET_SIZE]; // Packet bytes
+} NetDelayedPacket;
+
+/**
+ * @brief Network session structure
+ */
+typedef struct NetSession {
+    NetMode mode;              // Server or client
+    PlatformSocket* socket;    // UDP socket
+    NetSnapshot* history;      // Ring of NET_SNAPSHOT_HISTORY snapshots, indexed by tick
+    uint32_t tick;             // Newest snapshot captured (server) or received (client)
+    double nextSendTime;       // When the next snapshot or connection request is due
+    NetClient clients[NET_MAX_CLIENTS]; // Connected clients (server)
+    PlatformAddress serverAddress; // Server address (client)
+    bool connected;            // Whether the server accepted us (client)
+    int entityIndex;           // Game entity slot of our player, or -1 (client)
+    double lastReceiveTime;    // When the server was last heard from (client)
+    NetRollbackFrame* frames;  // Ring of NET_ROLLBACK_FRAMES predicted steps, indexed by step (client)
+    SimStateRing* states;      // Simulation state after each predicted step, keyed by step (client)
+    uint32_t step;             // Newest predicted step (client)
+    uint32_t ackedStep;        // Newest step the server has applied (client)
+    InputManager* remoteInputs[MAX_LOCAL_PLAYERS]; // Predicted input of other players (client)
+    NetSnapshot* predicted;    // Scratch snapshot of a predicted state (client)
+    float simulatedLatency;    // Seconds every outgoing packet is held back
+    float simulatedLoss;       // Fraction of outgoing packets dropped
+    NetDelayedPacket* delayed; // Ring of held-back packets (NULL without simulated latency)
+    int delayedHead;           // Index of oldest held-back packet
+    int delayedCount;          // Number of held-back packets
+    Rng rng;                   // Random generator for simulated loss
+    unsigned char* snapshotData; // Encoded snapshot being sent (server) or put back together (client)
+    uint32_t fragmentTick;     // Snapshot whose fragments are arriving (client)
+    uint32_t fragmentMask;     // Fragments of it received, one bit each (client)
+    int fragmentCount;         // Fragments it was split into (client)
+    int snapshotSize;          // Its encoded size, known once the last fragment is in (client)
+    unsigned char packet[NET_MAX_PACKET_SIZE]; // Packet scratch buffer
+} NetSession;
+
+/**
+ * @brief Start a server
+ *
+ * @param port UDP port to listen on
+ * @return NetSession* Pointer to created session or NULL if failed
+ */
+NetSession* NetSessionCreateServer(uint16_t port);
+
+/**
+ * @brief Start connecting to a server
+ *
+ * @param address Server host name or address, optionally with ":port"
+ * @return NetSession* Pointer to created session or NULL if failed
+ */
+NetSession* NetSessionCreateClient(const char* address);
+
+/**
+ * @brief Tell the other side we are leaving and free the session
+ *
+ * @param session Pointer to session
+ */
+void NetSessionDestroy(NetSession* session);
+
+/**
+ * @brief Hold back and drop outgoing packets, to test on one machine
+ *
+ * @param session Pointer to session
+ * @param latency Seconds every outgoing packet is held back
+ * @param loss Fraction of outgoing packets dropped (0.0 to 1.0)
+ * @return bool Whether the conditions were applied
+ */
+bool NetSessionSimulateConditions(NetSession* session, float latency, float loss);
+
+/**
+ * @brief Handle every packet that has arrived
+ *
+ * A server buffers client input steps. A client stores snapshots and
+ * corrects its prediction with them.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+void NetSessionReceive(NetSession* session, Game* game);
+
+/**
+ * @brief Run one fixed simulation step
+ *
+ * A server first applies the next buffered input step of every client.
+ * A client drives the other players with their last known input and
+ * saves the result so the step can be rolled back.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ * @param deltaTime Step length in seconds
+ */
+void NetSessionStep(NetSession* session, Game* game, float deltaTime);
+
+/**
+ * @brief Send whatever is due
+ *
+ * A server sends a snapshot to every client NET_SNAPSHOT_RATE times a
+ * second. A client sends its unacknowledged input steps, or asks to
+ * connect. Packets held back by simulated latency leave when due.
+ *
+ * @param session Pointer to session
+ * @param game Pointer to game
+ */
+void NetSessionSend(NetSession* session, Game* game);
+
+#endif // MESSY_GAME_NET_H
@@ -0,0 +1,578 @@
+/**
+ * @file net_snapshot.c
+ * @brief Implementation of network snapshots
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "net_snapshot.h"
+#include "ball.h"
+#include "player.h"
+#include "snake_boss.h"
+
+// Width classes of an encoded delta: 2-bit class, then this many bits
+static const int NET_DELTA_BITS[4] = { 4, 8, 16, 32 };
+
+// Baseline used when the receiver has nothing yet
+static const NetSnapshot netEmptySnapshot = { 0 };
+
+/**
+ * @brief Bit stream writer
+ */
+typedef struct {
+    unsigned char* data;       // Output buffer
+    int capacity;              // Size of output buffer in bytes
+    int bitPosition;           // Number of bits written
+    bool overflow;             // Whether a write did not fit
+} NetBitWriter;
+
+/**
+ * @brief Bit stream reader
+ */
+typedef struct {
+    const unsigned char* data; // Input bytes
+    int size;                  // Number of input bytes
+    int bitPosition;           // Number of bits read
+    bool overflow;             // Whether a read ran past the end
+} NetBitReader;
+
+/**
+ * @brief Write the low bits of a value, least significant bit first
+ *
+ * @param writer Pointer to writer
+ * @param value Value to write
+ * @param count Number of bits (1 to 32)
+ */
+static void NetWriteBits(NetBitWriter* writer, uint32_t value, int count) {
+    if (writer->bitPosition + count > writer->capacity * 8) {
+        writer->overflow = true;
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        int byteIndex = writer->bitPosition >> 3;
+        int bitIndex = writer->bitPosition & 7;
+        if (bitIndex == 0) writer->data[byteIndex] = 0;
+        if ((value >> i) & 1u) writer->data[byteIndex] |= (unsigned char)(1u << bitIndex);
+        writer->bitPosition++;
+    }
+}
+
+/**
+ * @brief Read bits written by NetWriteBits
+ *
+ * @param reader Pointer to reader
+ * @param count Number of bits (1 to 32)
+ * @return uint32_t Value read (0 after an overflow)
+ */
+static uint32_t NetReadBits(NetBitReader* reader, int count) {
+    if (reader->bitPosition + count > reader->size * 8) {
+        reader->overflow = true;
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (int i = 0; i < count; i++) {
+        int byteIndex = reader->bitPosition >> 3;
+        int bitIndex = reader->bitPosition & 7;
+        if ((reader->data[byteIndex] >> bitIndex) & 1u) value |= 1u << i;
+        reader->bitPosition++;
+    }
+    return value;
+}
+
+/**
+ * @brief Write a signed difference using as few bits as fit
+ *
+ * @param writer Pointer to writer
+ * @param delta Difference to write
+ */
+static void NetWriteDelta(NetBitWriter* writer, int32_t delta) {
+    // Zigzag so small negative values are small too
+    uint32_t value = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+
+    int widthClass = 3;
+    for (int i = 0; i < 3; i++) {
+        if (value < (1u << NET_DELTA_BITS[i])) {
+            widthClass = i;
+            break;
+        }
+    }
+
+    NetWriteBits(writer, (uint32_t)widthClass, 2);
+    NetWriteBits(writer, value, NET_DELTA_BITS[widthClass]);
+}
+
+/**
+ * @brief Read a difference written by NetWriteDelta
+ *
+ * @param reader Pointer to reader
+ * @return int32_t Difference read
+ */
+static int32_t NetReadDelta(NetBitReader* reader) {
+    int widthClass = (int)NetReadBits(reader, 2);
+    uint32_t value = NetReadBits(reader, NET_DELTA_BITS[widthClass]);
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1u);
+}
+
+/**
+ * @brief Write a field as a changed bit plus its difference from the baseline
+ *
+ * @param writer Pointer to writer
+ * @param value New value
+ * @param base Baseline value
+ */
+static void NetWriteField(NetBitWriter* writer, int32_t value, int32_t base) {
+    NetWriteBits(writer, value != base, 1);
+    if (value != base) NetWriteDelta(writer, (int32_t)((uint32_t)value - (uint32_t)base));
+}
+
+/**
+ * @brief Read a field written by NetWriteField
+ *
+ * @param reader Pointer to reader
+ * @param base Baseline value
+ * @return int32_t Field value
+ */
+static int32_t NetReadField(NetBitReader* reader, int32_t base) {
+    if (!NetReadBits(reader, 1)) return base;
+    return (int32_t)((uint32_t)base + (uint32_t)NetReadDelta(reader));
+}
+
+/**
+ * @brief Quantise a world value
+ *
+ * @param value Value to quantise
+ * @param scale Units per world unit
+ * @return int32_t Quantised value
+ */
+static int32_t NetQuantize(float value, float scale) {
+    return (int32_t)lroundf(value * scale);
+}
+
+/**
+ * @brief Check whether two entity states are equal
+ *
+ * @param a First state
+ * @param b Second state
+ * @return bool Whether every field matches
+ */
+static bool NetEntityStateEqual(const NetEntityState* a, const NetEntityState* b) {
+    return a->type == b->type && a->active == b->active && a->state == b->state &&
+        a->facing == b->facing && a->x == b->x && a->y == b->y &&
+        a->speedX == b->speedX && a->speedY == b->speedY &&
+        a->segmentCount == b->segmentCount && a->actions == b->actions;
+}
+
+/**
+ * @brief Capture the current simulation state
+ *
+ * @param snapshot Pointer to snapshot to fill
+ * @param game Pointer to game
+ */
+void NetSnapshotCapture(NetSnapshot* snapshot, Game* game) {
+    if (!snapshot || !game) return;
+
+    snapshot->entityCount = 0;
+    snapshot->segmentCount = 0;
+
+    if (game->entityCount > NET_MAX_ENTITIES) {
+        TraceLog(LOG_WARNING, "Snapshot leaves out %d of %d entities", game->entityCount - NET_MAX_ENTITIES, game->entityCount);
+    }
+
+    for (int i = 0; i < game->entityCount && i < NET_MAX_ENTITIES; i++) {
+        Entity* entity = game->entities[i];
+        NetEntityState* state = &snapshot->entities[snapshot->entityCount++];
+        memset(state, 0, sizeof(NetEntityState));
+        if (!entity) continue;
+
+        state->type = (uint8_t)(entity->type + 1);
+        state->active = entity->active;
+        state->facing = (uint8_t)entity->facing;
+        state->x = NetQuantize(entity->x, NET_POSITION_SCALE);
+        state->y = NetQuantize(entity->y, NET_POSITION_SCALE);
+        state->speedX = NetQuantize(entity->speedX, NET_SPEED_SCALE);
+        state->speedY = NetQuantize(entity->speedY, NET_SPEED_SCALE);
+
+        if (entity->type == ENTITY_PLAYER) {
+            PlayerData* playerData = PlayerGetData(entity);
+            if (playerData) {
+                state->state = (uint8_t)playerData->state;
+                state->actions = playerData->input ? playerData->input->actionStates : 0;
+            }
+        }
+        else if (entity->type == ENTITY_BALL) {
+            BallData* ballData = BallGetData(entity);
+            if (ballData) state->state = (uint8_t)ballData->state;
+        }
+        else if (IsSnakeBoss(entity)) {
+            SnakeBossData* bossData = SnakeBossGetData(entity);
+            state->state = (uint8_t)bossData->state;
+
+            // Segments that do not fit are left out; the tail is cut short
+            int count = bossData->segmentCount;
+            if (count > NET_MAX_SNAKE_SEGMENTS - snapshot->segmentCount) {
+                count = NET_MAX_SNAKE_SEGMENTS - snapshot->segmentCount;
+            }
+
+            for (int j = 0; j < count; j++) {
+                NetSegmentState* segment = &snapshot->segments[snapshot->segmentCount++];
+                segment->x = NetQuantize(bossData->segments[j].worldX, NET_POSITION_SCALE);
+                segment->y = NetQuantize(bossData->segments[j].worldY, NET_POSITION_SCALE);
+            }
+            state->segmentCount = (uint16_t)count;
+        }
+    }
+
+    snapshot->winState = 0;
+    snapshot->flashTextActive = 0;
+    if (game->winCondition) {
+        snapshot->winState = (uint8_t)game->winCondition->state;
+        snapshot->flashTextActive = game->winCondition->flashTextActive;
+    }
+}
+
+/**
+ * @brief Check whether two snapshots hold the same state
+ *
+ * @param a First snapshot
+ * @param b Second snapshot
+ * @return bool Whether entities, segments and win state match
+ */
+bool NetSnapshotEqual(const NetSnapshot* a, const NetSnapshot* b) {
+    if (!a || !b) return false;
+
+    if (a->entityCount != b->entityCount || a->segmentCount != b->segmentCount ||
+        a->winState != b->winState || a->flashTextActive != b->flashTextActive) {
+        return false;
+    }
+
+    for (int i = 0; i < a->entityCount; i++) {
+        if (!NetEntityStateEqual(&a->entities[i], &b->entities[i])) return false;
+    }
+
+    for (int i = 0; i < a->segmentCount; i++) {
+        if (a->segments[i].x != b->segments[i].x || a->segments[i].y != b->segments[i].y) return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Create an entity for a snapshot slot the game does not have
+ *
+ * @param game Pointer to game
+ * @param state Entity state from the snapshot
+ * @return Entity* Created entity or NULL
+ */
+static Entity* NetSnapshotCreateEntity(Game* game, const NetEntityState* state) {
+    Entity* entity = NULL;
+    switch (state->type - 1) {
+    case ENTITY_PLAYER:
+        entity = PlayerCreate(PLAYER_TYPE_KNIGHT, 0.0f, 0.0f);
+        break;
+
+    case ENTITY_BALL:
+        // Balls come from the game's ball pool
+        return GameAddBall(game, BALL_TYPE_NORMAL, 0.0f, 0.0f);
+
+    case ENTITY_ENEMY:
+        entity = SnakeBossCreate(0, 0, 1);
+        break;
+
+    default:
+        return NULL;
+    }
+
+    if (!entity) return NULL;
+    if (!GameAddEntity(game, entity)) {
+        EntityDestroy(entity);
+        return NULL;
+    }
+
+    // Remote players count as players for rendering and the camera
+    if (entity->type == ENTITY_PLAYER && game->playerCount < MAX_LOCAL_PLAYERS) {
+        game->players[game->playerCount++] = entity;
+    }
+
+    return entity;
+}
+
+/**
+ * @brief Show snake segments from a snapshot
+ *
+ * @param entity Snake entity
+ * @param from Older segments (or NULL)
+ * @param to Newer segments
+ * @param count Number of segments
+ * @param alpha Interpolation factor
+ */
+static void NetSnapshotApplySegments(Entity* entity, const NetSegmentState* from, const NetSegmentState* to, int count, float alpha) {
+    SnakeBossData* bossData = SnakeBossGetData(entity);
+    if (!bossData || count <= 0) return;
+
+    if (count > bossData->segmentCapacity) {
+        SnakeSegment* newSegments = (SnakeSegment*)realloc(bossData->segments, sizeof(SnakeSegment) * count);
+        if (!newSegments) {
+            TraceLog(LOG_ERROR, "Failed to expand snake segments array");
+            return;
+        }
+
+        bossData->segments = newSegments;
+        bossData->segmentCapacity = count;
+    }
+    bossData->segmentCount = count;
+
+    for (int i = 0; i < count; i++) {
+        float x = (float)to[i].x;
+        float y = (float)to[i].y;
+        if (from) {
+            x = (float)from[i].x + (x - (float)from[i].x) * alpha;
+            y = (float)from[i].y + (y - (float)from[i].y) * alpha;
+        }
+
+        SnakeSegment* segment = &bossData->segments[i];
+        segment->worldX = x / NET_POSITION_SCALE;
+        segment->worldY = y / NET_POSITION_SCALE;
+        segment->gridX = (int)(segment->worldX / TILE_WIDTH);
+        segment->gridY = (int)(segment->worldY / TILE_HEIGHT);
+    }
+
+    // The entity sits on the head
+    entity->x = bossData->segments[0].worldX;
+    entity->y = bossData->segments[0].worldY;
+}
+
+/**
+ * @brief Show a point between two snapshots in the game
+ *
+ * @param game Pointer to game
+ * @param from Older snapshot (or NULL to show to exactly)
+ * @param to Newer snapshot
+ * @param alpha Interpolation factor from 0.0 (from) to 1.0 (to)
+ */
+void NetSnapshotApply(Game* game, const NetSnapshot* from, const NetSnapshot* to, float alpha) {
+    if (!game || !to) return;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+
+    int toSegment = 0;
+    int fromSegment = 0;
+
+    for (int i = 0; i < to->entityCount; i++) {
+        const NetEntityState* target = &to->entities[i];
+        const NetEntityState* previous = NULL;
+        if (from && i < from->entityCount && from->entities[i].type == target->type) {
+            previous = &from->entities[i];
+        }
+
+        const NetSegmentState* targetSegments = &to->segments[toSegment];
+        const NetSegmentState* previousSegments = NULL;
+        if (previous && previous->segmentCount == target->segmentCount) {
+            previousSegments = &from->segments[fromSegment];
+        }
+        toSegment += target->segmentCount;
+        if (from && i < from->entityCount) fromSegment += from->entities[i].segmentCount;
+
+        if (target->type == 0) continue;
+
+        Entity* entity = NULL;
+        if (i < game->entityCount) {
+            entity = game->entities[i];
+        }
+        else if (i == game->entityCount) {
+            entity = NetSnapshotCreateEntity(game, target);
+        }
+        if (!entity) continue;
+
+        if ((int)entity->type != target->type - 1) {
+            entity->active = false;
+            continue;
+        }
+
+        float x = (float)target->x;
+        float y = (float)target->y;
+        if (previous) {
+            x = (float)previous->x + (x - (float)previous->x) * alpha;
+            y = (float)previous->y + (y - (float)previous->y) * alpha;
+        }
+
+        entity->active = target->active != 0;
+        entity->facing = (Direction)target->facing;
+        entity->x = x / NET_POSITION_SCALE;
+        entity->y = y / NET_POSITION_SCALE;
+        entity->speedX = (float)target->speedX / NET_SPEED_SCALE;
+        entity->speedY = (float)target->speedY / NET_SPEED_SCALE;
+
+        if (entity->type == ENTITY_PLAYER) {
+            PlayerData* playerData = PlayerGetData(entity);
+            if (playerData) playerData->state = (PlayerState)target->state;
+        }
+        else if (entity->type == ENTITY_BALL) {
+            BallData* ballData = BallGetData(entity);
+            if (ballData && ballData->state != (BallState)target->state) {
+                BallSetState(entity, (BallState)target->state);
+            }
+        }
+        else if (IsSnakeBoss(entity)) {
+            SnakeBossGetData(entity)->state = (SnakeBossState)target->state;
+            NetSnapshotApplySegments(entity, previousSegments, targetSegments, target->segmentCount, alpha);
+        }
+    }
+
+    // Entities the server no longer has
+    for (int i = to->entityCount; i < game->entityCount; i++) {
+        if (game->entities[i]) game->entities[i]->active = false;
+    }
+
+    if (game->winCondition) {
+        game->winCondition->state = (WinConditionState)to->winState;
+        game->winCondition->flashTextActive = to->flashTextActive != 0;
+    }
+}
+
+/**
+ * @brief Encode a snapshot as differences against a baseline
+ *
+ * Layout: entity count, then per entity a changed bit and, if set, a
+ * header-changed bit with the discrete fields, a changed bit plus
+ * delta per coordinate and a changed bit plus the action states. Then the segment count and per segment an
+ * unchanged bit or a delta from the previous segment, then the win state.
+ *
+ * @param snapshot Snapshot to encode
+ * @param baseline Snapshot the receiver already has, or NULL to send everything
+ * @param buffer Buffer to store the encoded bytes
+ * @param capacity Size of buffer
+ * @return int Number of bytes written, or -1 if the buffer is too small
+ */
+int NetSnapshotWrite(const NetSnapshot* snapshot, const NetSnapshot* baseline, unsigned char* buffer, int capacity) {
+    if (!snapshot || !buffer || capacity <= 0) return -1;
+    if (!baseline) baseline = &netEmptySnapshot;
+
+    NetBitWriter writer = { buffer, capacity, 0, false };
+
+    NetWriteBits(&writer, (uint32_t)snapshot->entityCount, NET_ENTITY_COUNT_BITS);
+    for (int i = 0; i < snapshot->entityCount; i++) {
+        const NetEntityState* state = &snapshot->entities[i];
+        const NetEntityState* base = i < baseline->entityCount ? &baseline->entities[i] : &netEmptySnapshot.entities[0];
+
+        bool changed = !NetEntityStateEqual(state, base);
+        NetWriteBits(&writer, changed, 1);
+        if (!changed) continue;
+
+        bool headerChanged = state->type != base->type || state->active != base->active ||
+            state->state != base->state || state->facing != base->facing ||
+            state->segmentCount != base->segmentCount;
+        NetWriteBits(&writer, headerChanged, 1);
+        if (headerChanged) {
+            NetWriteBits(&writer, state->type, 4);
+            NetWriteBits(&writer, state->active, 1);
+            NetWriteBits(&writer, state->state, 4);
+            NetWriteBits(&writer, state->facing, 2);
+            NetWriteBits(&writer, state->segmentCount, 9);
+        }
+
+        NetWriteField(&writer, state->x, base->x);
+        NetWriteField(&writer, state->y, base->y);
+        NetWriteField(&writer, state->speedX, base->speedX);
+        NetWriteField(&writer, state->speedY, base->speedY);
+
+        NetWriteBits(&writer, state->actions != base->actions, 1);
+        if (state->actions != base->actions) NetWriteBits(&writer, state->actions, ACTION_COUNT);
+    }
+
+    // Moving snakes shift every segment, so changed segments are sent
+    // relative to their neighbour rather than to the baseline
+    NetWriteBits(&writer, (uint32_t)snapshot->segmentCount, 9);
+    for (int i = 0; i < snapshot->segmentCount; i++) {
+        const NetSegmentState* segment = &snapshot->segments[i];
+        bool unchanged = i < baseline->segmentCount &&
+            segment->x == baseline->segments[i].x && segment->y == baseline->segments[i].y;
+        NetWriteBits(&writer, unchanged, 1);
+        if (unchanged) continue;
+
+        const NetSegmentState* neighbour = i > 0 ? &snapshot->segments[i - 1] : &netEmptySnapshot.segments[0];
+        NetWriteDelta(&writer, (int32_t)((uint32_t)segment->x - (uint32_t)neighbour->x));
+        NetWriteDelta(&writer, (int32_t)((uint32_t)segment->y - (uint32_t)neighbour->y));
+    }
+
+    NetWriteBits(&writer, snapshot->winState, 4);
+    NetWriteBits(&writer, snapshot->flashTextActive, 1);
+
+    if (writer.overflow) return -1;
+    return (writer.bitPosition + 7) / 8;
+}
+
+/**
+ * @brief Decode a snapshot encoded against a baseline
+ *
+ * @param snapshot Pointer to snapshot to fill (tick and time are left alone)
+ * @param baseline The baseline it was encoded against, or NULL
+ * @param data Encoded bytes
+ * @param size Number of encoded bytes
+ * @return true If the snapshot was decoded
+ * @return false If the data is truncated or invalid
+ */
+bool NetSnapshotRead(NetSnapshot* snapshot, const NetSnapshot* baseline, const unsigned char* data, int size) {
+    if (!snapshot || !data || size <= 0) return false;
+    if (!baseline) baseline = &netEmptySnapshot;
+
+    NetBitReader reader = { data, size, 0, false };
+
+    int entityCount = (int)NetReadBits(&reader, NET_ENTITY_COUNT_BITS);
+    if (entityCount > NET_MAX_ENTITIES) return false;
+
+    for (int i = 0; i < entityCount && !reader.overflow; i++) {
+        NetEntityState* state = &snapshot->entities[i];
+        *state = i < baseline->entityCount ? baseline->entities[i] : netEmptySnapshot.entities[0];
+
+        if (!NetReadBits(&reader, 1)) continue;
+
+        if (NetReadBits(&reader, 1)) {
+            state->type = (uint8_t)NetReadBits(&reader, 4);
+            state->active = (uint8_t)NetReadBits(&reader, 1);
+            state->state = (uint8_t)NetReadBits(&reader, 4);
+            state->facing = (uint8_t)NetReadBits(&reader, 2);
+            state->segmentCount = (uint16_t)NetReadBits(&reader, 9);
+        }
+
+        state->x = NetReadField(&reader, state->x);
+        state->y = NetReadField(&reader, state->y);
+        state->speedX = NetReadField(&reader, state->speedX);
+        state->speedY = NetReadField(&reader, state->speedY);
+
+        if (NetReadBits(&reader, 1)) state->actions = NetReadBits(&reader, ACTION_COUNT);
+    }
+    snapshot->entityCount = entityCount;
+
+    int segmentCount = (int)NetReadBits(&reader, 9);
+    if (segmentCount > NET_MAX_SNAKE_SEGMENTS) return false;
+
+    for (int i = 0; i < segmentCount && !reader.overflow; i++) {
+        NetSegmentState* segment = &snapshot->segments[i];
+        if (NetReadBits(&reader, 1)) {
+            if (i >= baseline->segmentCount) return false;
+            *segment = baseline->segments[i];
+            continue;
+        }
+
+        const NetSegmentState* neighbour = i > 0 ? &snapshot->segments[i - 1] : &netEmptySnapshot.segments[0];
+        segment->x = (int32_t)((uint32_t)neighbour->x + (uint32_t)NetReadDelta(&reader));
+        segment->y = (int32_t)((uint32_t)neighbour->y + (uint32_t)NetReadDelta(&reader));
+    }
+    snapshot->segmentCount = segmentCount;
+
+    snapshot->winState = (uint8_t)NetReadBits(&reader, 4);
+    snapshot->flashTextActive = (uint8_t)NetReadBits(&reader, 1);
+
+    if (reader.overflow) return false;
+
+    // Segment counts must add up to the segments sent
+    int totalSegments = 0;
+    for (int i = 0; i < entityCount; i++) {
+        totalSegments += snapshot->entities[i].segmentCount;
+    }
+    return totalSegments <= segmentCount;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file net_snapshot.h
+ * @brief Network snapshots of the simulation state
+ *
+ * This file defines the snapshot the server sends to clients: the state
+ * of every entity, snake segment and the win condition, quantised to
+ * integers. Snapshots are encoded as a bit stream of differences against
+ * a baseline snapshot the client has already acknowledged, so unchanged
+ * entities cost one bit and moving ones a few bytes.
+ */
+#ifndef MESSY_GAME_NET_SNAPSHOT_H
+#define MESSY_GAME_NET_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "game.h"
+
+#define NET_MAX_ENTITIES 320           // Entities carried by one snapshot (players, a full ball pool and enemies)
+#define NET_ENTITY_COUNT_BITS 9        // Bits of the encoded entity count (enough for NET_MAX_ENTITIES)
+#define NET_MAX_SNAKE_SEGMENTS 256     // Snake segments carried by one snapshot (all snakes)
+#define NET_POSITION_SCALE 4.0f        // Position units per pixel (quarter-pixel precision)
+#define NET_SPEED_SCALE 64.0f          // Speed units per pixel per step
+
+// Every ball in play has to be replicated, or client predictions drift
+#if NET_MAX_ENTITIES < MAX_LOCAL_PLAYERS + BALL_POOL_CAPACITY || NET_MAX_ENTITIES >= (1 << NET_ENTITY_COUNT_BITS)
+#error "NET_MAX_ENTITIES must hold every player and ball and fit in NET_ENTITY_COUNT_BITS"
+#endif
+
+/**
+ * @brief Quantised entity state
+ */
+typedef struct {
+    uint8_t type;              // EntityType + 1, or 0 for an empty slot
+    uint8_t active;            // Whether entity is active
+    uint8_t state;             // PlayerState, BallState or SnakeBossState
+    uint8_t facing;            // Direction entity is facing
+    int32_t x;                 // X position in 1/NET_POSITION_SCALE pixels
+    int32_t y;                 // Y position in 1/NET_POSITION_SCALE pixels
+    int32_t speedX;            // Horizontal speed in 1/NET_SPEED_SCALE units
+    int32_t speedY;            // Vertical speed in 1/NET_SPEED_SCALE units
+    uint16_t segmentCount;     // Snake segments belonging to this entity
+    uint32_t actions;          // Player action states (InputActionMask), so clients can predict
+} NetEntityState;
+
+/**
+ * @brief Quantised snake segment position
+ */
+typedef struct {
+    int32_t x;                 // X position in 1/NET_POSITION_SCALE pixels
+    int32_t y;                 // Y position in 1/NET_POSITION_SCALE pixels
+} NetSegmentState;
+
+/**
+ * @brief Simulation snapshot
+ *
+ * Snake segments of all snakes are stored back to back, in entity order.
+ */
+typedef struct {
+    uint32_t tick;             // Snapshot number (0 = none)
+    double time;               // Server simulation time of the snapshot
+    int entityCount;           // Number of entity slots
+    NetEntityState entities[NET_MAX_ENTITIES];     // Entity slots, in game entity order
+    int segmentCount;          // Number of snake segments
+    NetSegmentState segments[NET_MAX_SNAKE_SEGMENTS]; // Snake segments
+    uint8_t winState;          // WinConditionState
+    uint8_t flashTextActive;   // Whether the win flash text is showing
+} NetSnapshot;
+
+/**
+ * @brief Capture the current simulation state
+ *
+ * Leaves tick and time for the caller to fill in. Entities past
+ * NET_MAX_ENTITIES are left out with a warning.
+ *
+ * @param snapshot Pointer to snapshot to fill
+ * @param game Pointer to game
+ */
+void NetSnapshotCapture(NetSnapshot* snapshot, Game* game);
+
+/**
+ * @brief Show a point between two snapshots in the game
+ *
+ * Positions are interpolated; discrete states are taken from the newer
+ * snapshot. Entities the game does not have yet are created, and entities
+ * the snapshot does not contain are deactivated.
+ *
+ * @param game Pointer to game
+ * @param from Older snapshot (or NULL to show to exactly)
+ * @param to Newer snapshot
+ * @param alpha Interpolation factor from 0.0 (from) to 1.0 (to)
+ */
+void NetSnapshotApply(Game* game, const NetSnapshot* from, const NetSnapshot* to, float alpha);
+
+/**
+ * @brief Check whether two snapshots hold the same state
+ *
+ * Tick and time are not compared.
+ *
+ * @param a First snapshot
+ * @param b Second snapshot
+ * @return bool Whether entities, segments and win state match
+ */
+bool NetSnapshotEqual(const NetSnapshot* a, const NetSnapshot* b);
+
+/**
+ * @brief Encode a snapshot as differences against a baseline
+ *
+ * @param snapshot Snapshot to encode
+ * @param baseline Snapshot the receiver already has, or NULL to send everything
+ * @param buffer Buffer to store the encoded bytes
+ * @param capacity Size of buffer
+ * @return int Number of bytes written, or -1 if the buffer is too small
+ */
+int NetSnapshotWrite(const NetSnapshot* snapshot, const NetSnapshot* baseline, unsigned char* buffer, int capacity);
+
+/**
+ * @brief Decode a snapshot encoded against a baseline
+ *
+ * @param snapshot Pointer to snapshot to fill (tick and time are left alone)
+ * @param baseline The baseline it was encoded against, or NULL
+ * @param data Encoded bytes
+ * @param size Number of encoded bytes
+ * @return true If the snapshot was decoded
+ * @return false If the data is truncated or invalid
+ */
+bool NetSnapshotRead(NetSnapshot* snapshot, const NetSnapshot* baseline, const unsigned char* data, int size);
+
+#endif // MESSY_GAME_NET_SNAPSHOT_H
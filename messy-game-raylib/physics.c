@@ -0,0 +1,580 @@
+/**
+ * @file physics.c
+ * @brief Implementation of sub-stepped contact solver
+ */
+
+#include <string.h>
+#include "physics.h"
+#include "config.h"
+
+/**
+ * @brief Quality level description
+ */
+typedef struct {
+    const char* name;          // Name used on the command line
+    int subSteps;              // Sub-steps per solve
+    int iterations;            // Contact passes per sub-step
+} PhysicsQualityDesc;
+
+/**
+ * @brief Collision layer description
+ */
+typedef struct {
+    unsigned int collidesWith; // Bit per PhysicsLayer this layer collides with
+    float inverseMass;         // Inverse mass of new bodies
+    float restitution;         // Restitution of new bodies
+} PhysicsLayerDesc;
+
+// Sub-steps and iterations per quality level
+static const PhysicsQualityDesc gPhysicsQualities[PHYSICS_QUALITY_COUNT] = {
+    { "low", PHYSICS_LOW_SUB_STEPS, PHYSICS_LOW_ITERATIONS },
+    { "medium", PHYSICS_MEDIUM_SUB_STEPS, PHYSICS_MEDIUM_ITERATIONS },
+    { "high", PHYSICS_HIGH_SUB_STEPS, PHYSICS_HIGH_ITERATIONS },
+};
+
+// What each layer collides with, and what its bodies weigh
+static const PhysicsLayerDesc gPhysicsLayers[PHYSICS_LAYER_COUNT] = {
+    { (1u << PHYSICS_LAYER_PLAYER) | (1u << PHYSICS_LAYER_BALL) | (1u << PHYSICS_LAYER_ENEMY), PHYSICS_PLAYER_INVERSE_MASS, 0.0f },
+    { (1u << PHYSICS_LAYER_PLAYER) | (1u << PHYSICS_LAYER_BALL), PHYSICS_BALL_INVERSE_MASS, BALL_BOUNCE_FACTOR },
+    { 1u << PHYSICS_LAYER_PLAYER, 0.0f, 0.0f },
+};
+
+/**
+ * @brief Initialize a solver
+ *
+ * @param solver Pointer to solver
+ * @param quality Quality level
+ */
+void PhysicsSolverInit(PhysicsSolver* solver, PhysicsQuality quality) {
+    if (!solver) return;
+
+    solver->bodyCount = 0;
+    solver->pairCount = 0;
+    BroadphaseInit(&solver->broadphase, PHYSICS_BROADPHASE_CELL_SIZE);
+    PhysicsSolverSetQuality(solver, quality);
+}
+
+/**
+ * @brief Change the quality level
+ *
+ * @param solver Pointer to solver
+ * @param quality Quality level
+ */
+void PhysicsSolverSetQuality(PhysicsSolver* solver, PhysicsQuality quality) {
+    if (!solver) return;
+    if (quality < 0 || quality >= PHYSICS_QUALITY_COUNT) quality = PHYSICS_QUALITY_MEDIUM;
+
+    solver->quality = quality;
+    solver->subSteps = gPhysicsQualities[quality].subSteps;
+    solver->iterations = gPhysicsQualities[quality].iterations;
+}
+
+/**
+ * @brief Look up a quality level by name
+ *
+ * @param name "low", "medium" or "high"
+ * @param quality Pointer to store the level
+ * @return bool Whether the name is a quality level
+ */
+bool PhysicsQualityFromName(const char* name, PhysicsQuality* quality) {
+    if (!name || !quality) return false;
+
+    for (int i = 0; i < PHYSICS_QUALITY_COUNT; i++) {
+        if (strcmp(gPhysicsQualities[i].name, name) == 0) {
+            *quality = (PhysicsQuality)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Start collecting bodies for a step
+ *
+ * @param solver Pointer to solver
+ */
+void PhysicsSolverBegin(PhysicsSolver* solver) {
+    if (!solver) return;
+
+    solver->bodyCount = 0;
+}
+
+/**
+ * @brief Take the next free body, set up for a layer
+ *
+ * @param solver Pointer to solver
+ * @param shape Body shape
+ * @param x Center X
+ * @param y Center Y
+ * @param halfWidth Radius, or box half width
+ * @param halfHeight Radius, or box half height
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+static PhysicsBody* PhysicsSolverAddBody(
+    PhysicsSolver* solver, PhysicsShape shape, float x, float y,
+    float halfWidth, float halfHeight, PhysicsLayer layer
+) {
+    if (!solver || layer < 0 || layer >= PHYSICS_LAYER_COUNT) return NULL;
+    if (solver->bodyCount >= PHYSICS_MAX_BODIES) {
+        TraceLog(LOG_DEBUG, "Physics solver is full, body ignored");
+        return NULL;
+    }
+
+    PhysicsBody* body = &solver->bodies[solver->bodyCount++];
+    memset(body, 0, sizeof(PhysicsBody));
+    body->shape = shape;
+    body->layer = layer;
+    body->x = SimRealFromFloat(x);
+    body->y = SimRealFromFloat(y);
+    body->startX = body->x;
+    body->startY = body->y;
+    body->halfWidth = SimRealFromFloat(halfWidth);
+    body->halfHeight = SimRealFromFloat(halfHeight);
+    body->restitution = SimRealFromFloat(gPhysicsLayers[layer].restitution);
+
+    return body;
+}
+
+/**
+ * @brief Add an entity as a circle body
+ *
+ * @param solver Pointer to solver
+ * @param entity Entity moved by the body
+ * @param radius Collision radius
+ * @param tileRadius Distance kept from solid tiles
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddEntity(PhysicsSolver* solver, Entity* entity, float radius, float tileRadius, PhysicsLayer layer) {
+    if (!entity) return NULL;
+
+    PhysicsBody* body = PhysicsSolverAddBody(solver, PHYSICS_SHAPE_CIRCLE, entity->x, entity->y, radius, radius, layer);
+    if (!body) return NULL;
+
+    body->entity = entity;
+    body->tileRadius = SimRealFromFloat(tileRadius);
+    body->inverseMass = SimRealFromFloat(gPhysicsLayers[layer].inverseMass);
+
+    return body;
+}
+
+/**
+ * @brief Add an immovable circle
+ *
+ * @param solver Pointer to solver
+ * @param x Center X
+ * @param y Center Y
+ * @param radius Radius
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddCircle(PhysicsSolver* solver, float x, float y, float radius, PhysicsLayer layer) {
+    return PhysicsSolverAddBody(solver, PHYSICS_SHAPE_CIRCLE, x, y, radius, radius, layer);
+}
+
+/**
+ * @brief Add an immovable axis-aligned box
+ *
+ * @param solver Pointer to solver
+ * @param x Center X
+ * @param y Center Y
+ * @param halfWidth Half of the box width
+ * @param halfHeight Half of the box height
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddBox(PhysicsSolver* solver, float x, float y, float halfWidth, float halfHeight, PhysicsLayer layer) {
+    return PhysicsSolverAddBody(solver, PHYSICS_SHAPE_BOX, x, y, halfWidth, halfHeight, layer);
+}
+
+/**
+ * @brief Find the overlap of two circles
+ *
+ * @param ax First center X
+ * @param ay First center Y
+ * @param ar First radius
+ * @param bx Second center X
+ * @param by Second center Y
+ * @param br Second radius
+ * @param normalX Pointer to store the normal X, from the first to the second
+ * @param normalY Pointer to store the normal Y, from the first to the second
+ * @param depth Pointer to store the overlap along the normal
+ * @return bool Whether the circles overlap
+ */
+static bool PhysicsCircleCircle(
+    SimReal ax, SimReal ay, SimReal ar, SimReal bx, SimReal by, SimReal br,
+    SimReal* normalX, SimReal* normalY, SimReal* depth
+) {
+    SimReal dx = bx - ax;
+    SimReal dy = by - ay;
+    SimReal reach = ar + br;
+
+    // Reject far pairs before squaring (keeps fixed point in range)
+    if (SimRealAbs(dx) >= reach || SimRealAbs(dy) >= reach) return false;
+
+    SimReal distanceSq = SimRealMul(dx, dx) + SimRealMul(dy, dy);
+    if (distanceSq >= SimRealMul(reach, reach)) return false;
+
+    SimReal distance = SimRealSqrt(distanceSq);
+    if (distance > 0) {
+        *normalX = SimRealDiv(dx, distance);
+        *normalY = SimRealDiv(dy, distance);
+    }
+    else {
+        // Same center: any direction separates them
+        *normalX = SimRealFromInt(0);
+        *normalY = SimRealFromInt(1);
+    }
+    *depth = reach - distance;
+    return true;
+}
+
+/**
+ * @brief Find the overlap of a circle and an axis-aligned box
+ *
+ * A radius of 0 treats the circle as a point, which only overlaps the
+ * box when it is inside.
+ *
+ * @param cx Circle center X
+ * @param cy Circle center Y
+ * @param radius Circle radius
+ * @param bx Box center X
+ * @param by Box center Y
+ * @param halfWidth Box half width
+ * @param halfHeight Box half height
+ * @param normalX Pointer to store the normal X, from the box to the circle
+ * @param normalY Pointer to store the normal Y, from the box to the circle
+ * @param depth Pointer to store the overlap along the normal
+ * @return bool Whether they overlap
+ */
+static bool PhysicsCircleBox(
+    SimReal cx, SimReal cy, SimReal radius,
+    SimReal bx, SimReal by, SimReal halfWidth, SimReal halfHeight,
+    SimReal* normalX, SimReal* normalY, SimReal* depth
+) {
+    SimReal zero = SimRealFromInt(0);
+    SimReal one = SimRealFromInt(1);
+    SimReal left = bx - halfWidth;
+    SimReal right = bx + halfWidth;
+    SimReal top = by - halfHeight;
+    SimReal bottom = by + halfHeight;
+
+    SimReal nearestX = cx < left ? left : (cx > right ? right : cx);
+    SimReal nearestY = cy < top ? top : (cy > bottom ? bottom : cy);
+    SimReal dx = cx - nearestX;
+    SimReal dy = cy - nearestY;
+
+    if (dx == zero && dy == zero) {
+        // Center inside the box: leave through the nearest face
+        SimReal toLeft = cx - left;
+        SimReal toRight = right - cx;
+        SimReal toTop = cy - top;
+        SimReal toBottom = bottom - cy;
+        SimReal nearest = toLeft;
+        *normalX = -one;
+        *normalY = zero;
+        if (toRight < nearest) {
+            nearest = toRight;
+            *normalX = one;
+        }
+        if (toTop < nearest) {
+            nearest = toTop;
+            *normalX = zero;
+            *normalY = -one;
+        }
+        if (toBottom < nearest) {
+            nearest = toBottom;
+            *normalX = zero;
+            *normalY = one;
+        }
+        *depth = nearest + radius;
+        return true;
+    }
+
+    // Center outside: overlap only if the nearest point is within the radius
+    if (SimRealAbs(dx) >= radius || SimRealAbs(dy) >= radius) return false;
+
+    SimReal distanceSq = SimRealMul(dx, dx) + SimRealMul(dy, dy);
+    if (distanceSq >= SimRealMul(radius, radius)) return false;
+
+    SimReal distance = SimRealSqrt(distanceSq);
+    *normalX = SimRealDiv(dx, distance);
+    *normalY = SimRealDiv(dy, distance);
+    *depth = radius - distance;
+    return true;
+}
+
+/**
+ * @brief Find the overlap of two bodies
+ *
+ * Two boxes never collide.
+ *
+ * @param a First body
+ * @param b Second body
+ * @param normalX Pointer to store the normal X, from a to b
+ * @param normalY Pointer to store the normal Y, from a to b
+ * @param depth Pointer to store the overlap along the normal
+ * @return bool Whether the bodies overlap
+ */
+static bool PhysicsBodyContact(const PhysicsBody* a, const PhysicsBody* b, SimReal* normalX, SimReal* normalY, SimReal* depth) {
+    if (a->shape == PHYSICS_SHAPE_CIRCLE && b->shape == PHYSICS_SHAPE_CIRCLE) {
+        return PhysicsCircleCircle(a->x, a->y, a->halfWidth, b->x, b->y, b->halfWidth, normalX, normalY, depth);
+    }
+
+    if (a->shape == PHYSICS_SHAPE_BOX && b->shape == PHYSICS_SHAPE_CIRCLE) {
+        return PhysicsCircleBox(b->x, b->y, b->halfWidth, a->x, a->y, a->halfWidth, a->halfHeight, normalX, normalY, depth);
+    }
+
+    if (a->shape == PHYSICS_SHAPE_CIRCLE && b->shape == PHYSICS_SHAPE_BOX) {
+        if (!PhysicsCircleBox(a->x, a->y, a->halfWidth, b->x, b->y, b->halfWidth, b->halfHeight, normalX, normalY, depth)) {
+            return false;
+        }
+        *normalX = -*normalX;
+        *normalY = -*normalY;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get a body's current speed
+ *
+ * @param body Pointer to body
+ * @param speedX Pointer to store the X speed
+ * @param speedY Pointer to store the Y speed
+ */
+static void PhysicsBodySpeed(const PhysicsBody* body, SimReal* speedX, SimReal* speedY) {
+    *speedX = body->speedChangeX;
+    *speedY = body->speedChangeY;
+    if (body->entity) {
+        *speedX += SimRealFromFloat(body->entity->speedX);
+        *speedY += SimRealFromFloat(body->entity->speedY);
+    }
+}
+
+/**
+ * @brief Move a body and record that a contact moved it
+ *
+ * @param body Pointer to body
+ * @param moveX X distance
+ * @param moveY Y distance
+ */
+static void PhysicsBodyMove(PhysicsBody* body, SimReal moveX, SimReal moveY) {
+    body->x += moveX;
+    body->y += moveY;
+    body->offsetX += moveX;
+    body->offsetY += moveY;
+    body->touched = true;
+}
+
+/**
+ * @brief Check whether two bodies can collide at all
+ *
+ * @param a First body
+ * @param b Second body
+ * @return bool Whether their layers collide and at least one can move
+ */
+static bool PhysicsBodiesInteract(const PhysicsBody* a, const PhysicsBody* b) {
+    if (a->inverseMass + b->inverseMass <= 0) return false;
+
+    return (gPhysicsLayers[a->layer].collidesWith & (1u << b->layer)) &&
+        (gPhysicsLayers[b->layer].collidesWith & (1u << a->layer));
+}
+
+/**
+ * @brief Push two overlapping bodies apart
+ *
+ * Applies an impulse along the contact normal if the bodies approach
+ * each other, then removes part of the overlap, each body moving in
+ * proportion to its inverse mass.
+ *
+ * @param a First body
+ * @param b Second body
+ */
+static void PhysicsResolvePair(PhysicsBody* a, PhysicsBody* b) {
+    SimReal inverseMassSum = a->inverseMass + b->inverseMass;
+
+    SimReal normalX, normalY, depth;
+    if (!PhysicsBodyContact(a, b, &normalX, &normalY, &depth)) return;
+
+    // Impulse: cancel the approach speed, returning the restitution share
+    SimReal speedAX, speedAY, speedBX, speedBY;
+    PhysicsBodySpeed(a, &speedAX, &speedAY);
+    PhysicsBodySpeed(b, &speedBX, &speedBY);
+    SimReal approach = SimRealMul(speedBX - speedAX, normalX) + SimRealMul(speedBY - speedAY, normalY);
+    if (approach < 0) {
+        SimReal restitution = a->restitution > b->restitution ? a->restitution : b->restitution;
+        SimReal impulse = SimRealDiv(SimRealMul(-approach, SimRealFromInt(1) + restitution), inverseMassSum);
+        SimReal impulseA = SimRealMul(impulse, a->inverseMass);
+        SimReal impulseB = SimRealMul(impulse, b->inverseMass);
+        a->speedChangeX -= SimRealMul(normalX, impulseA);
+        a->speedChangeY -= SimRealMul(normalY, impulseA);
+        b->speedChangeX += SimRealMul(normalX, impulseB);
+        b->speedChangeY += SimRealMul(normalY, impulseB);
+        a->touched |= a->inverseMass > 0;
+        b->touched |= b->inverseMass > 0;
+    }
+
+    // Position correction: remove part of the overlap beyond the slop
+    SimReal excess = depth - SimRealFromFloat(PHYSICS_POSITION_SLOP);
+    if (excess <= 0) return;
+
+    SimReal correction = SimRealDiv(SimRealMul(excess, SimRealFromFloat(PHYSICS_POSITION_CORRECTION)), inverseMassSum);
+    if (a->inverseMass > 0) {
+        SimReal share = SimRealMul(correction, a->inverseMass);
+        PhysicsBodyMove(a, -SimRealMul(normalX, share), -SimRealMul(normalY, share));
+    }
+    if (b->inverseMass > 0) {
+        SimReal share = SimRealMul(correction, b->inverseMass);
+        PhysicsBodyMove(b, SimRealMul(normalX, share), SimRealMul(normalY, share));
+    }
+}
+
+/**
+ * @brief Collect the pairs of bodies that may touch
+ *
+ * Bodies go into the broadphase with their bounds padded by a margin,
+ * so pairs that the iterations push into contact are still found.
+ * Pairs that cannot collide are dropped here rather than every
+ * iteration.
+ *
+ * @param solver Pointer to solver
+ */
+static void PhysicsSolverFindPairs(PhysicsSolver* solver) {
+    Broadphase* broadphase = &solver->broadphase;
+    BroadphaseClear(broadphase);
+
+    for (int i = 0; i < solver->bodyCount; i++) {
+        const PhysicsBody* body = &solver->bodies[i];
+        float x = SimRealToFloat(body->x);
+        float y = SimRealToFloat(body->y);
+        float halfWidth = SimRealToFloat(body->halfWidth) + PHYSICS_BROADPHASE_MARGIN;
+        float halfHeight = SimRealToFloat(body->halfHeight) + PHYSICS_BROADPHASE_MARGIN;
+        BroadphaseInsert(broadphase, i, x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight);
+    }
+    BroadphaseBuild(broadphase);
+
+    int found = BroadphaseFindPairs(broadphase, solver->pairs, PHYSICS_MAX_PAIRS);
+    solver->pairCount = 0;
+    for (int i = 0; i < found; i++) {
+        BroadphasePair pair = solver->pairs[i];
+        if (!PhysicsBodiesInteract(&solver->bodies[pair.a], &solver->bodies[pair.b])) continue;
+
+        // Keep the lower body first so each pair resolves the same way round
+        if (pair.a > pair.b) {
+            int swap = pair.a;
+            pair.a = pair.b;
+            pair.b = swap;
+        }
+        solver->pairs[solver->pairCount++] = pair;
+    }
+}
+
+/**
+ * @brief Push a body out of the solid tiles around it
+ *
+ * Speed into a tile is removed.
+ *
+ * @param body Pointer to body
+ * @param world Pointer to game world
+ */
+static void PhysicsPushOutOfTiles(PhysicsBody* body, World* world) {
+    SimReal tileWidth = SimRealFromInt(TILE_WIDTH);
+    SimReal tileHeight = SimRealFromInt(TILE_HEIGHT);
+    SimReal halfTileWidth = SimRealDiv(tileWidth, SimRealFromInt(2));
+    SimReal halfTileHeight = SimRealDiv(tileHeight, SimRealFromInt(2));
+    SimReal skin = SimRealFromFloat(PHYSICS_TILE_SKIN);
+
+    int cellX = SimRealToInt(SimRealDiv(body->x, tileWidth));
+    int cellY = SimRealToInt(SimRealDiv(body->y, tileHeight));
+
+    for (int j = -1; j <= 1; j++) {
+        for (int i = -1; i <= 1; i++) {
+            int tileX = cellX + i;
+            int tileY = cellY + j;
+            if (!WorldIsWallAtPosition(world, (float)(tileX * TILE_WIDTH), (float)(tileY * TILE_HEIGHT))) continue;
+
+            SimReal normalX, normalY, depth;
+            if (!PhysicsCircleBox(
+                body->x, body->y, body->tileRadius,
+                SimRealFromInt(tileX * TILE_WIDTH) + halfTileWidth,
+                SimRealFromInt(tileY * TILE_HEIGHT) + halfTileHeight,
+                halfTileWidth, halfTileHeight,
+                &normalX, &normalY, &depth)) {
+                continue;
+            }
+
+            PhysicsBodyMove(body, SimRealMul(normalX, depth + skin), SimRealMul(normalY, depth + skin));
+
+            SimReal speedX, speedY;
+            PhysicsBodySpeed(body, &speedX, &speedY);
+            SimReal intoWall = SimRealMul(speedX, normalX) + SimRealMul(speedY, normalY);
+            if (intoWall < 0) {
+                body->speedChangeX -= SimRealMul(normalX, intoWall);
+                body->speedChangeY -= SimRealMul(normalY, intoWall);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Resolve the contacts between the collected bodies
+ *
+ * @param solver Pointer to solver
+ * @param world Pointer to game world
+ */
+void PhysicsSolverSolve(PhysicsSolver* solver, World* world) {
+    if (!solver || !world) return;
+
+    // Record how far each entity moved, and rewind it to its start
+    for (int i = 0; i < solver->bodyCount; i++) {
+        PhysicsBody* body = &solver->bodies[i];
+        if (!body->entity) continue;
+
+        body->stepX = SimRealFromFloat(body->entity->x) - body->startX;
+        body->stepY = SimRealFromFloat(body->entity->y) - body->startY;
+        body->x = body->startX;
+        body->y = body->startY;
+    }
+
+    SimReal subSteps = SimRealFromInt(solver->subSteps);
+    for (int step = 1; step <= solver->subSteps; step++) {
+        SimReal progress = SimRealDiv(SimRealFromInt(step), subSteps);
+
+        // Advance each entity along its own move, plus what contacts added
+        for (int i = 0; i < solver->bodyCount; i++) {
+            PhysicsBody* body = &solver->bodies[i];
+            if (!body->entity) continue;
+
+            body->offsetX += SimRealDiv(body->speedChangeX, subSteps);
+            body->offsetY += SimRealDiv(body->speedChangeY, subSteps);
+            body->x = body->startX + SimRealMul(body->stepX, progress) + body->offsetX;
+            body->y = body->startY + SimRealMul(body->stepY, progress) + body->offsetY;
+        }
+
+        // Resolve every nearby pair, several times so chains of contacts settle
+        PhysicsSolverFindPairs(solver);
+        for (int iteration = 0; iteration < solver->iterations; iteration++) {
+            for (int i = 0; i < solver->pairCount; i++) {
+                PhysicsResolvePair(&solver->bodies[solver->pairs[i].a], &solver->bodies[solver->pairs[i].b]);
+            }
+        }
+    }
+
+    // Write back the entities a contact moved
+    for (int i = 0; i < solver->bodyCount; i++) {
+        PhysicsBody* body = &solver->bodies[i];
+        if (!body->entity || !body->touched) continue;
+
+        PhysicsPushOutOfTiles(body, world);
+
+        Entity* entity = body->entity;
+        entity->x = SimRealToFloat(body->x);
+        entity->y = SimRealToFloat(body->y);
+        entity->speedX = SimRealToFloat(SimRealFromFloat(entity->speedX) + body->speedChangeX);
+        entity->speedY = SimRealToFloat(SimRealFromFloat(entity->speedY) + body->speedChangeY);
+    }
+}
@@ -0,0 +1,190 @@
+/**
+ * @file physics.h
+ * @brief Sub-stepped contact solver for entity collisions
+ *
+ * This file defines the solver that settles collisions between players,
+ * balls and enemies. Entities still move themselves and handle their
+ * own walls; the solver then replays the step in sub-steps and resolves
+ * every overlapping pair together (found through a grid broadphase), with impulses along the contact
+ * normal and a partial position correction per iteration, so the result
+ * does not depend on the order entities were updated in. The number of
+ * sub-steps and iterations comes from a quality level, trading CPU for
+ * stability.
+ */
+#ifndef MESSY_GAME_PHYSICS_H
+#define MESSY_GAME_PHYSICS_H
+
+#include <stdbool.h>
+#include "entity.h"
+#include "world.h"
+#include "fixed.h"
+#include "broadphase.h"
+
+#define PHYSICS_MAX_BODIES 512 // Upper bound on bodies in one solve
+#define PHYSICS_MAX_PAIRS 2048 // Upper bound on broadphase pairs in one sub-step
+
+/**
+ * @brief Solver quality levels
+ */
+typedef enum {
+    PHYSICS_QUALITY_LOW,       // One sub-step, few iterations
+    PHYSICS_QUALITY_MEDIUM,    // Default
+    PHYSICS_QUALITY_HIGH,      // Most sub-steps and iterations
+    PHYSICS_QUALITY_COUNT
+} PhysicsQuality;
+
+/**
+ * @brief Body shapes
+ */
+typedef enum {
+    PHYSICS_SHAPE_CIRCLE,      // Circle of radius halfWidth
+    PHYSICS_SHAPE_BOX,         // Axis-aligned box (only collides with circles)
+    PHYSICS_SHAPE_COUNT
+} PhysicsShape;
+
+/**
+ * @brief Collision layers
+ *
+ * Each layer has a fixed set of layers it collides with, and the mass
+ * and restitution its bodies start with.
+ */
+typedef enum {
+    PHYSICS_LAYER_PLAYER,      // Players: collide with everything
+    PHYSICS_LAYER_BALL,        // Balls: collide with players and other balls
+    PHYSICS_LAYER_ENEMY,       // Enemy parts: immovable, collide with players only
+    PHYSICS_LAYER_COUNT
+} PhysicsLayer;
+
+/**
+ * @brief Solver body
+ */
+typedef struct {
+    Entity* entity;            // Entity moved by the body, or NULL for an obstacle
+    PhysicsShape shape;        // Body shape
+    PhysicsLayer layer;        // Collision layer
+    SimReal x;                 // Center X during the solve
+    SimReal y;                 // Center Y during the solve
+    SimReal startX;            // Center X before the entity moved this step
+    SimReal startY;            // Center Y before the entity moved this step
+    SimReal stepX;             // X distance the entity moved this step
+    SimReal stepY;             // Y distance the entity moved this step
+    SimReal offsetX;           // X distance contacts have moved the body so far
+    SimReal offsetY;           // Y distance contacts have moved the body so far
+    SimReal speedChangeX;      // X speed added by contacts so far
+    SimReal speedChangeY;      // Y speed added by contacts so far
+    SimReal halfWidth;         // Radius, or box half width
+    SimReal halfHeight;        // Radius, or box half height
+    SimReal tileRadius;        // Distance kept from solid tiles (0 keeps only the center out)
+    SimReal inverseMass;       // 1 / mass (0 for immovable bodies)
+    SimReal restitution;       // Share of approach speed returned on contact
+    bool touched;              // Whether a contact moved the body
+} PhysicsBody;
+
+/**
+ * @brief Contact solver
+ *
+ * Bodies are collected fresh each step between PhysicsSolverBegin and
+ * PhysicsSolverSolve; nothing carries over between steps.
+ */
+typedef struct {
+    PhysicsBody bodies[PHYSICS_MAX_BODIES]; // Bodies in this step's solve
+    int bodyCount;             // Number of bodies
+    Broadphase broadphase;     // Grid of body bounds, rebuilt each sub-step
+    BroadphasePair pairs[PHYSICS_MAX_PAIRS]; // Pairs that may touch in the current sub-step
+    int pairCount;             // Number of pairs
+    PhysicsQuality quality;    // Current quality level
+    int subSteps;              // Sub-steps per solve
+    int iterations;            // Contact passes per sub-step
+} PhysicsSolver;
+
+/**
+ * @brief Initialize a solver
+ *
+ * @param solver Pointer to solver
+ * @param quality Quality level
+ */
+void PhysicsSolverInit(PhysicsSolver* solver, PhysicsQuality quality);
+
+/**
+ * @brief Change the quality level
+ *
+ * Simulations that must stay in step, such as network peers, need to
+ * use the same level.
+ *
+ * @param solver Pointer to solver
+ * @param quality Quality level
+ */
+void PhysicsSolverSetQuality(PhysicsSolver* solver, PhysicsQuality quality);
+
+/**
+ * @brief Look up a quality level by name
+ *
+ * @param name "low", "medium" or "high"
+ * @param quality Pointer to store the level
+ * @return bool Whether the name is a quality level
+ */
+bool PhysicsQualityFromName(const char* name, PhysicsQuality* quality);
+
+/**
+ * @brief Start collecting bodies for a step
+ *
+ * @param solver Pointer to solver
+ */
+void PhysicsSolverBegin(PhysicsSolver* solver);
+
+/**
+ * @brief Add an entity as a circle body
+ *
+ * Call before the entity moves this step: its current position is taken
+ * as the start of the move that the solve replays.
+ *
+ * @param solver Pointer to solver
+ * @param entity Entity moved by the body
+ * @param radius Collision radius
+ * @param tileRadius Distance kept from solid tiles
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddEntity(PhysicsSolver* solver, Entity* entity, float radius, float tileRadius, PhysicsLayer layer);
+
+/**
+ * @brief Add an immovable circle
+ *
+ * @param solver Pointer to solver
+ * @param x Center X
+ * @param y Center Y
+ * @param radius Radius
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddCircle(PhysicsSolver* solver, float x, float y, float radius, PhysicsLayer layer);
+
+/**
+ * @brief Add an immovable axis-aligned box
+ *
+ * @param solver Pointer to solver
+ * @param x Center X
+ * @param y Center Y
+ * @param halfWidth Half of the box width
+ * @param halfHeight Half of the box height
+ * @param layer Collision layer
+ * @return PhysicsBody* Pointer to the body, or NULL if the solver is full
+ */
+PhysicsBody* PhysicsSolverAddBox(PhysicsSolver* solver, float x, float y, float halfWidth, float halfHeight, PhysicsLayer layer);
+
+/**
+ * @brief Resolve the contacts between the collected bodies
+ *
+ * Each entity's move this step is split over the sub-steps. After each
+ * sub-step, the broadphase finds the pairs that may touch, and every
+ * overlapping pair is pushed apart and given an impulse,
+ * as many times as the quality level allows. Entities a contact moved
+ * are then pushed back out of solid tiles and written back; the others
+ * are left exactly as their own update put them.
+ *
+ * @param solver Pointer to solver
+ * @param world Pointer to game world
+ */
+void PhysicsSolverSolve(PhysicsSolver* solver, World* world);
+
+#endif // MESSY_GAME_PHYSICS_H
@@ -0,0 +1,709 @@
+/**
+ * @file platform.c
+ * @brief Implementation of operating system abstraction layer
+ *
+ * Note: this file must not include raylib.h, since windows.h declares
+ * symbols (Rectangle, CloseWindow, DrawText...) that clash with raylib.
+ */
+
+#include <stdlib.h>
+#include "platform.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <errno.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+/**
+ * @brief Thread handle
+ */
+struct PlatformThread {
+#if defined(_WIN32)
+    HANDLE handle;             // Win32 thread handle
+#else
+    pthread_t handle;          // POSIX thread
+#endif
+    PlatformThreadFunc func;   // Entry point
+    void* userData;            // Entry point argument
+};
+
+/**
+ * @brief Mutex handle
+ */
+struct PlatformMutex {
+#if defined(_WIN32)
+    SRWLOCK lock;              // Slim reader/writer lock used exclusively
+#else
+    pthread_mutex_t lock;      // POSIX mutex
+#endif
+};
+
+/**
+ * @brief Condition variable handle
+ */
+struct PlatformCondition {
+#if defined(_WIN32)
+    CONDITION_VARIABLE condition;  // Win32 condition variable
+#else
+    pthread_cond_t condition;      // POSIX condition variable
+#endif
+};
+
+#define PLATFORM_MAX_WATCHED_DIRECTORIES 16  // Directories one file watcher can follow
+
+/**
+ * @brief File watcher handle
+ */
+struct PlatformFileWatcher {
+#if defined(__linux__)
+    int fd;                    // inotify instance
+    int watches[PLATFORM_MAX_WATCHED_DIRECTORIES];        // Watch descriptors
+    char* directories[PLATFORM_MAX_WATCHED_DIRECTORIES];  // Watched directory paths
+    int watchCount;            // Number of watched directories
+    char buffer[4096];         // Events read but not yet returned
+    int bufferLength;          // Bytes of events in buffer
+    int bufferPosition;        // Offset of next event in buffer
+#else
+    int unused;                // Placeholder, watching is unsupported
+#endif
+};
+
+/**
+ * @brief Map a whole file into memory
+ *
+ * @param path Path to file
+ * @param map Pointer to map structure to fill
+ * @return true If the file was mapped
+ * @return false If the file could not be opened or mapped
+ */
+bool PlatformMapFile(const char* path, PlatformFileMap* map) {
+    if (!path || !map) return false;
+
+    map->data = NULL;
+    map->size = 0;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // Copy-on-write mapping so callers may patch data in place
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+    // The view keeps the mapping object alive
+    CloseHandle(mapping);
+    if (!view) return false;
+
+    map->data = view;
+    map->size = (size_t)fileSize.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    // Private mapping gives copy-on-write pages
+    void* view = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    map->data = view;
+    map->size = (size_t)info.st_size;
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Release a file mapping
+ *
+ * @param map Pointer to map structure (cleared on return)
+ */
+void PlatformUnmapFile(PlatformFileMap* map) {
+    if (!map || !map->data) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(map->data);
+#else
+    munmap(map->data, map->size);
+#endif
+
+    map->data = NULL;
+    map->size = 0;
+}
+
+/**
+ * @brief Native thread entry point that forwards to the user function
+ */
+#if defined(_WIN32)
+static DWORD WINAPI PlatformThreadStart(LPVOID param) {
+    PlatformThread* thread = (PlatformThread*)param;
+    thread->func(thread->userData);
+    return 0;
+}
+#else
+static void* PlatformThreadStart(void* param) {
+    PlatformThread* thread = (PlatformThread*)param;
+    thread->func(thread->userData);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Start a new thread
+ *
+ * @param func Thread entry point
+ * @param userData Pointer passed to the entry point
+ * @return PlatformThread* Thread handle or NULL if failed
+ */
+PlatformThread* PlatformThreadCreate(PlatformThreadFunc func, void* userData) {
+    if (!func) return NULL;
+
+    PlatformThread* thread = (PlatformThread*)malloc(sizeof(PlatformThread));
+    if (!thread) return NULL;
+
+    thread->func = func;
+    thread->userData = userData;
+
+#if defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, PlatformThreadStart, thread, 0, NULL);
+    if (!thread->handle) {
+        free(thread);
+        return NULL;
+    }
+#else
+    if (pthread_create(&thread->handle, NULL, PlatformThreadStart, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+#endif
+
+    return thread;
+}
+
+/**
+ * @brief Wait for a thread to finish and free its handle
+ *
+ * @param thread Thread handle
+ */
+void PlatformThreadJoin(PlatformThread* thread) {
+    if (!thread) return;
+
+#if defined(_WIN32)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+
+    free(thread);
+}
+
+/**
+ * @brief Get the number of logical processors
+ *
+ * @return int Number of logical processors (at least 1)
+ */
+int PlatformGetCpuCount(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int count = (int)info.dwNumberOfProcessors;
+#else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return count > 0 ? count : 1;
+}
+
+/**
+ * @brief Create a mutex
+ *
+ * @return PlatformMutex* Mutex handle or NULL if failed
+ */
+PlatformMutex* PlatformMutexCreate(void) {
+    PlatformMutex* mutex = (PlatformMutex*)malloc(sizeof(PlatformMutex));
+    if (!mutex) return NULL;
+
+#if defined(_WIN32)
+    InitializeSRWLock(&mutex->lock);
+#else
+    if (pthread_mutex_init(&mutex->lock, NULL) != 0) {
+        free(mutex);
+        return NULL;
+    }
+#endif
+
+    return mutex;
+}
+
+/**
+ * @brief Destroy a mutex
+ *
+ * @param mutex Mutex handle (must be unlocked)
+ */
+void PlatformMutexDestroy(PlatformMutex* mutex) {
+    if (!mutex) return;
+
+#if !defined(_WIN32)
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+
+    free(mutex);
+}
+
+/**
+ * @brief Lock a mutex
+ *
+ * @param mutex Mutex handle
+ */
+void PlatformMutexLock(PlatformMutex* mutex) {
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+/**
+ * @brief Unlock a mutex
+ *
+ * @param mutex Mutex handle
+ */
+void PlatformMutexUnlock(PlatformMutex* mutex) {
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
+
+/**
+ * @brief Create a condition variable
+ *
+ * @return PlatformCondition* Condition handle or NULL if failed
+ */
+PlatformCondition* PlatformConditionCreate(void) {
+    PlatformCondition* condition = (PlatformCondition*)malloc(sizeof(PlatformCondition));
+    if (!condition) return NULL;
+
+#if defined(_WIN32)
+    InitializeConditionVariable(&condition->condition);
+#else
+    if (pthread_cond_init(&condition->condition, NULL) != 0) {
+        free(condition);
+        return NULL;
+    }
+#endif
+
+    return condition;
+}
+
+/**
+ * @brief Destroy a condition variable
+ *
+ * @param condition Condition handle (no thread may be waiting)
+ */
+void PlatformConditionDestroy(PlatformCondition* condition) {
+    if (!condition) return;
+
+#if !defined(_WIN32)
+    pthread_cond_destroy(&condition->condition);
+#endif
+
+    free(condition);
+}
+
+/**
+ * @brief Wait on a condition variable
+ *
+ * @param condition Condition handle
+ * @param mutex Mutex handle (locked by the caller)
+ */
+void PlatformConditionWait(PlatformCondition* condition, PlatformMutex* mutex) {
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&condition->condition, &mutex->lock, INFINITE, 0);
+#else
+    pthread_cond_wait(&condition->condition, &mutex->lock);
+#endif
+}
+
+/**
+ * @brief Wake one thread waiting on a condition variable
+ *
+ * @param condition Condition handle
+ */
+void PlatformConditionSignal(PlatformCondition* condition) {
+#if defined(_WIN32)
+    WakeConditionVariable(&condition->condition);
+#else
+    pthread_cond_signal(&condition->condition);
+#endif
+}
+
+/**
+ * @brief Wake all threads waiting on a condition variable
+ *
+ * @param condition Condition handle
+ */
+void PlatformConditionBroadcast(PlatformCondition* condition) {
+#if defined(_WIN32)
+    WakeAllConditionVariable(&condition->condition);
+#else
+    pthread_cond_broadcast(&condition->condition);
+#endif
+}
+
+/**
+ * @brief Create a file watcher
+ *
+ * @return PlatformFileWatcher* Watcher handle or NULL if unsupported or failed
+ */
+PlatformFileWatcher* PlatformFileWatcherCreate(void) {
+#if defined(__linux__)
+    PlatformFileWatcher* watcher = (PlatformFileWatcher*)calloc(1, sizeof(PlatformFileWatcher));
+    if (!watcher) return NULL;
+
+    watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watcher->fd < 0) {
+        free(watcher);
+        return NULL;
+    }
+
+    return watcher;
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * @brief Destroy a file watcher
+ *
+ * @param watcher Watcher handle
+ */
+void PlatformFileWatcherDestroy(PlatformFileWatcher* watcher) {
+    if (!watcher) return;
+
+#if defined(__linux__)
+    for (int i = 0; i < watcher->watchCount; i++) {
+        free(watcher->directories[i]);
+    }
+
+    // Closing the instance removes all watches
+    close(watcher->fd);
+#endif
+
+    free(watcher);
+}
+
+/**
+ * @brief Watch a directory for files being written or replaced
+ *
+ * @param watcher Watcher handle
+ * @param directory Path to directory
+ * @return true If the directory is being watched
+ * @return false If the directory could not be watched
+ */
+bool PlatformFileWatcherAddDirectory(PlatformFileWatcher* watcher, const char* directory) {
+    if (!watcher || !directory) return false;
+
+#if defined(__linux__)
+    for (int i = 0; i < watcher->watchCount; i++) {
+        if (strcmp(watcher->directories[i], directory) == 0) return true;
+    }
+
+    if (watcher->watchCount >= PLATFORM_MAX_WATCHED_DIRECTORIES) return false;
+
+    // Editors either rewrite a file in place or write a temporary and rename it
+    int watch = inotify_add_watch(watcher->fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (watch < 0) return false;
+
+    char* copy = strdup(directory);
+    if (!copy) {
+        inotify_rm_watch(watcher->fd, watch);
+        return false;
+    }
+
+    watcher->watches[watcher->watchCount] = watch;
+    watcher->directories[watcher->watchCount] = copy;
+    watcher->watchCount++;
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Get the next changed file without blocking
+ *
+ * @param watcher Watcher handle
+ * @param path Buffer to store "directory/name" of the changed file
+ * @param pathSize Size of buffer
+ * @return true If a change was returned
+ * @return false If there are no more changes
+ */
+bool PlatformFileWatcherPoll(PlatformFileWatcher* watcher, char* path, size_t pathSize) {
+    if (!watcher || !path || pathSize == 0) return false;
+
+#if defined(__linux__)
+    for (;;) {
+        // Refill the event buffer
+        if (watcher->bufferPosition >= watcher->bufferLength) {
+            ssize_t length = read(watcher->fd, watcher->buffer, sizeof(watcher->buffer));
+            if (length <= 0) return false;
+
+            watcher->bufferLength = (int)length;
+            watcher->bufferPosition = 0;
+        }
+
+        const struct inotify_event* event =
+            (const struct inotify_event*)(watcher->buffer + watcher->bufferPosition);
+        watcher->bufferPosition += (int)(sizeof(struct inotify_event) + event->len);
+
+        // Only events naming a file inside a watched directory are useful
+        if (event->len == 0) continue;
+
+        for (int i = 0; i < watcher->watchCount; i++) {
+            if (watcher->watches[i] == event->wd) {
+                snprintf(path, pathSize, "%s/%s", watcher->directories[i], event->name);
+                return true;
+            }
+        }
+    }
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief UDP socket handle
+ */
+struct PlatformSocket {
+#if defined(_WIN32)
+    SOCKET handle;             // Winsock socket
+#else
+    int handle;                // BSD socket descriptor
+#endif
+};
+
+/**
+ * @brief Convert an address to a sockaddr_in
+ *
+ * @param address Address in host byte order
+ * @param out Pointer to store the socket address
+ */
+static void PlatformAddressToSockaddr(const PlatformAddress* address, struct sockaddr_in* out) {
+    memset(out, 0, sizeof(*out));
+    out->sin_family = AF_INET;
+    out->sin_addr.s_addr = htonl(address->ip);
+    out->sin_port = htons(address->port);
+}
+
+/**
+ * @brief Open a non-blocking UDP socket
+ *
+ * @param port Local port to bind (0 for any free port)
+ * @return PlatformSocket* Socket handle or NULL if failed
+ */
+PlatformSocket* PlatformSocketOpen(uint16_t port) {
+#if defined(_WIN32)
+    // Winsock keeps its own reference count, so every open pairs with a cleanup
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) return NULL;
+
+    SOCKET handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (handle == INVALID_SOCKET) {
+        WSACleanup();
+        return NULL;
+    }
+
+    u_long nonBlocking = 1;
+    bool configured = ioctlsocket(handle, FIONBIO, &nonBlocking) == 0;
+#else
+    int handle = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (handle < 0) return NULL;
+
+    int flags = fcntl(handle, F_GETFL, 0);
+    bool configured = flags >= 0 && fcntl(handle, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+
+    PlatformAddress local = { 0, port };
+    struct sockaddr_in bindAddress;
+    PlatformAddressToSockaddr(&local, &bindAddress);
+    configured = configured && bind(handle, (struct sockaddr*)&bindAddress, sizeof(bindAddress)) == 0;
+
+    PlatformSocket* result = configured ? (PlatformSocket*)malloc(sizeof(PlatformSocket)) : NULL;
+    if (!result) {
+#if defined(_WIN32)
+        closesocket(handle);
+        WSACleanup();
+#else
+        close(handle);
+#endif
+        return NULL;
+    }
+
+    result->handle = handle;
+    return result;
+}
+
+/**
+ * @brief Close a UDP socket
+ *
+ * @param socket Socket handle
+ */
+void PlatformSocketClose(PlatformSocket* socket) {
+    if (!socket) return;
+
+#if defined(_WIN32)
+    closesocket(socket->handle);
+    WSACleanup();
+#else
+    close(socket->handle);
+#endif
+
+    free(socket);
+}
+
+/**
+ * @brief Send a datagram
+ *
+ * @param socket Socket handle
+ * @param address Destination address
+ * @param data Datagram contents
+ * @param size Datagram size in bytes
+ * @return true If the datagram was handed to the OS
+ * @return false If sending failed
+ */
+bool PlatformSocketSend(PlatformSocket* socket, const PlatformAddress* address, const void* data, int size) {
+    if (!socket || !address || !data || size <= 0) return false;
+
+    struct sockaddr_in destination;
+    PlatformAddressToSockaddr(address, &destination);
+
+    int sent = (int)sendto(socket->handle, (const char*)data, size, 0, (struct sockaddr*)&destination, sizeof(destination));
+    return sent == size;
+}
+
+/**
+ * @brief Receive a datagram without blocking
+ *
+ * @param socket Socket handle
+ * @param address Pointer to store the sender's address
+ * @param buffer Buffer to store the datagram
+ * @param size Size of buffer
+ * @return int Datagram size, 0 if none is waiting, or -1 on error
+ */
+int PlatformSocketReceive(PlatformSocket* socket, PlatformAddress* address, void* buffer, int size) {
+    if (!socket || !buffer || size <= 0) return -1;
+
+    struct sockaddr_in source;
+#if defined(_WIN32)
+    int sourceLength = sizeof(source);
+#else
+    socklen_t sourceLength = sizeof(source);
+#endif
+
+    int received = (int)recvfrom(socket->handle, (char*)buffer, size, 0, (struct sockaddr*)&source, &sourceLength);
+    if (received < 0) {
+#if defined(_WIN32)
+        int error = WSAGetLastError();
+        // An ICMP port unreachable from an earlier send is not fatal for UDP
+        return (error == WSAEWOULDBLOCK || error == WSAECONNRESET) ? 0 : -1;
+#else
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNREFUSED) ? 0 : -1;
+#endif
+    }
+
+    if (address) {
+        address->ip = ntohl(source.sin_addr.s_addr);
+        address->port = ntohs(source.sin_port);
+    }
+
+    return received;
+}
+
+/**
+ * @brief Resolve "host" or "host:port" to an address
+ *
+ * @param text Host name or dotted address, with optional port
+ * @param defaultPort Port used when text has none
+ * @param address Pointer to store the address
+ * @return true If the host was resolved
+ * @return false If the host could not be resolved
+ */
+bool PlatformAddressParse(const char* text, uint16_t defaultPort, PlatformAddress* address) {
+    if (!text || !address) return false;
+
+    // Split off the port
+    char host[256];
+    snprintf(host, sizeof(host), "%s", text);
+
+    uint16_t port = defaultPort;
+    char* colon = strrchr(host, ':');
+    if (colon) {
+        *colon = '\0';
+        port = (uint16_t)atoi(colon + 1);
+    }
+
+#if defined(_WIN32)
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) return false;
+#endif
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    struct addrinfo* result = NULL;
+    bool resolved = getaddrinfo(host, NULL, &hints, &result) == 0 && result != NULL;
+    if (resolved) {
+        const struct sockaddr_in* resolvedAddress = (const struct sockaddr_in*)result->ai_addr;
+        address->ip = ntohl(resolvedAddress->sin_addr.s_addr);
+        address->port = port;
+        freeaddrinfo(result);
+    }
+
+#if defined(_WIN32)
+    WSACleanup();
+#endif
+
+    return resolved;
+}
@@ -0,0 +1,263 @@
+/**
+ * @file platform.h
+ * @brief Thin operating system abstraction layer
+ *
+ * This file declares the few OS services the game needs beyond raylib,
+ * such as memory-mapped files, threads, file change notification and UDP
+ * sockets. Implementations live in platform.c and
+ * are selected per platform at compile time.
+ */
+#ifndef MESSY_GAME_PLATFORM_H
+#define MESSY_GAME_PLATFORM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Memory-mapped file view
+ *
+ * The view is copy-on-write: writes through data are private to the
+ * process and never reach the file on disk.
+ */
+typedef struct {
+    void* data;              // Start of mapped view (NULL if not mapped)
+    size_t size;             // Size of the view in bytes
+} PlatformFileMap;
+
+/**
+ * @brief Map a whole file into memory
+ *
+ * @param path Path to file
+ * @param map Pointer to map structure to fill
+ * @return true If the file was mapped
+ * @return false If the file could not be opened or mapped
+ */
+bool PlatformMapFile(const char* path, PlatformFileMap* map);
+
+/**
+ * @brief Release a file mapping
+ *
+ * @param map Pointer to map structure (cleared on return)
+ */
+void PlatformUnmapFile(PlatformFileMap* map);
+
+/**
+ * @brief Opaque thread handle
+ */
+typedef struct PlatformThread PlatformThread;
+
+/**
+ * @brief Opaque mutex handle
+ */
+typedef struct PlatformMutex PlatformMutex;
+
+/**
+ * @brief Opaque condition variable handle
+ */
+typedef struct PlatformCondition PlatformCondition;
+
+/**
+ * @brief Thread entry point
+ *
+ * @param userData Pointer passed to PlatformThreadCreate
+ */
+typedef void (*PlatformThreadFunc)(void* userData);
+
+/**
+ * @brief Start a new thread
+ *
+ * @param func Thread entry point
+ * @param userData Pointer passed to the entry point
+ * @return PlatformThread* Thread handle or NULL if failed
+ */
+PlatformThread* PlatformThreadCreate(PlatformThreadFunc func, void* userData);
+
+/**
+ * @brief Wait for a thread to finish and free its handle
+ *
+ * @param thread Thread handle
+ */
+void PlatformThreadJoin(PlatformThread* thread);
+
+/**
+ * @brief Get the number of logical processors
+ *
+ * @return int Number of logical processors (at least 1)
+ */
+int PlatformGetCpuCount(void);
+
+/**
+ * @brief Create a mutex
+ *
+ * @return PlatformMutex* Mutex handle or NULL if failed
+ */
+PlatformMutex* PlatformMutexCreate(void);
+
+/**
+ * @brief Destroy a mutex
+ *
+ * @param mutex Mutex handle (must be unlocked)
+ */
+void PlatformMutexDestroy(PlatformMutex* mutex);
+
+/**
+ * @brief Lock a mutex
+ *
+ * @param mutex Mutex handle
+ */
+void PlatformMutexLock(PlatformMutex* mutex);
+
+/**
+ * @brief Unlock a mutex
+ *
+ * @param mutex Mutex handle
+ */
+void PlatformMutexUnlock(PlatformMutex* mutex);
+
+/**
+ * @brief Create a condition variable
+ *
+ * @return PlatformCondition* Condition handle or NULL if failed
+ */
+PlatformCondition* PlatformConditionCreate(void);
+
+/**
+ * @brief Destroy a condition variable
+ *
+ * @param condition Condition handle (no thread may be waiting)
+ */
+void PlatformConditionDestroy(PlatformCondition* condition);
+
+/**
+ * @brief Wait on a condition variable
+ *
+ * The mutex must be locked by the caller; it is released while waiting
+ * and locked again before returning. Wake-ups may be spurious.
+ *
+ * @param condition Condition handle
+ * @param mutex Mutex handle
+ */
+void PlatformConditionWait(PlatformCondition* condition, PlatformMutex* mutex);
+
+/**
+ * @brief Wake one thread waiting on a condition variable
+ *
+ * @param condition Condition handle
+ */
+void PlatformConditionSignal(PlatformCondition* condition);
+
+/**
+ * @brief Wake all threads waiting on a condition variable
+ *
+ * @param condition Condition handle
+ */
+void PlatformConditionBroadcast(PlatformCondition* condition);
+
+/**
+ * @brief Opaque file watcher handle
+ */
+typedef struct PlatformFileWatcher PlatformFileWatcher;
+
+/**
+ * @brief Create a file watcher
+ *
+ * Only available where the OS can push change notifications (inotify on
+ * Linux); callers should fall back to polling modification times when
+ * this returns NULL.
+ *
+ * @return PlatformFileWatcher* Watcher handle or NULL if unsupported or failed
+ */
+PlatformFileWatcher* PlatformFileWatcherCreate(void);
+
+/**
+ * @brief Destroy a file watcher
+ *
+ * @param watcher Watcher handle
+ */
+void PlatformFileWatcherDestroy(PlatformFileWatcher* watcher);
+
+/**
+ * @brief Watch a directory for files being written or replaced
+ *
+ * @param watcher Watcher handle
+ * @param directory Path to directory (watching it twice is harmless)
+ * @return true If the directory is being watched
+ * @return false If the directory could not be watched
+ */
+bool PlatformFileWatcherAddDirectory(PlatformFileWatcher* watcher, const char* directory);
+
+/**
+ * @brief Get the next changed file without blocking
+ *
+ * @param watcher Watcher handle
+ * @param path Buffer to store "directory/name" of the changed file
+ * @param pathSize Size of buffer
+ * @return true If a change was returned
+ * @return false If there are no more changes
+ */
+bool PlatformFileWatcherPoll(PlatformFileWatcher* watcher, char* path, size_t pathSize);
+
+/**
+ * @brief Opaque UDP socket handle
+ */
+typedef struct PlatformSocket PlatformSocket;
+
+/**
+ * @brief IPv4 address and port, in host byte order
+ */
+typedef struct {
+    uint32_t ip;               // IPv4 address
+    uint16_t port;             // UDP port
+} PlatformAddress;
+
+/**
+ * @brief Open a non-blocking UDP socket
+ *
+ * @param port Local port to bind (0 for any free port)
+ * @return PlatformSocket* Socket handle or NULL if failed
+ */
+PlatformSocket* PlatformSocketOpen(uint16_t port);
+
+/**
+ * @brief Close a UDP socket
+ *
+ * @param socket Socket handle
+ */
+void PlatformSocketClose(PlatformSocket* socket);
+
+/**
+ * @brief Send a datagram
+ *
+ * @param socket Socket handle
+ * @param address Destination address
+ * @param data Datagram contents
+ * @param size Datagram size in bytes
+ * @return true If the datagram was handed to the OS
+ * @return false If sending failed
+ */
+bool PlatformSocketSend(PlatformSocket* socket, const PlatformAddress* address, const void* data, int size);
+
+/**
+ * @brief Receive a datagram without blocking
+ *
+ * @param socket Socket handle
+ * @param address Pointer to store the sender's address
+ * @param buffer Buffer to store the datagram
+ * @param size Size of buffer
+ * @return int Datagram size, 0 if none is waiting, or -1 on error
+ */
+int PlatformSocketReceive(PlatformSocket* socket, PlatformAddress* address, void* buffer, int size);
+
+/**
+ * @brief Resolve "host" or "host:port" to an address
+ *
+ * @param text Host name or dotted address, with optional port
+ * @param defaultPort Port used when text has none
+ * @param address Pointer to store the address
+ * @return true If the host was resolved
+ * @return false If the host could not be resolved
+ */
+bool PlatformAddressParse(const char* text, uint16_t defaultPort, PlatformAddress* address);
+
+#endif // MESSY_GAME_PLATFORM_H
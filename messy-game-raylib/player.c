@@ -9,6 +9,7 @@
 #include "input.h"
 #include "textures.h"
 #include "renderer.h"
+#include "fixed.h"
 
 /**
 * @brief Create a new player entity
@@ -45,10 +46,13 @@ Entity* PlayerCreate(PlayerType type, float x, float y) {
     playerData->currentXP = 0.0f;
     playerData->maxXP = PLAYER_BASE_MAX_XP;
     playerData->kickForce = PLAYER_BASE_KICK_FORCE;
+    playerData->xpPerHit = PLAYER_XP_PER_HIT;
     playerData->moveSpeed = PLAYER_BASE_MOVE_SPEED;
+    playerData->surfaceFriction = 1.0f;
     playerData->hasSpecialAbility = false;
     playerData->state = PLAYER_STATE_ALIVE;
     playerData->deathTimer = 0.0f;
+    playerData->input = NULL;
 
     // Set type-specific data
     player->typeData = playerData;
@@ -109,114 +113,136 @@ void PlayerUpdate(Entity* player, World* world, float deltaTime) {
 void PlayerHandleMovement(Entity* player, World* world, float deltaTime) {
     if (!player || !world || player->type != ENTITY_PLAYER) return;
 
-    // Get input manager
-    InputManager* input = GetInputManager();
+    // Get player data to access player's level-based stats
+    PlayerData* playerData = PlayerGetData(player);
+    if (!playerData) return;
+
+    // Get this player's input manager
+    InputManager* input = playerData->input;
     if (input == NULL) {
         // Skip movement if no input manager available
         return;
     }
 
-    // Get player data to access player's level-based stats
-    PlayerData* playerData = PlayerGetData(player);
-    if (!playerData) return;
-
     // Store previous position for collision resolution
-    float prevX = player->x;
-    float prevY = player->y;
+    SimReal prevX = SimRealFromFloat(player->x);
+    SimReal prevY = SimRealFromFloat(player->y);
+    SimReal x = prevX;
+    SimReal y = prevY;
+    SimReal speedX = SimRealFromFloat(player->speedX);
+    SimReal speedY = SimRealFromFloat(player->speedY);
 
     // Handle movement input using the input manager
     Vector2 moveDir = InputManagerGetMovementVector(input);
+    SimReal dt = SimRealFromFloat(deltaTime);
+    SimReal moveSpeed = SimRealFromFloat(playerData->moveSpeed);
+
+    // Slippery tiles give less grip to speed up and slow down with;
+    // tiles with more friction than floor drag the top speed down instead
+    SimReal one = SimRealFromInt(1);
+    SimReal surfaceFriction = SimRealFromFloat(playerData->surfaceFriction);
+    SimReal grip = surfaceFriction < one ? surfaceFriction : one;
 
     // Apply acceleration based on input direction and player's move speed
-    player->speedX += moveDir.x * PLAYER_ACCEL * deltaTime * playerData->moveSpeed;
-    player->speedY += moveDir.y * PLAYER_ACCEL * deltaTime * playerData->moveSpeed;
+    SimReal accel = SimRealMul(SimRealFromFloat(PLAYER_ACCEL), grip);
+    speedX += SimRealMul(SimRealMul(SimRealMul(SimRealFromFloat(moveDir.x), accel), dt), moveSpeed);
+    speedY += SimRealMul(SimRealMul(SimRealMul(SimRealFromFloat(moveDir.y), accel), dt), moveSpeed);
 
     // Apply deceleration if no input in that direction
+    SimReal decel = SimRealMul(SimRealMul(SimRealFromFloat(PLAYER_DECEL), dt), surfaceFriction);
     if (moveDir.x == 0) {
-        if (player->speedX > 0) {
-            player->speedX -= PLAYER_DECEL * deltaTime;
-            if (player->speedX < 0) player->speedX = 0;
+        if (speedX > 0) {
+            speedX -= decel;
+            if (speedX < 0) speedX = 0;
         }
-        else if (player->speedX < 0) {
-            player->speedX += PLAYER_DECEL * deltaTime;
-            if (player->speedX > 0) player->speedX = 0;
+        else if (speedX < 0) {
+            speedX += decel;
+            if (speedX > 0) speedX = 0;
         }
     }
 
     if (moveDir.y == 0) {
-        if (player->speedY > 0) {
-            player->speedY -= PLAYER_DECEL * deltaTime;
-            if (player->speedY < 0) player->speedY = 0;
+        if (speedY > 0) {
+            speedY -= decel;
+            if (speedY < 0) speedY = 0;
         }
-        else if (player->speedY < 0) {
-            player->speedY += PLAYER_DECEL * deltaTime;
-            if (player->speedY > 0) player->speedY = 0;
+        else if (speedY < 0) {
+            speedY += decel;
+            if (speedY > 0) speedY = 0;
         }
     }
 
     // Apply speed limits adjusted for player's level-based move speed
-    float maxSpeed = PLAYER_MAX_SPEED * playerData->moveSpeed;
-    if (player->speedX > maxSpeed) player->speedX = maxSpeed;
-    if (player->speedX < -maxSpeed) player->speedX = -maxSpeed;
-    if (player->speedY > maxSpeed) player->speedY = maxSpeed;
-    if (player->speedY < -maxSpeed) player->speedY = -maxSpeed;
+    SimReal maxSpeed = SimRealMul(SimRealFromFloat(PLAYER_MAX_SPEED), moveSpeed);
+    if (surfaceFriction > one) {
+        maxSpeed = SimRealDiv(maxSpeed, surfaceFriction);
+    }
+    if (speedX > maxSpeed) speedX = maxSpeed;
+    if (speedX < -maxSpeed) speedX = -maxSpeed;
+    if (speedY > maxSpeed) speedY = maxSpeed;
+    if (speedY < -maxSpeed) speedY = -maxSpeed;
 
     // Update position based on speed
     // Try horizontal movement first
-    player->x += player->speedX;
+    x += speedX;
 
     // Check for collision with walls in horizontal direction
-    if (WorldIsWallAtPosition(world, player->x, player->y)) {
+    if (WorldIsWallAtPosition(world, SimRealToFloat(x), SimRealToFloat(y))) {
         // Revert to previous position in x direction
-        player->x = prevX;
-        player->speedX = 0;
+        x = prevX;
+        speedX = 0;
     }
 
     // Then try vertical movement
-    player->y += player->speedY;
+    y += speedY;
 
     // Check for collision with walls in vertical direction
-    if (WorldIsWallAtPosition(world, player->x, player->y)) {
+    if (WorldIsWallAtPosition(world, SimRealToFloat(x), SimRealToFloat(y))) {
         // Revert to previous position in y direction
-        player->y = prevY;
-        player->speedY = 0;
+        y = prevY;
+        speedY = 0;
     }
 
     // Update facing direction based on movement
-    if (fabs(player->speedX) > fabs(player->speedY)) {
+    if (SimRealAbs(speedX) > SimRealAbs(speedY)) {
         // Horizontal movement dominates
-        if (player->speedX > 0) player->facing = DIRECTION_RIGHT;
-        else if (player->speedX < 0) player->facing = DIRECTION_LEFT;
+        if (speedX > 0) player->facing = DIRECTION_RIGHT;
+        else if (speedX < 0) player->facing = DIRECTION_LEFT;
     }
-    else if (player->speedY != 0) {
+    else if (speedY != 0) {
         // Vertical movement dominates
-        if (player->speedY > 0) player->facing = DIRECTION_DOWN;
-        else if (player->speedY < 0) player->facing = DIRECTION_UP;
+        if (speedY > 0) player->facing = DIRECTION_DOWN;
+        else if (speedY < 0) player->facing = DIRECTION_UP;
     }
 
     // Enforce boundaries to prevent going off-screen
-    float worldWidthPixels = world->width * TILE_WIDTH;
-    float worldHeightPixels = world->height * TILE_HEIGHT;
+    SimReal worldWidthPixels = SimRealFromInt(world->width * TILE_WIDTH);
+    SimReal worldHeightPixels = SimRealFromInt(world->height * TILE_HEIGHT);
 
     // Add a small buffer from the edges
-    float buffer = 5.0f;
-    if (player->x < buffer) {
-        player->x = buffer;
-        player->speedX = 0;
+    SimReal buffer = SimRealFromInt(5);
+    if (x < buffer) {
+        x = buffer;
+        speedX = 0;
     }
-    else if (player->x > worldWidthPixels - buffer) {
-        player->x = worldWidthPixels - buffer;
-        player->speedX = 0;
+    else if (x > worldWidthPixels - buffer) {
+        x = worldWidthPixels - buffer;
+        speedX = 0;
     }
 
-    if (player->y < buffer) {
-        player->y = buffer;
-        player->speedY = 0;
+    if (y < buffer) {
+        y = buffer;
+        speedY = 0;
     }
-    else if (player->y > worldHeightPixels - buffer) {
-        player->y = worldHeightPixels - buffer;
-        player->speedY = 0;
+    else if (y > worldHeightPixels - buffer) {
+        y = worldHeightPixels - buffer;
+        speedY = 0;
     }
+
+    player->x = SimRealToFloat(x);
+    player->y = SimRealToFloat(y);
+    player->speedX = SimRealToFloat(speedX);
+    player->speedY = SimRealToFloat(speedY);
 }
 
 /**
@@ -342,23 +368,21 @@ bool PlayerAwardXP(Entity* player, float xpAmount) {
 * @brief Render player with appropriate animation
 *
 * @param player Pointer to player entity
+* @param renderer Renderer to draw with
 */
-void PlayerRender(Entity* player) {
-    if (!player || player->type != ENTITY_PLAYER) return;
+void PlayerRender(Entity* player, Renderer* renderer) {
+    if (!player || !renderer || player->type != ENTITY_PLAYER) return;
 
     PlayerData* playerData = (PlayerData*)player->typeData;
     if (!playerData) return;
 
-    // Handle death screen separately
-    if (playerData->state == PLAYER_STATE_DEAD) {
-        PlayerRenderDeathScreen(player);
-        return;
-    }
+    // Dead players wait off the field; the game draws the death screen
+    // once every local player is down
+    if (playerData->state == PLAYER_STATE_DEAD) return;
 
-    // Get texture manager and renderer
-    TextureManager* textures = GetTextureManager();
-    Renderer* renderer = GetRenderer();
-    if (!textures || !renderer) return;
+    // Textures come from the renderer's texture manager
+    TextureManager* textures = renderer->textures;
+    if (!textures) return;
 
     // Calculate source rectangle based on animation state
     int sourceX = 0;
@@ -479,6 +503,30 @@ PlayerData* PlayerGetData(Entity* player) {
     return (PlayerData*)player->typeData;
 }
 
+/**
+* @brief Check whether a player is alive
+*
+* @param player Pointer to player entity
+* @return bool Whether the player is alive (false while dying or dead)
+*/
+bool PlayerIsAlive(Entity* player) {
+    PlayerData* playerData = PlayerGetData(player);
+    return playerData && playerData->state == PLAYER_STATE_ALIVE;
+}
+
+/**
+* @brief Set the input manager that drives a player
+*
+* @param player Pointer to player entity
+* @param input Input manager (NULL to use the global input manager)
+*/
+void PlayerSetInput(Entity* player, InputManager* input) {
+    PlayerData* playerData = PlayerGetData(player);
+    if (!playerData) return;
+
+    playerData->input = input;
+}
+
 /**
 * @brief Handle player death
 *
@@ -521,9 +569,9 @@ bool PlayerHandleDeath(Entity* player, float deltaTime) {
             return true; // Death sequence is complete
         }
 
-        // Check for key press to skip death screen
-        if (IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_ENTER) ||
-            IsKeyPressed(KEY_ESCAPE) || IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+        // Check for this player's input to skip death screen
+        if (InputManagerIsActionJustPressed(playerData->input, ACTION_ATTACK) ||
+            InputManagerIsActionJustPressed(playerData->input, ACTION_INTERACT)) {
             return true; // Skip death screen on input
         }
     }
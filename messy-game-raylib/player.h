@@ -9,6 +9,7 @@
 #define MESSY_GAME_PLAYER_H
 #include "entity.h"
 #include "world.h"
+#include "input.h"
 #define PLAYER_BASE_KICK_FORCE 5.0f // Base kick force
 #define PLAYER_BASE_MOVE_SPEED 1.0f // Base movement multiplier
 #define PLAYER_KICK_FORCE_PER_LEVEL 0.5f // 50% kick force increase per level
@@ -81,10 +82,13 @@ typedef struct {
     float currentXP;          // Current XP
     float maxXP;              // XP needed for next level
     float kickForce;          // Force applied when kicking the ball
+    float xpPerHit;           // XP gained per successful enemy hit
     float moveSpeed;          // Movement speed multiplier
+    float surfaceFriction;    // Friction multiplier of the tile underfoot (set each step)
     bool hasSpecialAbility;   // Whether player has special ability
     PlayerState state;        // Current player state
     float deathTimer;         // Timer for death animation and screen
+    InputManager* input;      // Input driving this player (NULL = player stands still)
     // Add more player-specific attributes as needed
 } PlayerData;
 
@@ -121,8 +125,9 @@ bool PlayerAwardXP(Entity* player, float xpAmount);
 * @brief Render player with appropriate animation
 *
 * @param player Pointer to player entity
+* @param renderer Renderer to draw with
 */
-void PlayerRender(Entity* player);
+void PlayerRender(Entity* player, struct Renderer* renderer);
 
 /**
 * @brief Handle player movement based on input
@@ -158,6 +163,22 @@ void PlayerReset(Entity* player, float x, float y);
 */
 PlayerData* PlayerGetData(Entity* player);
 
+/**
+* @brief Check whether a player is alive
+*
+* @param player Pointer to player entity
+* @return bool Whether the player is alive (false while dying or dead)
+*/
+bool PlayerIsAlive(Entity* player);
+
+/**
+* @brief Set the input manager that drives a player
+*
+* @param player Pointer to player entity
+* @param input Input manager (NULL to use the global input manager)
+*/
+void PlayerSetInput(Entity* player, InputManager* input);
+
 /**
 * @brief Handle player death
 *
@@ -3,36 +3,100 @@
 #include "entity.h"
 #include "player.h"
 #include "tile.h"
+#include "config.h"
+#include "rlgl.h"
 #include <stdlib.h>
 #include <math.h>
 
-static Renderer* gRenderer = NULL;
-
-Renderer* GetRenderer(void) {
-    return gRenderer;
-}
-
-void SetRenderer(Renderer* renderer) {
-    gRenderer = renderer;
-}
-
 Renderer* RendererCreate(int screenWidth, int screenHeight, TextureManager* textures) {
     Renderer* renderer = (Renderer*)malloc(sizeof(Renderer));
     if (renderer) {
         renderer->screenWidth = screenWidth;
         renderer->screenHeight = screenHeight;
         renderer->textures = textures;
-        SetRenderer(renderer);
+        renderer->tileOverlays = (RenderTexture2D){ 0 };
+        renderer->tileOverlaysBaked = false;
     }
     return renderer;
 }
 
 void RendererDestroy(Renderer* renderer) {
     if (!renderer) return;
-    if (gRenderer == renderer) gRenderer = NULL;
+    if (renderer->tileOverlaysBaked) {
+        UnloadRenderTexture(renderer->tileOverlays);
+    }
     free(renderer);
 }
 
+/**
+ * @brief Bake one overlay sprite per tile flag combination
+ *
+ * The sprites sit side by side in one render texture, so drawing an
+ * overlay is a single textured quad however many flags it shows. They
+ * are drawn without blending, so each pixel keeps the colour and alpha
+ * of its indicator and the sprite looks the same as the indicators drawn
+ * straight onto the screen.
+ *
+ * @param renderer Pointer to renderer
+ * @return bool Whether the sprites were baked
+ */
+bool RendererBakeTileOverlays(Renderer* renderer) {
+    if (!renderer) return false;
+    if (renderer->tileOverlaysBaked) return true;
+
+    RenderTexture2D target = LoadRenderTexture(TILE_WIDTH * TILE_OVERLAY_COUNT, TILE_HEIGHT);
+    if (target.id == 0) {
+        TraceLog(LOG_WARNING, "Failed to create tile overlay texture, drawing overlays directly");
+        return false;
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+
+    // Alpha blending into the clear texture would store the translucent
+    // damage outline with its alpha squared; writing the source as-is does
+    // not. Only opaque indicators are drawn over it, so they still win.
+    rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM);
+    for (int i = 1; i < TILE_OVERLAY_COUNT; i++) {
+        // Sprite i shows the overlay flags whose bits make up i
+        TileDrawFlagIndicators((unsigned int)i << 1, i * TILE_WIDTH, 0);
+    }
+    EndBlendMode();
+    EndTextureMode();
+
+    renderer->tileOverlays = target;
+    renderer->tileOverlaysBaked = true;
+    return true;
+}
+
+/**
+ * @brief Draw the overlay for a tile's flags
+ *
+ * @param renderer Pointer to renderer
+ * @param flags Combination of TileFlags
+ * @param destX Destination X position
+ * @param destY Destination Y position
+ */
+void RendererDrawTileOverlay(Renderer* renderer, unsigned int flags, int destX, int destY) {
+    int index = TileGetOverlayIndex(flags);
+    if (!renderer || index == 0) return;
+
+    if (!renderer->tileOverlaysBaked) {
+        TileDrawFlagIndicators(flags, destX, destY);
+        return;
+    }
+
+    // Render textures are stored upside down, hence the negative height
+    Rectangle source = {
+        (float)(index * TILE_WIDTH),
+        0.0f,
+        (float)TILE_WIDTH,
+        -(float)TILE_HEIGHT
+    };
+    DrawTextureRec(renderer->tileOverlays.texture, source, (Vector2) { (float)destX, (float)destY }, WHITE);
+}
+
 void RendererBeginFrame(Renderer* renderer) {
     BeginDrawing();
     ClearBackground(RAYWHITE);
@@ -160,14 +224,10 @@ void RendererDrawHUD(Renderer* renderer, Entity* player) {
  * @param tint Color tint for rendering
  */
 void RendererDrawPlayerSprite(Renderer* renderer, TextureID textureID, int sourceX, int sourceY, int destX, int destY, Color tint) {
-    if (!renderer) return;
-
-    // Get texture manager
-    TextureManager* textures = GetTextureManager();
-    if (!textures) return;
+    if (!renderer || !renderer->textures) return;
 
     // Get texture info
-    TextureInfo* info = TextureManagerGetInfo(textures, textureID);
+    TextureInfo* info = TextureManagerGetInfo(renderer->textures, textureID);
     if (!info || !info->loaded) {
         // Texture not loaded, draw a placeholder rectangle
         DrawRectangle(destX, destY, SPRITE_WIDTH, SPRITE_HEIGHT, PURPLE);
@@ -230,12 +290,9 @@ void RendererDrawTile(Renderer* renderer, Tile* tile, int destX, int destY) {
  * @brief Draw a tile using texture coordinates
  */
 void RendererDrawTileFromSheet(Renderer* renderer, TextureID textureID, int sourceX, int sourceY, int destX, int destY, Color tint) {
-    if (!renderer) return;
-
-    TextureManager* textures = GetTextureManager();
-    if (!textures) return;
+    if (!renderer || !renderer->textures) return;
 
-    TextureInfo* info = TextureManagerGetInfo(textures, textureID);
+    TextureInfo* info = TextureManagerGetInfo(renderer->textures, textureID);
     if (!info || !info->loaded) return;
 
     // Calculate source rectangle
@@ -328,6 +385,52 @@ void RendererDrawGrid(Renderer* renderer, int tileWidth, int tileHeight, Color g
     }
 }
 
+/**
+* @brief Draw the loading screen
+*
+* Shows the game title and a progress bar while assets load.
+*
+* @param renderer Pointer to renderer
+* @param progress Loading progress from 0.0 to 1.0
+*/
+void RendererDrawLoadingScreen(Renderer* renderer, float progress) {
+    if (!renderer) return;
+
+    if (progress < 0.0f) progress = 0.0f;
+    if (progress > 1.0f) progress = 1.0f;
+
+    ClearBackground(BLACK);
+
+    // Draw title centered above the bar
+    int titleSize = 30;
+    int titleWidth = MeasureText(GAME_TITLE, titleSize);
+    DrawText(
+        GAME_TITLE,
+        (renderer->screenWidth - titleWidth) / 2,
+        renderer->screenHeight / 2 - 60,
+        titleSize,
+        WHITE
+    );
+
+    // Draw progress bar
+    int barWidth = renderer->screenWidth * 2 / 3;
+    int barHeight = 20;
+    int barX = (renderer->screenWidth - barWidth) / 2;
+    int barY = renderer->screenHeight / 2;
+
+    DrawRectangle(barX, barY, barWidth, barHeight, DARKGRAY);
+    DrawRectangle(barX, barY, (int)(barWidth * progress), barHeight, GREEN);
+    DrawRectangleLines(barX, barY, barWidth, barHeight, WHITE);
+
+    DrawText(
+        TextFormat("Loading... %d%%", (int)(progress * 100.0f)),
+        barX,
+        barY + barHeight + 10,
+        20,
+        WHITE
+    );
+}
+
 /**
  * @brief Draw special effects
  */
@@ -35,15 +35,18 @@ typedef enum {
 /**
  * @brief Renderer structure
  *
- * Manages rendering operations and state.
+ * Manages rendering operations and state. Passed to every render function
+ * as the render context, so nothing is looked up through globals.
  */
-typedef struct {
+typedef struct Renderer {
     int screenWidth;             // Screen width
     int screenHeight;            // Screen height
     bool debugMode;              // Whether debug rendering is enabled
     TextureManager* textures;    // Texture manager
     Color backgroundColor;       // Background color
     bool enableEffects;          // Whether to render special effects
+    RenderTexture2D tileOverlays; // Baked tile flag overlays, one per combination side by side
+    bool tileOverlaysBaked;      // Whether tileOverlays holds the baked sprites
     // Add more renderer attributes as needed
 } Renderer;
 
@@ -101,6 +104,30 @@ void RendererDrawTile(Renderer* renderer, Tile* tile, int destX, int destY);
  */
 void RendererDrawTileFromSheet(Renderer* renderer, TextureID textureID, int sourceX, int sourceY, int destX, int destY, Color tint);
 
+/**
+ * @brief Bake one overlay sprite per tile flag combination
+ *
+ * Needs the window to be open; call once after InitWindow, outside of
+ * any drawing.
+ *
+ * @param renderer Pointer to renderer
+ * @return bool Whether the sprites were baked
+ */
+bool RendererBakeTileOverlays(Renderer* renderer);
+
+/**
+ * @brief Draw the overlay for a tile's flags
+ *
+ * Draws the baked sprite, or the primitives if the sprites are not
+ * baked yet.
+ *
+ * @param renderer Pointer to renderer
+ * @param flags Combination of TileFlags
+ * @param destX Destination X position
+ * @param destY Destination Y position
+ */
+void RendererDrawTileOverlay(Renderer* renderer, unsigned int flags, int destX, int destY);
+
 /**
  * @brief Draw an entity sprite
  *
@@ -148,6 +175,14 @@ void RendererDrawGrid(Renderer* renderer, int tileWidth, int tileHeight, Color g
  */
 void RendererDrawHUD(Renderer* renderer, Entity* player);
 
+/**
+ * @brief Draw the loading screen
+ *
+ * @param renderer Pointer to renderer
+ * @param progress Loading progress from 0.0 to 1.0
+ */
+void RendererDrawLoadingScreen(Renderer* renderer, float progress);
+
 /**
  * @brief Draw special effects
  *
@@ -175,6 +210,4 @@ void RendererSetDebugMode(Renderer* renderer, bool enabled);
  */
 void RendererSetEffects(Renderer* renderer, bool enabled);
 
-Renderer* GetRenderer(void);
-
 #endif // MESSY_GAME_RENDERER_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * @file rng.c
+ * @brief Implementation of deterministic pseudo-random number generator
+ */
+
+#include "rng.h"
+
+// PCG32 multiplier (Knuth's MMIX LCG constant)
+#define RNG_MULTIPLIER 6364136223846793005ULL
+
+/**
+ * @brief Seed a generator
+ *
+ * Follows the reference pcg32_srandom_r seeding sequence.
+ *
+ * @param rng Pointer to generator
+ * @param seed Seed value
+ * @param stream Stream identifier selecting an independent sequence
+ */
+void RngSeed(Rng* rng, uint64_t seed, uint64_t stream) {
+    if (!rng) return;
+
+    rng->state = 0;
+    rng->increment = (stream << 1u) | 1u;
+    RngNext(rng);
+    rng->state += seed;
+    RngNext(rng);
+}
+
+/**
+ * @brief Get the next 32-bit random value
+ *
+ * @param rng Pointer to generator
+ * @return uint32_t Uniformly distributed value
+ */
+uint32_t RngNext(Rng* rng) {
+    uint64_t oldState = rng->state;
+
+    // Advance the LCG
+    rng->state = oldState * RNG_MULTIPLIER + rng->increment;
+
+    // Permute the old state: xorshift high bits, then random rotate
+    uint32_t xorShifted = (uint32_t)(((oldState >> 18u) ^ oldState) >> 27u);
+    uint32_t rotation = (uint32_t)(oldState >> 59u);
+    return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+}
+
+/**
+ * @brief Get a random integer in an inclusive range
+ *
+ * Uses Lemire's multiply-shift reduction with rejection, so every value in
+ * the range is equally likely.
+ *
+ * @param rng Pointer to generator
+ * @param min Minimum value (inclusive)
+ * @param max Maximum value (inclusive)
+ * @return int Random value between min and max
+ */
+int RngRange(Rng* rng, int min, int max) {
+    if (!rng) return min;
+
+    // Accept reversed bounds the same way GetRandomValue does
+    if (min > max) {
+        int temp = min;
+        min = max;
+        max = temp;
+    }
+
+    uint32_t range = (uint32_t)((int64_t)max - (int64_t)min) + 1u;
+
+    // Full 32-bit range needs no reduction
+    if (range == 0) return (int)((int64_t)min + RngNext(rng));
+
+    uint64_t product = (uint64_t)RngNext(rng) * range;
+    uint32_t low = (uint32_t)product;
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = (uint64_t)RngNext(rng) * range;
+            low = (uint32_t)product;
+        }
+    }
+
+    return (int)((int64_t)min + (int64_t)(product >> 32));
+}
+
+/**
+ * @brief Get a random float in [0, 1)
+ *
+ * @param rng Pointer to generator
+ * @return float Random value
+ */
+float RngFloat(Rng* rng) {
+    if (!rng) return 0.0f;
+
+    // Use the top 24 bits so every result is exactly representable
+    return (float)(RngNext(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Get a random float in [min, max)
+ *
+ * @param rng Pointer to generator
+ * @param min Minimum value (inclusive)
+ * @param max Maximum value (exclusive)
+ * @return float Random value
+ */
+float RngFloatRange(Rng* rng, float min, float max) {
+    return min + (max - min) * RngFloat(rng);
+}
@@ -0,0 +1,90 @@
+/**
+ * @file rng.h
+ * @brief Deterministic pseudo-random number generator
+ *
+ * This file defines a small, seedable PCG32 generator used by gameplay
+ * code instead of raylib's GetRandomValue. Each system owns its own
+ * generator so results are reproducible for replays, lockstep networking
+ * and parallel simulations.
+ */
+#ifndef MESSY_GAME_RNG_H
+#define MESSY_GAME_RNG_H
+
+#include <stdint.h>
+
+/**
+ * @brief Random stream identifiers
+ *
+ * Each system seeds its generator from the game seed plus its own stream,
+ * so adding random calls to one system never shifts the sequence of another.
+ */
+typedef enum {
+    RNG_STREAM_GAME,           // Top-level game generator
+    RNG_STREAM_WIN_CONDITION,  // Hole ejection and thunder effects
+    RNG_STREAM_MATCH,          // Match celebration effects
+    RNG_STREAM_WORLD,          // World and level generation
+    RNG_STREAM_ENEMIES,        // Enemy decision making
+    RNG_STREAM_NETWORK,        // Simulated packet loss
+    RNG_STREAM_BOT,            // Scripted players' aim and reaction jitter
+    // Add more streams as needed
+    RNG_STREAM_COUNT
+} RngStream;
+
+/**
+ * @brief Random number generator state
+ *
+ * PCG32 (XSH-RR) state. Plain data, so it can be copied into snapshots.
+ */
+typedef struct {
+    uint64_t state;          // Current internal state
+    uint64_t increment;      // Stream selector (always odd)
+} Rng;
+
+/**
+ * @brief Seed a generator
+ *
+ * @param rng Pointer to generator
+ * @param seed Seed value
+ * @param stream Stream identifier selecting an independent sequence
+ */
+void RngSeed(Rng* rng, uint64_t seed, uint64_t stream);
+
+/**
+ * @brief Get the next 32-bit random value
+ *
+ * @param rng Pointer to generator
+ * @return uint32_t Uniformly distributed value
+ */
+uint32_t RngNext(Rng* rng);
+
+/**
+ * @brief Get a random integer in an inclusive range
+ *
+ * Drop-in replacement for GetRandomValue(min, max), without modulo bias.
+ *
+ * @param rng Pointer to generator
+ * @param min Minimum value (inclusive)
+ * @param max Maximum value (inclusive)
+ * @return int Random value between min and max
+ */
+int RngRange(Rng* rng, int min, int max);
+
+/**
+ * @brief Get a random float in [0, 1)
+ *
+ * @param rng Pointer to generator
+ * @return float Random value
+ */
+float RngFloat(Rng* rng);
+
+/**
+ * @brief Get a random float in [min, max)
+ *
+ * @param rng Pointer to generator
+ * @param min Minimum value (inclusive)
+ * @param max Maximum value (exclusive)
+ * @return float Random value
+ */
+float RngFloatRange(Rng* rng, float min, float max);
+
+#endif // MESSY_GAME_RNG_H
@@ -8,6 +8,9 @@
 #include "room.h"
 #include "config.h"
 #include "camera.h"
+#include "renderer.h"
+#include "level.h"
+#include "platform.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -43,6 +46,8 @@ Room* RoomCreate(int id, RoomType type, int x, int y, int width, int height) {
     room->connections = CONNECTION_NONE;
     room->isDiscovered = false;
     room->isCleared = false;
+    room->roomTime = 0.0f;
+    room->state = ROOM_STATE_READY;
 
     // Set bounds rectangle
     room->bounds = (Rectangle){
@@ -184,19 +189,18 @@ void RoomUpdate(Room* room, float deltaTime) {
     // - Handle room-specific animations or effects
 
     // For now, just track time for potential animations
-    static float roomTime = 0.0f;
-    roomTime += deltaTime;
+    room->roomTime += deltaTime;
 
     // Reset room time if it gets too large to prevent float precision issues
-    if (roomTime > 1000.0f) {
-        roomTime = 0.0f;
+    if (room->roomTime > 1000.0f) {
+        room->roomTime = 0.0f;
     }
 }
 
 /**
 * @brief Determine if a wall should be rendered as vertical
 *
-* Checks if a wall tile is in a position that should be drawn as vertical.
+* Checks if a wall tile is part of a vertical run of walls.
 *
 * @param room Pointer to room
 * @param x X position in room
@@ -206,16 +210,17 @@ void RoomUpdate(Room* room, float deltaTime) {
 bool IsVerticalWall(Room* room, int x, int y) {
     if (!room) return false;
 
-    // Calculate world center coordinates
-    int centerX = room->width / 2;
-    int centerY = room->height / 2;
+    // Border walls are never drawn as vertical
+    if (x <= 0 || y <= 0 || x >= room->width - 1 || y >= room->height - 1) {
+        return false;
+    }
 
-    // Check if this is one of the vertical walls
-    if ((x == centerX - 4 || x == centerX + 4) && abs(y - centerY) <= 1) {
-        return true;
+    // A vertical wall has open space on both sides and wall above or below
+    if (room->tiles[x - 1][y].type == TILE_TYPE_WALL || room->tiles[x + 1][y].type == TILE_TYPE_WALL) {
+        return false;
     }
 
-    return false;
+    return room->tiles[x][y - 1].type == TILE_TYPE_WALL || room->tiles[x][y + 1].type == TILE_TYPE_WALL;
 }
 
 /**
@@ -225,44 +230,31 @@ bool IsVerticalWall(Room* room, int x, int y) {
 * Only renders tiles that are visible within the camera view.
 *
 * @param room Pointer to room
+* @param renderer Renderer to draw with
 * @param camera Pointer to Camera2D
 */
-void RoomRender(Room* room, Camera2D* camera) {
+void RoomRender(Room* room, Renderer* renderer, Camera2D* camera) {
     if (!room) return;
 
     // Calculate world position of room
     float roomX = room->x * TILE_WIDTH;
     float roomY = room->y * TILE_HEIGHT;
 
-    // Calculate center of the room for obstacle placement
-    int centerX = room->width / 2;
-    int centerY = room->height / 2;
-
-    // Draw floor tiles first (as a background)
+    // Draw each tile from the room's tile grid
     for (int x = 0; x < room->width; x++) {
         for (int y = 0; y < room->height; y++) {
             float tileX = roomX + x * TILE_WIDTH;
             float tileY = roomY + y * TILE_HEIGHT;
+            Tile* tile = &room->tiles[x][y];
 
-            // Check if this is a wall or not
-            bool isWall = false;
-            bool isVertical = false;
-
-            // Border walls
-            if (x == 0 || y == 0 || x == room->width - 1 || y == room->height - 1) {
-                isWall = true;
+            // Special tiles (water, lava, doors...) draw themselves
+            if (tile->type != TILE_TYPE_WALL && tile->type != TILE_TYPE_EMPTY) {
+                TileRender(tile, renderer, (int)tileX, (int)tileY);
+                continue;
             }
 
-            // Horizontal wall in the middle
-            if (y == centerY && abs(x - centerX) <= 2) {
-                isWall = true;
-            }
-
-            // Vertical walls on sides - THIS IS THE KEY PART THAT NEEDS FIXING
-            if ((x == centerX - 4 || x == centerX + 4) && abs(y - centerY) <= 1) {
-                isWall = true;
-                isVertical = true; // Mark as vertical wall for special rendering
-            }
+            bool isWall = tile->type == TILE_TYPE_WALL;
+            bool isVertical = isWall && IsVerticalWall(room, x, y);
 
             if (isWall) {
                 // Draw wall with configured colors
@@ -437,31 +429,13 @@ bool RoomAddConnection(Room* room, ConnectionDirection direction, Room* connecte
         room->connectedRooms[index] = connectedRoom->id;
         room->exits[index] = connectedRoom;
 
-        // Create door tile at the connection point
+        // Create door tile at the connection point, remembering where it leads
         int doorX = 0, doorY = 0;
-        switch (direction) {
-        case CONNECTION_NORTH:
-            doorX = room->width / 2;
-            doorY = 0;
-            break;
-        case CONNECTION_EAST:
-            doorX = room->width - 1;
-            doorY = room->height / 2;
-            break;
-        case CONNECTION_SOUTH:
-            doorX = room->width / 2;
-            doorY = room->height - 1;
-            break;
-        case CONNECTION_WEST:
-            doorX = 0;
-            doorY = room->height / 2;
-            break;
-        default:
-            break;
+        RoomGetDoorPosition(room, direction, &doorX, &doorY);
+        if (RoomSetTile(room, doorX, doorY, TILE_TYPE_DOOR)) {
+            room->tiles[doorX][doorY].data = connectedRoom->id;
         }
 
-        RoomSetTile(room, doorX, doorY, TILE_TYPE_DOOR);
-
         TraceLog(LOG_INFO, "Added connection from room %d to room %d in direction %d",
             room->id, connectedRoom->id, direction);
         return true;
@@ -515,6 +489,43 @@ Room* RoomGetConnected(Room* room, ConnectionDirection direction) {
     return NULL;
 }
 
+/**
+* @brief Get where the door for a direction sits in a room
+*
+* Doors are centered on the wall they are in.
+*
+* @param room Pointer to room
+* @param direction Single connection direction
+* @param x Pointer to store the door X position in the room
+* @param y Pointer to store the door Y position in the room
+* @return true Position stored
+* @return false Invalid direction
+*/
+bool RoomGetDoorPosition(Room* room, ConnectionDirection direction, int* x, int* y) {
+    if (!room || !x || !y) return false;
+
+    switch (direction) {
+    case CONNECTION_NORTH:
+        *x = room->width / 2;
+        *y = 0;
+        return true;
+    case CONNECTION_EAST:
+        *x = room->width - 1;
+        *y = room->height / 2;
+        return true;
+    case CONNECTION_SOUTH:
+        *x = room->width / 2;
+        *y = room->height - 1;
+        return true;
+    case CONNECTION_WEST:
+        *x = 0;
+        *y = room->height / 2;
+        return true;
+    default:
+        return false;
+    }
+}
+
 /**
 * @brief Generate room layout based on type
 *
@@ -613,22 +624,121 @@ void RoomGenerateLayout(Room* room) {
     TraceLog(LOG_INFO, "Generated layout for room ID %d of type %d", room->id, room->type);
 }
 
+/**
+* @brief Copy tile types from a row-major grid into the room
+*
+* Cells outside the grid become walls; unknown tile types become floor.
+*
+* @param room Pointer to room
+* @param grid Row-major grid of TileType values
+* @param gridWidth Width of grid in tiles
+* @param gridHeight Height of grid in tiles
+* @param originX Grid X of the room's top-left tile
+* @param originY Grid Y of the room's top-left tile
+*/
+void RoomLoadTilesFromGrid(Room* room, const unsigned char* grid, int gridWidth, int gridHeight, int originX, int originY) {
+    if (!room || !grid) return;
+
+    for (int x = 0; x < room->width; x++) {
+        for (int y = 0; y < room->height; y++) {
+            int gridX = originX + x;
+            int gridY = originY + y;
+
+            TileType type = TILE_TYPE_WALL;
+            if (gridX >= 0 && gridX < gridWidth && gridY >= 0 && gridY < gridHeight) {
+                type = (TileType)grid[gridY * gridWidth + gridX];
+                if (type >= TILE_TYPE_COUNT) type = TILE_TYPE_EMPTY;
+            }
+
+            RoomSetTile(room, x, y, type);
+        }
+    }
+}
+
+/**
+* @brief Copy the tiles of a grid region that changed type into the room
+*
+* Only the part of the region inside both the room and the grid is
+* looked at.
+*
+* @param room Pointer to room
+* @param grid Row-major grid of TileType values
+* @param gridWidth Width of grid in tiles
+* @param gridHeight Height of grid in tiles
+* @param x Left edge of region in grid tiles
+* @param y Top edge of region in grid tiles
+* @param width Width of region in tiles
+* @param height Height of region in tiles
+*/
+void RoomRefreshTilesFromGrid(Room* room, const unsigned char* grid, int gridWidth, int gridHeight, int x, int y, int width, int height) {
+    if (!room || !grid) return;
+
+    // Clip the region to the room and the grid
+    int startX = x > room->x ? x : room->x;
+    int startY = y > room->y ? y : room->y;
+    int endX = x + width < room->x + room->width ? x + width : room->x + room->width;
+    int endY = y + height < room->y + room->height ? y + height : room->y + room->height;
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX > gridWidth) endX = gridWidth;
+    if (endY > gridHeight) endY = gridHeight;
+
+    for (int gridY = startY; gridY < endY; gridY++) {
+        for (int gridX = startX; gridX < endX; gridX++) {
+            TileType type = (TileType)grid[gridY * gridWidth + gridX];
+            if (type >= TILE_TYPE_COUNT) type = TILE_TYPE_EMPTY;
+
+            Tile* tile = &room->tiles[gridX - room->x][gridY - room->y];
+            if (tile->type != type) {
+                RoomSetTile(room, gridX - room->x, gridY - room->y, type);
+                tile->data = 0;
+            }
+        }
+    }
+}
+
 /**
 * @brief Load room from file
 *
+* Room files use the level file format with a single room record; the
+* tile section covers just the room, in room-local coordinates.
+*
 * @param filename Path to room file
-* @return Room* Pointer to loaded room
+* @return Room* Pointer to loaded room or NULL if failed
 */
 Room* RoomLoad(const char* filename) {
     if (!filename) return NULL;
 
-    // In a real implementation, this would read room data from a file
-    // For this stub, we'll create a default room
-    TraceLog(LOG_INFO, "Would load room from file: %s", filename);
-    TraceLog(LOG_INFO, "Creating default room instead");
+    // Map the room file
+    PlatformFileMap map;
+    if (!PlatformMapFile(filename, &map)) {
+        TraceLog(LOG_ERROR, "Failed to open room file: %s", filename);
+        return NULL;
+    }
 
-    // Create a default room
-    Room* room = RoomCreate(1, ROOM_TYPE_NORMAL, 0, 0, 10, 10);
+    LevelView view;
+    if (!LevelOpenView(map.data, map.size, &view) || view.header->roomCount < 1) {
+        TraceLog(LOG_ERROR, "Invalid room file: %s", filename);
+        PlatformUnmapFile(&map);
+        return NULL;
+    }
+
+    const LevelRoomRecord* record = &view.rooms[0];
+    if (record->width != view.header->width || record->height != view.header->height) {
+        TraceLog(LOG_ERROR, "Room file %s tile section does not match room size", filename);
+        PlatformUnmapFile(&map);
+        return NULL;
+    }
+
+    RoomType type = (record->type >= 0 && record->type < ROOM_TYPE_COUNT) ?
+        (RoomType)record->type : ROOM_TYPE_NORMAL;
+
+    Room* room = RoomCreate(record->id, type, record->x, record->y, record->width, record->height);
+    if (room) {
+        RoomLoadTilesFromGrid(room, view.tiles, view.header->width, view.header->height, 0, 0);
+    }
+
+    PlatformUnmapFile(&map);
     return room;
 }
 
@@ -641,12 +751,36 @@ Room* RoomLoad(const char* filename) {
 * @return false Save failed
 */
 bool RoomSave(Room* room, const char* filename) {
-    if (!room || !filename) return false;
+    if (!room || !filename || !room->tiles) return false;
 
-    // In a real implementation, this would write room data to a file
-    // For this stub, we'll just log what would happen
-    TraceLog(LOG_INFO, "Would save room ID %d to file: %s", room->id, filename);
-    TraceLog(LOG_INFO, "Room dimensions: %d x %d", room->width, room->height);
+    // Flatten the room tiles into a row-major grid
+    unsigned char* tiles = (unsigned char*)malloc((size_t)room->width * (size_t)room->height);
+    if (!tiles) {
+        TraceLog(LOG_ERROR, "Failed to allocate tile buffer for room %d", room->id);
+        return false;
+    }
 
-    return true;
+    for (int x = 0; x < room->width; x++) {
+        for (int y = 0; y < room->height; y++) {
+            tiles[y * room->width + x] = (unsigned char)room->tiles[x][y].type;
+        }
+    }
+
+    LevelRoomRecord record = { 0 };
+    record.id = room->id;
+    record.type = room->type;
+    record.x = room->x;
+    record.y = room->y;
+    record.width = room->width;
+    record.height = room->height;
+
+    LevelFileHeader header = { 0 };
+    header.width = room->width;
+    header.height = room->height;
+    header.roomCount = 1;
+
+    bool success = LevelWriteFile(filename, &header, tiles, &record, NULL, NULL);
+    free(tiles);
+
+    return success;
 }
\ No newline at end of file
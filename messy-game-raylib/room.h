@@ -42,6 +42,18 @@ typedef enum {
     // Add more directions as needed
 } ConnectionDirection;
 
+/**
+ * @brief Room states enumeration
+ *
+ * Only the main thread changes a room's state.
+ */
+typedef enum {
+    ROOM_STATE_UNLOADED,            // Tiles not yet filled from the world grid
+    ROOM_STATE_LOADING,             // Queued for or being filled by the room streamer
+    ROOM_STATE_READY,               // Tiles are valid
+    ROOM_STATE_COUNT
+} RoomState;
+
 /**
  * @brief Room structure
  *
@@ -61,6 +73,8 @@ typedef struct Room {
     bool isCleared;                 // Whether room is cleared of enemies
     struct Room** exits;            // Array of pointers to connected rooms
     Rectangle bounds;               // Room bounds in world coordinates
+    float roomTime;                 // Time spent updating this room, for animations
+    RoomState state;                // Whether the tiles are ready to use
     // Add more room attributes as needed
 } Room;
 
@@ -96,9 +110,10 @@ void RoomUpdate(Room* room, float deltaTime);
  * @brief Render room
  *
  * @param room Pointer to room
+ * @param renderer Renderer to draw with
  * @param camera Pointer to camera
  */
-void RoomRender(Room* room, Camera2D* camera);
+void RoomRender(Room* room, struct Renderer* renderer, Camera2D* camera);
 
 /**
  * @brief Set tile at position in room
@@ -152,6 +167,18 @@ bool RoomHasConnection(Room* room, ConnectionDirection direction);
  */
 Room* RoomGetConnected(Room* room, ConnectionDirection direction);
 
+/**
+ * @brief Get where the door for a direction sits in a room
+ *
+ * @param room Pointer to room
+ * @param direction Single connection direction
+ * @param x Pointer to store the door X position in the room
+ * @param y Pointer to store the door Y position in the room
+ * @return true Position stored
+ * @return false Invalid direction
+ */
+bool RoomGetDoorPosition(Room* room, ConnectionDirection direction, int* x, int* y);
+
 /**
  * @brief Generate room layout based on type
  *
@@ -159,6 +186,35 @@ Room* RoomGetConnected(Room* room, ConnectionDirection direction);
  */
 void RoomGenerateLayout(Room* room);
 
+/**
+ * @brief Copy tile types from a row-major grid into the room
+ *
+ * @param room Pointer to room
+ * @param grid Row-major grid of TileType values
+ * @param gridWidth Width of grid in tiles
+ * @param gridHeight Height of grid in tiles
+ * @param originX Grid X of the room's top-left tile
+ * @param originY Grid Y of the room's top-left tile
+ */
+void RoomLoadTilesFromGrid(Room* room, const unsigned char* grid, int gridWidth, int gridHeight, int originX, int originY);
+
+/**
+ * @brief Copy the tiles of a grid region that changed type into the room
+ *
+ * Tiles whose type is unchanged keep their state, such as where a door
+ * leads.
+ *
+ * @param room Pointer to room
+ * @param grid Row-major grid of TileType values
+ * @param gridWidth Width of grid in tiles
+ * @param gridHeight Height of grid in tiles
+ * @param x Left edge of region in grid tiles
+ * @param y Top edge of region in grid tiles
+ * @param width Width of region in tiles
+ * @param height Height of region in tiles
+ */
+void RoomRefreshTilesFromGrid(Room* room, const unsigned char* grid, int gridWidth, int gridHeight, int x, int y, int width, int height);
+
 /**
  * @brief Load room from file
  *
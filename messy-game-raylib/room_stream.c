@@ -0,0 +1,236 @@
+/**
+ * @file room_stream.c
+ * @brief Implementation of background room loading
+ */
+
+#include <stdlib.h>
+#include "room_stream.h"
+
+/**
+ * @brief Append a room to a queue
+ *
+ * @param queue Pointer to queue
+ * @param room Room to append
+ * @return true If the room was queued
+ * @return false If the queue is full
+ */
+static bool RoomStreamQueuePush(RoomStreamQueue* queue, Room* room) {
+    if (queue->count >= ROOM_STREAM_QUEUE_CAPACITY) return false;
+
+    queue->rooms[(queue->head + queue->count) % ROOM_STREAM_QUEUE_CAPACITY] = room;
+    queue->count++;
+    return true;
+}
+
+/**
+ * @brief Remove the oldest room from a queue
+ *
+ * @param queue Pointer to queue
+ * @param room Pointer to store the room
+ * @return true If a room was removed
+ * @return false If the queue is empty
+ */
+static bool RoomStreamQueuePop(RoomStreamQueue* queue, Room** room) {
+    if (queue->count == 0) return false;
+
+    *room = queue->rooms[queue->head];
+    queue->head = (queue->head + 1) % ROOM_STREAM_QUEUE_CAPACITY;
+    queue->count--;
+    return true;
+}
+
+/**
+ * @brief Loader thread entry point
+ *
+ * Fills rooms from the world grid until told to quit, finishing any
+ * queued rooms first.
+ *
+ * @param userData Pointer to streamer
+ */
+static void RoomStreamWorkerMain(void* userData) {
+    RoomStreamer* streamer = (RoomStreamer*)userData;
+
+    PlatformMutexLock(streamer->mutex);
+    for (;;) {
+        while (streamer->requests.count == 0 && !streamer->quit) {
+            PlatformConditionWait(streamer->workAvailable, streamer->mutex);
+        }
+
+        Room* room;
+        if (!RoomStreamQueuePop(&streamer->requests, &room)) break;
+
+        // Copy the tiles without holding the lock
+        PlatformMutexUnlock(streamer->mutex);
+
+        RoomLoadTilesFromGrid(room, streamer->grid, streamer->gridWidth, streamer->gridHeight, room->x, room->y);
+
+        PlatformMutexLock(streamer->mutex);
+        RoomStreamQueuePush(&streamer->completed, room);
+        PlatformConditionSignal(streamer->workFinished);
+    }
+    PlatformMutexUnlock(streamer->mutex);
+}
+
+/**
+ * @brief Create a room streamer and start its loader thread
+ *
+ * @param grid Row-major world grid of TileType values
+ * @param gridWidth Width of grid in tiles
+ * @param gridHeight Height of grid in tiles
+ * @return RoomStreamer* Pointer to the created streamer or NULL if failed
+ */
+RoomStreamer* RoomStreamerCreate(const unsigned char* grid, int gridWidth, int gridHeight) {
+    if (!grid || gridWidth <= 0 || gridHeight <= 0) return NULL;
+
+    RoomStreamer* streamer = (RoomStreamer*)calloc(1, sizeof(RoomStreamer));
+    if (!streamer) {
+        TraceLog(LOG_ERROR, "Failed to allocate room streamer");
+        return NULL;
+    }
+
+    streamer->grid = grid;
+    streamer->gridWidth = gridWidth;
+    streamer->gridHeight = gridHeight;
+    streamer->mutex = PlatformMutexCreate();
+    streamer->workAvailable = PlatformConditionCreate();
+    streamer->workFinished = PlatformConditionCreate();
+
+    if (!streamer->mutex || !streamer->workAvailable || !streamer->workFinished) {
+        TraceLog(LOG_ERROR, "Failed to allocate room streamer locks");
+        RoomStreamerDestroy(streamer);
+        return NULL;
+    }
+
+    streamer->thread = PlatformThreadCreate(RoomStreamWorkerMain, streamer);
+    if (!streamer->thread) {
+        TraceLog(LOG_ERROR, "Failed to start room loader thread");
+        RoomStreamerDestroy(streamer);
+        return NULL;
+    }
+
+    return streamer;
+}
+
+/**
+ * @brief Finish queued rooms, stop the loader thread and free the streamer
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerDestroy(RoomStreamer* streamer) {
+    if (!streamer) return;
+
+    // Let the loader thread finish queued rooms, then stop it
+    if (streamer->thread) {
+        PlatformMutexLock(streamer->mutex);
+        streamer->quit = true;
+        PlatformConditionBroadcast(streamer->workAvailable);
+        PlatformMutexUnlock(streamer->mutex);
+
+        PlatformThreadJoin(streamer->thread);
+        RoomStreamerCollect(streamer);
+    }
+
+    PlatformConditionDestroy(streamer->workFinished);
+    PlatformConditionDestroy(streamer->workAvailable);
+    PlatformMutexDestroy(streamer->mutex);
+    free(streamer);
+}
+
+/**
+ * @brief Start loading a room in the background
+ *
+ * @param streamer Pointer to streamer
+ * @param room Room to load
+ * @return true If the room is loading or ready
+ * @return false If too many rooms are in flight
+ */
+bool RoomStreamerRequest(RoomStreamer* streamer, Room* room) {
+    if (!streamer || !room) return false;
+    if (room->state != ROOM_STATE_UNLOADED) return true;
+
+    // Rooms in flight are bounded so the completed queue can never overflow
+    if (streamer->pendingJobs >= ROOM_STREAM_QUEUE_CAPACITY) return false;
+
+    room->state = ROOM_STATE_LOADING;
+
+    PlatformMutexLock(streamer->mutex);
+    RoomStreamQueuePush(&streamer->requests, room);
+    PlatformConditionSignal(streamer->workAvailable);
+    PlatformMutexUnlock(streamer->mutex);
+
+    streamer->pendingJobs++;
+    return true;
+}
+
+/**
+ * @brief Mark rooms the loader thread has finished as ready
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerCollect(RoomStreamer* streamer) {
+    if (!streamer) return;
+
+    Room* finished[ROOM_STREAM_QUEUE_CAPACITY];
+    int finishedCount = 0;
+
+    PlatformMutexLock(streamer->mutex);
+    while (RoomStreamQueuePop(&streamer->completed, &finished[finishedCount])) {
+        finishedCount++;
+    }
+    PlatformMutexUnlock(streamer->mutex);
+
+    for (int i = 0; i < finishedCount; i++) {
+        finished[i]->state = ROOM_STATE_READY;
+        streamer->pendingJobs--;
+    }
+}
+
+/**
+ * @brief Make sure a room is ready, waiting for it if needed
+ *
+ * @param streamer Pointer to streamer
+ * @param room Room that must be ready
+ */
+void RoomStreamerWait(RoomStreamer* streamer, Room* room) {
+    if (!streamer || !room) return;
+
+    RoomStreamerCollect(streamer);
+
+    // Nobody asked for it in time: load it here
+    if (room->state == ROOM_STATE_UNLOADED) {
+        TraceLog(LOG_DEBUG, "Room %d was not prefetched, loading it now", room->id);
+        RoomLoadTilesFromGrid(room, streamer->grid, streamer->gridWidth, streamer->gridHeight, room->x, room->y);
+        room->state = ROOM_STATE_READY;
+        return;
+    }
+
+    while (room->state == ROOM_STATE_LOADING) {
+        PlatformMutexLock(streamer->mutex);
+        while (streamer->completed.count == 0) {
+            PlatformConditionWait(streamer->workFinished, streamer->mutex);
+        }
+        PlatformMutexUnlock(streamer->mutex);
+
+        RoomStreamerCollect(streamer);
+    }
+}
+
+/**
+ * @brief Wait until every queued room is ready
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerFinish(RoomStreamer* streamer) {
+    if (!streamer) return;
+
+    RoomStreamerCollect(streamer);
+    while (streamer->pendingJobs > 0) {
+        PlatformMutexLock(streamer->mutex);
+        while (streamer->completed.count == 0) {
+            PlatformConditionWait(streamer->workFinished, streamer->mutex);
+        }
+        PlatformMutexUnlock(streamer->mutex);
+
+        RoomStreamerCollect(streamer);
+    }
+}
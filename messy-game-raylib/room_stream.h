@@ -0,0 +1,104 @@
+/**
+ * @file room_stream.h
+ * @brief Background loading of room tiles
+ *
+ * This file defines the room streamer used by room-based worlds. Only the
+ * start room's tiles are filled in when a level loads; the rest are
+ * copied out of the world grid on a background thread when a room next
+ * to the current one needs them, so walking through a door finds the
+ * next room ready instead of copying its tiles on the spot.
+ */
+#ifndef MESSY_GAME_ROOM_STREAM_H
+#define MESSY_GAME_ROOM_STREAM_H
+
+#include <stdbool.h>
+#include "config.h"
+#include "room.h"
+#include "platform.h"
+
+/**
+ * @brief Fixed-capacity room ring buffer
+ */
+typedef struct {
+    Room* rooms[ROOM_STREAM_QUEUE_CAPACITY]; // Room storage
+    int head;                  // Index of oldest room
+    int count;                 // Number of queued rooms
+} RoomStreamQueue;
+
+/**
+ * @brief Room streamer structure
+ *
+ * Room states belong to the main thread. The queues are shared with the
+ * loader thread and guarded by mutex.
+ */
+typedef struct {
+    const unsigned char* grid; // Row-major world grid rooms are filled from
+    int gridWidth;             // Width of grid in tiles
+    int gridHeight;            // Height of grid in tiles
+    int pendingJobs;           // Rooms submitted but not yet collected
+    RoomStreamQueue requests;  // Rooms waiting for the loader thread
+    RoomStreamQueue completed; // Rooms filled by the loader thread
+    PlatformMutex* mutex;      // Guards both queues and quit
+    PlatformCondition* workAvailable; // Signalled when a room is queued
+    PlatformCondition* workFinished;  // Signalled when a room is filled
+    PlatformThread* thread;    // Background loader thread
+    bool quit;                 // Tells the loader thread to exit
+} RoomStreamer;
+
+/**
+ * @brief Create a room streamer and start its loader thread
+ *
+ * The grid must stay valid, and the part under a loading room unedited,
+ * until the streamer is destroyed.
+ *
+ * @param grid Row-major world grid of TileType values
+ * @param gridWidth Width of grid in tiles
+ * @param gridHeight Height of grid in tiles
+ * @return RoomStreamer* Pointer to the created streamer or NULL if failed
+ */
+RoomStreamer* RoomStreamerCreate(const unsigned char* grid, int gridWidth, int gridHeight);
+
+/**
+ * @brief Finish queued rooms, stop the loader thread and free the streamer
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerDestroy(RoomStreamer* streamer);
+
+/**
+ * @brief Start loading a room in the background
+ *
+ * Does nothing for rooms that are loading or ready.
+ *
+ * @param streamer Pointer to streamer
+ * @param room Room to load
+ * @return true If the room is loading or ready
+ * @return false If too many rooms are in flight
+ */
+bool RoomStreamerRequest(RoomStreamer* streamer, Room* room);
+
+/**
+ * @brief Mark rooms the loader thread has finished as ready
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerCollect(RoomStreamer* streamer);
+
+/**
+ * @brief Make sure a room is ready, waiting for it if needed
+ *
+ * A room nobody asked for is loaded on the calling thread.
+ *
+ * @param streamer Pointer to streamer
+ * @param room Room that must be ready
+ */
+void RoomStreamerWait(RoomStreamer* streamer, Room* room);
+
+/**
+ * @brief Wait until every queued room is ready
+ *
+ * @param streamer Pointer to streamer
+ */
+void RoomStreamerFinish(RoomStreamer* streamer);
+
+#endif // MESSY_GAME_ROOM_STREAM_H
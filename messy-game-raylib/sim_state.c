@@ -0,0 +1,637 @@
+/**
+ * @file sim_state.c
+ * @brief Implementation of contiguous simulation state snapshots
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_state.h"
+#include "room.h"
+
+// Every section starts on an 8-byte boundary, so it can be read in place
+#define SIM_STATE_ALIGN(size) (((size) + 7) & ~(size_t)7)
+
+// Compile-time layout check: the header must not depend on compiler padding
+typedef char SimStateHeaderSizeCheck[(sizeof(SimStateHeader) == 60) ? 1 : -1];
+
+/**
+ * @brief Count the snake segments of every snake
+ *
+ * @param game Pointer to game
+ * @return int Number of segments
+ */
+static int SimStateCountSegments(Game* game) {
+    int count = 0;
+    for (int i = 0; i < game->entityCount; i++) {
+        if (IsSnakeBoss(game->entities[i])) {
+            count += SnakeBossGetData(game->entities[i])->segmentCount;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Get the number of world tiles that are stored in the state
+ *
+ * Open worlds keep their tiles in streamed chunks, which save themselves.
+ *
+ * @param world Pointer to world
+ * @return int Number of tiles
+ */
+static int SimStateWorldTileCount(World* world) {
+    if (!world || !world->tiles || world->chunks) return 0;
+    return world->width * world->height;
+}
+
+/**
+ * @brief Get the size of the header and every section before the rooms
+ *
+ * @param header Header with the counts filled in
+ * @return size_t Size in bytes
+ */
+static size_t SimStateSizeFromCounts(const SimStateHeader* header) {
+    size_t size = SIM_STATE_ALIGN(sizeof(SimStateHeader));
+    size += SIM_STATE_ALIGN(sizeof(SimEntityState) * (size_t)header->entityCount);
+    size += SIM_STATE_ALIGN(sizeof(SnakeSegment) * (size_t)header->segmentCount);
+    if (header->hasWinCondition) {
+        size += SIM_STATE_ALIGN(sizeof(WinCondition));
+        size += SIM_STATE_ALIGN(sizeof(ThunderParticle) * (size_t)header->particleCount);
+    }
+    size += SIM_STATE_ALIGN((size_t)header->worldTileCount);
+    return size;
+}
+
+/**
+ * @brief Get the size of a room section
+ *
+ * @param header Header with the flags filled in
+ * @param width Room width in tiles
+ * @param height Room height in tiles
+ * @return size_t Section size in bytes
+ */
+static size_t SimStateRoomSize(const SimStateHeader* header, int width, int height) {
+    if (header->flags & SIM_STATE_NO_ROOM_TILES) return SIM_STATE_ALIGN(sizeof(SimRoomState));
+    return SIM_STATE_ALIGN(sizeof(SimRoomState)) + SIM_STATE_ALIGN(sizeof(Tile) * (size_t)width * (size_t)height);
+}
+
+/**
+ * @brief Fill in a header for the current state
+ *
+ * @param header Pointer to header to fill
+ * @param game Pointer to game
+ * @param flags Combination of SIM_STATE_ flags
+ */
+static void SimStateFillHeader(SimStateHeader* header, Game* game, uint16_t flags) {
+    memset(header, 0, sizeof(SimStateHeader));
+    memcpy(header->magic, SIM_STATE_MAGIC, 4);
+    header->version = SIM_STATE_VERSION;
+    header->entityStateSize = (uint16_t)sizeof(SimEntityState);
+    header->segmentSize = (uint16_t)sizeof(SnakeSegment);
+    header->winConditionSize = (uint16_t)sizeof(WinCondition);
+    header->particleSize = (uint16_t)sizeof(ThunderParticle);
+    header->tileSize = (uint16_t)sizeof(Tile);
+    header->flags = flags;
+    header->gameState = game->state;
+    header->prevGameState = game->prevState;
+    header->entityCount = game->entityCount;
+    header->segmentCount = SimStateCountSegments(game);
+    header->hasWinCondition = game->winCondition != NULL;
+    header->particleCount = game->winCondition && game->winCondition->particles ? game->winCondition->particleCount : 0;
+    header->worldTileCount = SimStateWorldTileCount(game->world);
+    header->roomCount = game->world && game->world->rooms ? game->world->roomCount : 0;
+    header->currentRoom = game->world ? game->world->currentRoom : 0;
+
+    size_t size = SimStateSizeFromCounts(header);
+    for (int i = 0; i < header->roomCount; i++) {
+        Room* room = game->world->rooms[i];
+        size += room ? SimStateRoomSize(header, room->width, room->height) : SimStateRoomSize(header, 0, 0);
+    }
+    header->size = (uint32_t)size;
+}
+
+/**
+ * @brief Get the size of the current state
+ *
+ * @param game Pointer to game
+ * @param flags Combination of SIM_STATE_ flags
+ * @return size_t Bytes SimStateWrite needs
+ */
+size_t SimStateMeasure(Game* game, uint16_t flags) {
+    if (!game) return 0;
+
+    SimStateHeader header;
+    SimStateFillHeader(&header, game, flags);
+    return header.size;
+}
+
+/**
+ * @brief Write the current state into a buffer
+ *
+ * @param game Pointer to game
+ * @param flags Combination of SIM_STATE_ flags
+ * @param buffer Destination buffer
+ * @param capacity Size of buffer
+ * @return size_t Bytes written, or 0 if the buffer is too small
+ */
+size_t SimStateWrite(Game* game, uint16_t flags, void* buffer, size_t capacity) {
+    if (!game || !buffer) return 0;
+
+    SimStateHeader header;
+    SimStateFillHeader(&header, game, flags);
+    if (header.size > capacity) return 0;
+
+    unsigned char* bytes = (unsigned char*)buffer;
+    memcpy(bytes, &header, sizeof(header));
+    size_t offset = SIM_STATE_ALIGN(sizeof(SimStateHeader));
+
+    // Entities, with snake segments gathered into the next section
+    SimEntityState* entities = (SimEntityState*)(bytes + offset);
+    SnakeSegment* segments = (SnakeSegment*)(bytes + offset + SIM_STATE_ALIGN(sizeof(SimEntityState) * (size_t)header.entityCount));
+    int segmentCount = 0;
+
+    for (int i = 0; i < header.entityCount; i++) {
+        Entity* entity = game->entities[i];
+        SimEntityState* saved = &entities[i];
+        memset(saved, 0, sizeof(SimEntityState));
+        if (!entity) continue;
+
+        saved->entity = *entity;
+
+        if (entity->type == ENTITY_PLAYER && entity->typeData) {
+            saved->data.player = *(PlayerData*)entity->typeData;
+            saved->hasData = true;
+        }
+        else if (entity->type == ENTITY_BALL && entity->typeData) {
+            saved->data.ball = *(BallData*)entity->typeData;
+            saved->hasData = true;
+        }
+        else if (IsSnakeBoss(entity)) {
+            SnakeBossData* bossData = SnakeBossGetData(entity);
+            saved->data.snake = *bossData;
+            saved->hasData = true;
+            saved->firstSegment = segmentCount;
+            memcpy(&segments[segmentCount], bossData->segments, sizeof(SnakeSegment) * bossData->segmentCount);
+            segmentCount += bossData->segmentCount;
+        }
+    }
+    offset += SIM_STATE_ALIGN(sizeof(SimEntityState) * (size_t)header.entityCount);
+    offset += SIM_STATE_ALIGN(sizeof(SnakeSegment) * (size_t)header.segmentCount);
+
+    // Win condition and its particles
+    if (header.hasWinCondition) {
+        memcpy(bytes + offset, game->winCondition, sizeof(WinCondition));
+        offset += SIM_STATE_ALIGN(sizeof(WinCondition));
+
+        memcpy(bytes + offset, game->winCondition->particles, sizeof(ThunderParticle) * (size_t)header.particleCount);
+        offset += SIM_STATE_ALIGN(sizeof(ThunderParticle) * (size_t)header.particleCount);
+    }
+
+    // World tiles
+    if (header.worldTileCount > 0) {
+        memcpy(bytes + offset, game->world->tiles, (size_t)header.worldTileCount);
+    }
+    offset += SIM_STATE_ALIGN((size_t)header.worldTileCount);
+
+    // Rooms, with their tiles column by column as they are stored once
+    // background loads are done and tile edits have reached them. Without
+    // room tiles the rooms never have to be waited for.
+    bool roomTiles = !(header.flags & SIM_STATE_NO_ROOM_TILES);
+    if (roomTiles) {
+        WorldFinishRoomLoads(game->world);
+        WorldFlushTileEdits(game->world);
+    }
+    for (int i = 0; i < header.roomCount; i++) {
+        Room* room = game->world->rooms[i];
+        SimRoomState roomState = { 0 };
+        if (room) {
+            roomState.width = room->width;
+            roomState.height = room->height;
+            roomState.connections = room->connections;
+            roomState.isDiscovered = room->isDiscovered;
+            roomState.isCleared = room->isCleared;
+            roomState.isLoaded = room->state == ROOM_STATE_READY;
+        }
+
+        memcpy(bytes + offset, &roomState, sizeof(roomState));
+        offset += SIM_STATE_ALIGN(sizeof(SimRoomState));
+        if (!roomTiles) continue;
+
+        unsigned char* tiles = bytes + offset;
+        for (int x = 0; x < roomState.width; x++) {
+            memcpy(tiles + sizeof(Tile) * (size_t)x * roomState.height, room->tiles[x], sizeof(Tile) * roomState.height);
+        }
+        offset += SIM_STATE_ALIGN(sizeof(Tile) * (size_t)roomState.width * roomState.height);
+    }
+
+    return offset;
+}
+
+/**
+ * @brief Restore a saved snake
+ *
+ * @param entity Live snake entity
+ * @param saved Saved snake
+ * @param segments Saved segments of all snakes
+ */
+static void SimStateRestoreSnake(Entity* entity, const SimEntityState* saved, const SnakeSegment* segments) {
+    SnakeBossData* bossData = SnakeBossGetData(entity);
+    int count = saved->data.snake.segmentCount;
+
+    if (count > bossData->segmentCapacity) {
+        SnakeSegment* newSegments = (SnakeSegment*)realloc(bossData->segments, sizeof(SnakeSegment) * count);
+        if (!newSegments) {
+            TraceLog(LOG_ERROR, "Failed to expand snake segments array");
+            return;
+        }
+
+        bossData->segments = newSegments;
+        bossData->segmentCapacity = count;
+    }
+
+    SnakeSegment* liveSegments = bossData->segments;
+    int capacity = bossData->segmentCapacity;
+
+    *bossData = saved->data.snake;
+    bossData->segments = liveSegments;
+    bossData->segmentCapacity = capacity;
+    memcpy(liveSegments, &segments[saved->firstSegment], sizeof(SnakeSegment) * count);
+}
+
+/**
+ * @brief Check that a buffer holds a complete state of this build
+ *
+ * @param bytes State bytes
+ * @param size Number of bytes
+ * @return const SimStateHeader* The header, or NULL if invalid
+ */
+static const SimStateHeader* SimStateValidate(const unsigned char* bytes, size_t size) {
+    if (size < sizeof(SimStateHeader)) return NULL;
+
+    const SimStateHeader* header = (const SimStateHeader*)bytes;
+    bool valid = memcmp(header->magic, SIM_STATE_MAGIC, 4) == 0 &&
+        header->version == SIM_STATE_VERSION &&
+        header->size <= size &&
+        header->entityStateSize == sizeof(SimEntityState) &&
+        header->segmentSize == sizeof(SnakeSegment) &&
+        header->winConditionSize == sizeof(WinCondition) &&
+        header->particleSize == sizeof(ThunderParticle) &&
+        header->tileSize == sizeof(Tile) &&
+        (header->flags & ~SIM_STATE_NO_ROOM_TILES) == 0 &&
+        header->entityCount >= 0 && header->segmentCount >= 0 && header->particleCount >= 0 &&
+        header->worldTileCount >= 0 && header->roomCount >= 0;
+    if (!valid) return NULL;
+
+    // Walk the room sections to check the total size
+    size_t offset = SimStateSizeFromCounts(header);
+    for (int i = 0; i < header->roomCount; i++) {
+        if (offset + sizeof(SimRoomState) > header->size) return NULL;
+
+        const SimRoomState* roomState = (const SimRoomState*)(bytes + offset);
+        if (roomState->width < 0 || roomState->height < 0) return NULL;
+        offset += SimStateRoomSize(header, roomState->width, roomState->height);
+    }
+
+    return offset == header->size ? header : NULL;
+}
+
+/**
+ * @brief Restore a state written by SimStateWrite
+ *
+ * @param game Pointer to game
+ * @param buffer State bytes
+ * @param size Number of bytes
+ * @return true If the state was restored
+ * @return false If the bytes are not a state of this build
+ */
+bool SimStateRead(Game* game, const void* buffer, size_t size) {
+    if (!game || !buffer) return false;
+
+    const unsigned char* bytes = (const unsigned char*)buffer;
+    const SimStateHeader* header = SimStateValidate(bytes, size);
+    if (!header) {
+        TraceLog(LOG_WARNING, "Ignoring invalid simulation state");
+        return false;
+    }
+
+    game->state = (GameState)header->gameState;
+    game->prevState = (GameState)header->prevGameState;
+
+    size_t offset = SIM_STATE_ALIGN(sizeof(SimStateHeader));
+    const SimEntityState* entities = (const SimEntityState*)(bytes + offset);
+    offset += SIM_STATE_ALIGN(sizeof(SimEntityState) * (size_t)header->entityCount);
+    const SnakeSegment* segments = (const SnakeSegment*)(bytes + offset);
+    offset += SIM_STATE_ALIGN(sizeof(SnakeSegment) * (size_t)header->segmentCount);
+
+    for (int i = 0; i < game->entityCount; i++) {
+        Entity* entity = game->entities[i];
+        if (!entity) continue;
+
+        if (i >= header->entityCount) {
+            entity->active = false;
+            continue;
+        }
+
+        const SimEntityState* saved = &entities[i];
+        if (saved->entity.type != entity->type) continue;
+
+        void* typeData = entity->typeData;
+        *entity = saved->entity;
+        entity->typeData = typeData;
+
+        if (!saved->hasData || !typeData) continue;
+
+        if (entity->type == ENTITY_PLAYER) {
+            PlayerData* playerData = (PlayerData*)typeData;
+            InputManager* input = playerData->input;
+            *playerData = saved->data.player;
+            playerData->input = input;
+        }
+        else if (entity->type == ENTITY_BALL) {
+            *(BallData*)typeData = saved->data.ball;
+        }
+        else if (IsSnakeBoss(entity) &&
+            saved->firstSegment + saved->data.snake.segmentCount <= header->segmentCount) {
+            SimStateRestoreSnake(entity, saved, segments);
+        }
+    }
+
+    // Win condition; particles only when the live array has the same size
+    if (header->hasWinCondition) {
+        const WinCondition* saved = (const WinCondition*)(bytes + offset);
+        offset += SIM_STATE_ALIGN(sizeof(WinCondition));
+
+        if (game->winCondition) {
+            ThunderParticle* particles = game->winCondition->particles;
+            int particleCount = game->winCondition->particleCount;
+
+            *game->winCondition = *saved;
+            game->winCondition->particles = particles;
+            game->winCondition->particleCount = particleCount;
+
+            if (particles && particleCount == header->particleCount) {
+                memcpy(particles, bytes + offset, sizeof(ThunderParticle) * (size_t)particleCount);
+            }
+        }
+        offset += SIM_STATE_ALIGN(sizeof(ThunderParticle) * (size_t)header->particleCount);
+    }
+
+    // World tiles. With room tiles in the state, the grid is copied once
+    // background room loads stop reading it, and edits not yet flushed are
+    // replaced along with everything else. Without them, the tiles that
+    // differ are put back as edits and the rooms refreshed from them below.
+    bool roomTiles = !(header->flags & SIM_STATE_NO_ROOM_TILES);
+    bool worldTiles = header->worldTileCount > 0 && header->worldTileCount == SimStateWorldTileCount(game->world);
+    if (roomTiles) {
+        WorldFinishRoomLoads(game->world);
+        if (game->world) {
+            game->world->dirtyRegionCount = 0;
+        }
+        if (worldTiles) {
+            memcpy(game->world->tiles, bytes + offset, (size_t)header->worldTileCount);
+        }
+    }
+    else if (worldTiles) {
+        WorldRestoreTiles(game->world, bytes + offset);
+    }
+    offset += SIM_STATE_ALIGN((size_t)header->worldTileCount);
+
+    // Rooms
+    World* world = game->world;
+    for (int i = 0; i < header->roomCount; i++) {
+        const SimRoomState* roomState = (const SimRoomState*)(bytes + offset);
+        const unsigned char* tiles = bytes + offset + SIM_STATE_ALIGN(sizeof(SimRoomState));
+        offset += SimStateRoomSize(header, roomState->width, roomState->height);
+
+        Room* room = world && world->rooms && i < world->roomCount ? world->rooms[i] : NULL;
+        if (!room || room->width != roomState->width || room->height != roomState->height) continue;
+
+        room->connections = roomState->connections;
+        room->isDiscovered = roomState->isDiscovered != 0;
+        room->isCleared = roomState->isCleared != 0;
+        if (!roomTiles || !roomState->isLoaded) continue;
+
+        for (int x = 0; x < room->width; x++) {
+            memcpy(room->tiles[x], tiles + sizeof(Tile) * (size_t)x * room->height, sizeof(Tile) * room->height);
+        }
+        room->state = ROOM_STATE_READY;
+    }
+
+    // Rooms kept their tiles; bring them up to date with the world tiles
+    if (!roomTiles) {
+        WorldFlushTileEdits(world);
+    }
+
+    // The current room was loaded when saved, so it is ready again now
+    if (world && header->currentRoom >= 0 && header->currentRoom < world->roomCount) {
+        world->currentRoom = header->currentRoom;
+        WorldPrefetchRooms(world, world->currentRoom);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Create a state ring
+ *
+ * @param capacity Number of slots
+ * @param slotSize Initial slot size in bytes (slots grow when a state does not fit)
+ * @return SimStateRing* Pointer to created ring or NULL if failed
+ */
+SimStateRing* SimStateRingCreate(int capacity, size_t slotSize) {
+    if (capacity < 1) return NULL;
+
+    SimStateRing* ring = (SimStateRing*)calloc(1, sizeof(SimStateRing));
+    if (!ring) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for state ring");
+        return NULL;
+    }
+
+    ring->capacity = capacity;
+    ring->slotSize = SIM_STATE_ALIGN(slotSize);
+    ring->ids = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+    ring->slots = ring->slotSize > 0 ? (unsigned char*)malloc(ring->slotSize * capacity) : NULL;
+
+    if (!ring->ids || (ring->slotSize > 0 && !ring->slots)) {
+        TraceLog(LOG_ERROR, "Failed to allocate state ring slots");
+        SimStateRingDestroy(ring);
+        return NULL;
+    }
+
+    return ring;
+}
+
+/**
+ * @brief Destroy a state ring
+ *
+ * @param ring Pointer to ring
+ */
+void SimStateRingDestroy(SimStateRing* ring) {
+    if (!ring) return;
+
+    free(ring->slots);
+    free(ring->ids);
+    free(ring);
+}
+
+/**
+ * @brief Make every slot at least a given size
+ *
+ * Stored states are moved into the larger slots.
+ *
+ * @param ring Pointer to ring
+ * @param size Required slot size in bytes
+ * @return bool Whether the slots are large enough
+ */
+static bool SimStateRingReserve(SimStateRing* ring, size_t size) {
+    if (size <= ring->slotSize) return true;
+
+    // Grow with headroom so a slowly growing snake does not regrow every step
+    size_t newSlotSize = SIM_STATE_ALIGN(size + size / 2);
+    unsigned char* newSlots = (unsigned char*)malloc(newSlotSize * ring->capacity);
+    if (!newSlots) {
+        TraceLog(LOG_ERROR, "Failed to expand state ring slots");
+        return false;
+    }
+
+    for (int i = 0; i < ring->capacity; i++) {
+        if (ring->ids[i] != 0) {
+            memcpy(newSlots + newSlotSize * i, ring->slots + ring->slotSize * i, ring->slotSize);
+        }
+    }
+
+    free(ring->slots);
+    ring->slots = newSlots;
+    ring->slotSize = newSlotSize;
+    return true;
+}
+
+/**
+ * @brief Save the current state under an id
+ *
+ * @param ring Pointer to ring
+ * @param id Id to save under (non-zero)
+ * @param game Pointer to game
+ * @return bool Whether the state was saved
+ */
+bool SimStateRingSave(SimStateRing* ring, uint32_t id, Game* game) {
+    if (!ring || id == 0 || !game) return false;
+
+    int index = (int)(id % (uint32_t)ring->capacity);
+    ring->ids[index] = 0;
+
+    if (!SimStateRingReserve(ring, SimStateMeasure(game, SIM_STATE_NO_ROOM_TILES))) return false;
+    if (SimStateWrite(game, SIM_STATE_NO_ROOM_TILES, ring->slots + ring->slotSize * index, ring->slotSize) == 0) return false;
+
+    ring->ids[index] = id;
+    return true;
+}
+
+/**
+ * @brief Restore the state saved under an id
+ *
+ * @param ring Pointer to ring
+ * @param id Id to restore
+ * @param game Pointer to game
+ * @return bool Whether the id was still in the ring and was restored
+ */
+bool SimStateRingRestore(SimStateRing* ring, uint32_t id, Game* game) {
+    if (!SimStateRingHas(ring, id) || !game) return false;
+
+    int index = (int)(id % (uint32_t)ring->capacity);
+    return SimStateRead(game, ring->slots + ring->slotSize * index, ring->slotSize);
+}
+
+/**
+ * @brief Check whether a state is still in the ring
+ *
+ * @param ring Pointer to ring
+ * @param id Id to look for
+ * @return bool Whether the id's slot still holds it
+ */
+bool SimStateRingHas(SimStateRing* ring, uint32_t id) {
+    if (!ring || id == 0) return false;
+    return ring->ids[id % (uint32_t)ring->capacity] == id;
+}
+
+/**
+ * @brief Save the current state to a file
+ *
+ * The file is written under a temporary name and renamed into place, so
+ * a crash never leaves a half-written save.
+ *
+ * @param game Pointer to game
+ * @param path Path to save file
+ * @return bool Whether the file was written
+ */
+bool SimStateSaveFile(Game* game, const char* path) {
+    if (!game || !path) return false;
+
+    double startTime = GetTime();
+
+    size_t size = SimStateMeasure(game, 0);
+    unsigned char* buffer = (unsigned char*)malloc(size);
+    if (!buffer) {
+        TraceLog(LOG_ERROR, "Failed to allocate memory for save file");
+        return false;
+    }
+
+    size_t written = SimStateWrite(game, 0, buffer, size);
+    double packTime = GetTime();
+
+    char tempPath[512];
+    sprintf_s(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+    FILE* file = fopen(tempPath, "wb");
+    if (!file) {
+        TraceLog(LOG_WARNING, "Failed to open save file for writing: %s", tempPath);
+        free(buffer);
+        return false;
+    }
+
+    bool success = written == size && fwrite(buffer, 1, size, file) == size;
+    success &= fclose(file) == 0;
+    free(buffer);
+
+    // Replace any existing save
+    remove(path);
+    if (!success || rename(tempPath, path) != 0) {
+        TraceLog(LOG_WARNING, "Failed to write save file: %s", path);
+        remove(tempPath);
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "Saved %s (%u bytes): packed in %.0f us, written in %.0f us",
+        path, (unsigned int)size, (packTime - startTime) * 1e6, (GetTime() - packTime) * 1e6);
+    return true;
+}
+
+/**
+ * @brief Restore the state saved in a file
+ *
+ * @param game Pointer to game
+ * @param path Path to save file
+ * @return bool Whether the state was restored
+ */
+bool SimStateLoadFile(Game* game, const char* path) {
+    if (!game || !path) return false;
+
+    double startTime = GetTime();
+
+    int size = 0;
+    unsigned char* data = LoadFileData(path, &size);
+    if (!data) {
+        TraceLog(LOG_WARNING, "Failed to read save file: %s", path);
+        return false;
+    }
+
+    double readTime = GetTime();
+    bool success = SimStateRead(game, data, (size_t)size);
+    UnloadFileData(data);
+
+    if (success) {
+        TraceLog(LOG_INFO, "Loaded %s (%d bytes): read in %.0f us, unpacked in %.0f us",
+            path, size, (readTime - startTime) * 1e6, (GetTime() - readTime) * 1e6);
+    }
+    return success;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file sim_state.h
+ * @brief Contiguous snapshots of the simulation state
+ *
+ * This file defines the serializer that packs everything the simulation
+ * reads and writes into one buffer: entities with their player, ball and
+ * snake data, snake segments, the win condition and its particles, the
+ * world tiles and the room tiles. A state is a header followed by plain
+ * arrays copied with memcpy, so writing and reading one takes
+ * microseconds and restoring allocates only when a snake has grown past
+ * its capacity. The same buffer is kept in rings for rollback and
+ * written to disk for save games; rollback states leave out the room
+ * tiles, which are rebuilt from the world tiles on restore.
+ */
+#ifndef MESSY_GAME_SIM_STATE_H
+#define MESSY_GAME_SIM_STATE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "game.h"
+#include "player.h"
+#include "ball.h"
+#include "snake_boss.h"
+#include "win_condition.h"
+
+// State identification
+#define SIM_STATE_MAGIC "MGSS"         // First four bytes of every state
+#define SIM_STATE_VERSION 5            // Bump when the layout changes
+
+// State flags
+#define SIM_STATE_NO_ROOM_TILES 0x0001 // Room sections hold no tiles (rooms follow the world tiles on restore)
+
+/**
+ * @brief State header, followed by the sections it counts
+ *
+ * Sections are stored in this order, each starting on an 8-byte
+ * boundary: entities, snake segments, win condition, win particles,
+ * world tiles, then per room a SimRoomState and its tiles (unless
+ * SIM_STATE_NO_ROOM_TILES is set). The struct
+ * sizes identify the build's layout, since the sections are stored in
+ * native layout.
+ */
+typedef struct {
+    char magic[4];             // SIM_STATE_MAGIC
+    uint32_t version;          // SIM_STATE_VERSION
+    uint32_t size;             // Total size of the state in bytes
+    uint16_t entityStateSize;  // sizeof(SimEntityState)
+    uint16_t segmentSize;      // sizeof(SnakeSegment)
+    uint16_t winConditionSize; // sizeof(WinCondition)
+    uint16_t particleSize;     // sizeof(ThunderParticle)
+    uint16_t tileSize;         // sizeof(Tile)
+    uint16_t flags;            // Combination of SIM_STATE_ flags
+    int32_t gameState;         // GameState
+    int32_t prevGameState;     // Previous GameState
+    int32_t entityCount;       // Number of entities
+    int32_t segmentCount;      // Number of snake segments (all snakes)
+    int32_t hasWinCondition;   // Whether the win condition section is present
+    int32_t particleCount;     // Number of win condition particles
+    int32_t worldTileCount;    // Number of world tiles (0 for open worlds)
+    int32_t roomCount;         // Number of rooms
+    int32_t currentRoom;       // Index of the current room
+} SimStateHeader;
+
+/**
+ * @brief Saved entity
+ *
+ * Pointers inside the copies (typeData, input, segments) are never
+ * restored; the live entity keeps its own.
+ */
+typedef struct {
+    Entity entity;             // Entity fields
+    union {
+        PlayerData player;     // Player data (if ENTITY_PLAYER)
+        BallData ball;         // Ball data (if ENTITY_BALL)
+        SnakeBossData snake;   // Snake data (if a snake boss)
+    } data;
+    bool hasData;              // Whether data holds a copy
+    int firstSegment;          // Index of the snake's first segment in the segment section
+} SimEntityState;
+
+/**
+ * @brief Saved room, followed by its width * height tiles unless the
+ * state has SIM_STATE_NO_ROOM_TILES
+ */
+typedef struct {
+    int32_t width;             // Width of room in tiles
+    int32_t height;            // Height of room in tiles
+    uint32_t connections;      // Bitfield of ConnectionDirection
+    uint8_t isDiscovered;      // Whether player has discovered this room
+    uint8_t isCleared;         // Whether room is cleared of enemies
+    uint8_t isLoaded;          // Whether the tiles were loaded (unloaded tiles are not restored)
+    uint8_t reserved;          // Must be zero
+} SimRoomState;
+
+/**
+ * @brief Ring of fixed-size state slots, indexed by id
+ */
+typedef struct {
+    unsigned char* slots;      // capacity slots of slotSize bytes
+    uint32_t* ids;             // Id stored in each slot (0 = empty)
+    size_t slotSize;           // Size of one slot in bytes
+    int capacity;              // Number of slots
+} SimStateRing;
+
+/**
+ * @brief Get the size of the current state
+ *
+ * @param game Pointer to game
+ * @param flags Combination of SIM_STATE_ flags
+ * @return size_t Bytes SimStateWrite needs
+ */
+size_t SimStateMeasure(Game* game, uint16_t flags);
+
+/**
+ * @brief Write the current state into a buffer
+ *
+ * A full state waits for background room loads and flushes tile edits
+ * so the room tiles it copies are current. With SIM_STATE_NO_ROOM_TILES
+ * neither happens, which keeps per-step rollback saves cheap.
+ *
+ * @param game Pointer to game
+ * @param flags Combination of SIM_STATE_ flags
+ * @param buffer Destination buffer
+ * @param capacity Size of buffer
+ * @return size_t Bytes written, or 0 if the buffer is too small
+ */
+size_t SimStateWrite(Game* game, uint16_t flags, void* buffer, size_t capacity);
+
+/**
+ * @brief Restore a state written by SimStateWrite
+ *
+ * Entities are matched by slot. Entities added since the write are
+ * deactivated; entities removed since cannot be brought back. Tiles are
+ * restored only where the world and room sizes still match. A state
+ * without room tiles puts back the world tiles as tile edits, so only
+ * the tiles that differ are refreshed in the rooms.
+ *
+ * @param game Pointer to game
+ * @param buffer State bytes
+ * @param size Number of bytes
+ * @return true If the state was restored
+ * @return false If the bytes are not a state of this build
+ */
+bool SimStateRead(Game* game, const void* buffer, size_t size);
+
+/**
+ * @brief Create a state ring
+ *
+ * @param capacity Number of slots
+ * @param slotSize Initial slot size in bytes (slots grow when a state does not fit)
+ * @return SimStateRing* Pointer to created ring or NULL if failed
+ */
+SimStateRing* SimStateRingCreate(int capacity, size_t slotSize);
+
+/**
+ * @brief Destroy a state ring
+ *
+ * @param ring Pointer to ring
+ */
+void SimStateRingDestroy(SimStateRing* ring);
+
+/**
+ * @brief Save the current state under an id
+ *
+ * Overwrites whatever id shared its slot. Ring states are written with
+ * SIM_STATE_NO_ROOM_TILES.
+ *
+ * @param ring Pointer to ring
+ * @param id Id to save under (non-zero)
+ * @param game Pointer to game
+ * @return bool Whether the state was saved
+ */
+bool SimStateRingSave(SimStateRing* ring, uint32_t id, Game* game);
+
+/**
+ * @brief Restore the state saved under an id
+ *
+ * @param ring Pointer to ring
+ * @param id Id to restore
+ * @param game Pointer to game
+ * @return bool Whether the id was still in the ring and was restored
+ */
+bool SimStateRingRestore(SimStateRing* ring, uint32_t id, Game* game);
+
+/**
+ * @brief Check whether a state is still in the ring
+ *
+ * @param ring Pointer to ring
+ * @param id Id to look for
+ * @return bool Whether the id's slot still holds it
+ */
+bool SimStateRingHas(SimStateRing* ring, uint32_t id);
+
+/**
+ * @brief Save the current state to a file
+ *
+ * @param game Pointer to game
+ * @param path Path to save file
+ * @return bool Whether the file was written
+ */
+bool SimStateSaveFile(Game* game, const char* path);
+
+/**
+ * @brief Restore the state saved in a file
+ *
+ * @param game Pointer to game
+ * @param path Path to save file
+ * @return bool Whether the state was restored
+ */
+bool SimStateLoadFile(Game* game, const char* path);
+
+#endif // MESSY_GAME_SIM_STATE_H
@@ -7,14 +7,15 @@
 #include "snake_boss.h"
 #include "config.h"
 #include "player.h"
+#include "fixed.h"
 
 // Constants specific to the snake boss
 #define SNAKE_INITIAL_MOVE_INTERVAL 0.2f // Initial time between moves in seconds
 #define SNAKE_MIN_MOVE_INTERVAL 0.05f // Minimum time between moves (fastest speed)
-#define SNAKE_INTERVAL_DECREASE 0.05f // How much to decrease interval per segment
 #define SNAKE_GROW_TIME 2.0f // Time for growth animation
 #define SNAKE_SHRINK_TIME 2.0f // Time for shrink animation
 #define SNAKE_HEAD_RADIUS 15.0f // Radius of the snake head (increased for 25x25 tiles)
+#define SNAKE_KNOCKBACK_SPEED 3.0f // Speed a touched player is knocked away at (pixels per step)
 
 // Snake appearance configuration
 #define SNAKE_SEGMENT_WIDTH_TILES 1.2f // Width of snake segment in tiles (default: 2)
@@ -143,6 +144,8 @@ Entity* SnakeBossCreate(int gridX, int gridY, int initialLength) {
     bossData->moveInterval = SNAKE_INITIAL_MOVE_INTERVAL;
     bossData->growTimer = 0.0f;
     bossData->shrinkTimer = 0.0f;
+    bossData->movesSinceRepath = 0;
+    bossData->intervalStep = SNAKE_INTERVAL_DECREASE;
     bossData->hasTarget = false;
     bossData->targetGridX = gridX;
     bossData->targetGridY = gridY;
@@ -185,17 +188,56 @@ Entity* SnakeBossCreate(int gridX, int gridY, int initialLength) {
     return snakeBoss;
 }
 
+/**
+* @brief Handle snake boss collisions with every ball near it
+*
+* Only the balls in the grid cells around the snake are tested.
+*
+* @param snakeBoss Pointer to snake boss entity
+* @param balls Pointer to ball pool (grid built for this step)
+* @param players Players, indexed by BallData kickerIndex (for XP awards)
+* @param playerCount Number of players
+*/
+static void SnakeBossHandleBallCollisions(Entity* snakeBoss, BallPool* balls, Entity** players, int playerCount) {
+    SnakeBossData* bossData = SnakeBossGetData(snakeBoss);
+
+    // Bounds of the whole snake, padded by the larger of its part sizes
+    float reach = SNAKE_HEAD_RADIUS;
+    if (SNAKE_SEGMENT_WIDTH / 2.0f > reach) reach = SNAKE_SEGMENT_WIDTH / 2.0f;
+    if (SNAKE_SEGMENT_HEIGHT / 2.0f > reach) reach = SNAKE_SEGMENT_HEIGHT / 2.0f;
+
+    float minX = bossData->segments[0].worldX;
+    float minY = bossData->segments[0].worldY;
+    float maxX = minX;
+    float maxY = minY;
+    for (int i = 1; i < bossData->segmentCount; i++) {
+        if (bossData->segments[i].worldX < minX) minX = bossData->segments[i].worldX;
+        if (bossData->segments[i].worldY < minY) minY = bossData->segments[i].worldY;
+        if (bossData->segments[i].worldX > maxX) maxX = bossData->segments[i].worldX;
+        if (bossData->segments[i].worldY > maxY) maxY = bossData->segments[i].worldY;
+    }
+
+    Entity* nearby[BALL_POOL_CAPACITY];
+    int count = BallPoolQuery(balls, minX - reach, minY - reach, maxX + reach, maxY + reach, nearby, BALL_POOL_CAPACITY);
+    for (int i = 0; i < count; i++) {
+        SnakeBossHandleBallCollision(snakeBoss, nearby[i], players, playerCount);
+    }
+}
+
 /**
 * @brief Update snake boss state
 *
+* The snake chases whichever ball is nearest its head.
+*
 * @param snakeBoss Pointer to snake boss entity
 * @param world Pointer to game world
-* @param ball Pointer to ball entity
-* @param player Pointer to player entity
+* @param balls Pointer to ball pool
+* @param players Players the snake can hit
+* @param playerCount Number of players
 * @param deltaTime Time elapsed since last update
 */
-void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* player, float deltaTime) {
-    if (!snakeBoss || !world || !ball || snakeBoss->type != ENTITY_ENEMY) return;
+void SnakeBossUpdate(Entity* snakeBoss, World* world, BallPool* balls, Entity** players, int playerCount, float deltaTime) {
+    if (!snakeBoss || !world || !balls || snakeBoss->type != ENTITY_ENEMY) return;
 
     SnakeBossData* bossData = SnakeBossGetData(snakeBoss);
     if (!bossData) return;
@@ -203,6 +245,10 @@ void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* play
     // Only proceed if snake has segments
     if (bossData->segmentCount <= 0) return;
 
+    // Chase the nearest ball
+    Entity* ball = BallPoolFindNearest(balls, bossData->segments[0].worldX, bossData->segments[0].worldY);
+    if (!ball) return;
+
     // Debug info
     if (bossData->state != SNAKE_STATE_DEFEATED) {
         TraceLog(LOG_DEBUG, "Snake Boss - gridX: %d, gridY: %d, State: %d, Target: %d,%d, HasTarget: %d",
@@ -265,7 +311,6 @@ void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* play
 
         // Move when timer exceeds interval
         if (bossData->moveTimer >= bossData->moveInterval) {
-            static int moveCount = 0;
             int headGridX, headGridY;
             int newBallGridX, newBallGridY;
             bool moved;
@@ -294,9 +339,9 @@ void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* play
             }
 
             // Recalculate path every few moves to better track the ball
-            moveCount++;
-            if (moveCount >= 3) {  // Recalculate every 3 moves
-                moveCount = 0;
+            bossData->movesSinceRepath++;
+            if (bossData->movesSinceRepath >= 3) {  // Recalculate every 3 moves
+                bossData->movesSinceRepath = 0;
 
                 // Get fresh ball position
                 newBallGridX = (int)(ball->x / TILE_WIDTH);
@@ -349,8 +394,12 @@ void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* play
     }
 
     // Check for collisions
-    SnakeBossHandleBallCollision(snakeBoss, ball, player);
-    SnakeBossHandlePlayerCollision(snakeBoss, player);
+    SnakeBossHandleBallCollisions(snakeBoss, balls, players, playerCount);
+    for (int i = 0; i < playerCount; i++) {
+        if (PlayerIsAlive(players[i])) {
+            SnakeBossHandlePlayerCollision(snakeBoss, players[i]);
+        }
+    }
 }
 
 /**
@@ -457,7 +506,7 @@ void SnakeBossFindPath(Entity* snakeBoss, int targetGridX, int targetGridY, Worl
     // If no valid direction found (should be rare)
     else {
         // Keep current direction
-        TraceLog(LOG_WARNING, "No valid direction found, keeping current: %d", bossData->currentDir);
+        TraceLog(LOG_DEBUG, "No valid direction found, keeping current: %d", bossData->currentDir);
     }
 }
 
@@ -620,16 +669,32 @@ bool SnakeBossIsValidPosition(Entity* snakeBoss, int gridX, int gridY, World* wo
     return true;
 }
 
+/**
+* @brief Find the player who kicked a ball
+*
+* @param ballData Ball data
+* @param players Players, indexed by kickerIndex
+* @param playerCount Number of players
+* @return Entity* The kicker, or NULL if nobody has kicked the ball
+*/
+static Entity* SnakeBossFindKicker(BallData* ballData, Entity** players, int playerCount) {
+    if (!players || ballData->kickerIndex < 0 || ballData->kickerIndex >= playerCount) return NULL;
+
+    Entity* kicker = players[ballData->kickerIndex];
+    return PlayerGetData(kicker) ? kicker : NULL;
+}
+
 /**
 * @brief Handle snake boss collision with the ball
 *
 * @param snakeBoss Pointer to snake boss entity
 * @param ball Pointer to ball entity
-* @param player Pointer to player entity (for XP awards)
+* @param players Players, indexed by BallData kickerIndex (for XP awards)
+* @param playerCount Number of players
 * @return true If collision occurred
 * @return false If no collision
 */
-bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* player) {
+bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity** players, int playerCount) {
     if (!snakeBoss || !ball || snakeBoss->type != ENTITY_ENEMY || ball->type != ENTITY_BALL) return false;
 
     SnakeBossData* bossData = SnakeBossGetData(snakeBoss);
@@ -641,10 +706,10 @@ bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* playe
     // Check collision with head
     float headX = bossData->segments[0].worldX;
     float headY = bossData->segments[0].worldY;
-    float distance = sqrtf((ball->x - headX) * (ball->x - headX) +
-        (ball->y - headY) * (ball->y - headY));
+    SimReal distance = SimRealLength(SimRealFromFloat(ball->x) - SimRealFromFloat(headX),
+        SimRealFromFloat(ball->y) - SimRealFromFloat(headY));
 
-    if (distance < SNAKE_HEAD_RADIUS + ballData->radius) {
+    if (distance < SimRealFromFloat(SNAKE_HEAD_RADIUS + ballData->radius)) {
         // Collision with head
         if (ballData->state == BALL_STATE_PLAYER) {
             // Blue ball (hit by player) - always damages snake
@@ -661,10 +726,11 @@ bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* playe
                 // Bounce ball
                 BallApplyForce(ball, (ball->x - headX) * 0.5f, (ball->y - headY) * 0.5f);
 
-                // Award XP to player if player reference is valid
-                if (player && player->type == ENTITY_PLAYER) {
-                    PlayerAwardXP(player, PLAYER_XP_PER_HIT);
-                    TraceLog(LOG_INFO, "Player awarded XP for hitting snake boss");
+                // Award XP to the player who kicked the ball
+                Entity* kicker = SnakeBossFindKicker(ballData, players, playerCount);
+                if (kicker) {
+                    PlayerAwardXP(kicker, PlayerGetData(kicker)->xpPerHit);
+                    TraceLog(LOG_INFO, "Player %d awarded XP for hitting snake boss", ballData->kickerIndex);
                 }
 
                 TraceLog(LOG_INFO, "BLUE ball damaged snake! Segments left: %d", bossData->segmentCount);
@@ -726,10 +792,11 @@ bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* playe
                     // Bounce ball
                     BallApplyForce(ball, (ball->x - segX) * 0.5f, (ball->y - segY) * 0.5f);
 
-                    // Award XP to player if player reference is valid
-                    if (player && player->type == ENTITY_PLAYER) {
-                        PlayerAwardXP(player, PLAYER_XP_PER_HIT);
-                        TraceLog(LOG_INFO, "Player awarded XP for hitting snake body");
+                    // Award XP to the player who kicked the ball
+                    Entity* kicker = SnakeBossFindKicker(ballData, players, playerCount);
+                    if (kicker) {
+                        PlayerAwardXP(kicker, PlayerGetData(kicker)->xpPerHit);
+                        TraceLog(LOG_INFO, "Player %d awarded XP for hitting snake body", ballData->kickerIndex);
                     }
 
                     TraceLog(LOG_INFO, "BLUE ball hit snake body! Segments left: %d", bossData->segmentCount);
@@ -743,6 +810,36 @@ bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* playe
     return false;
 }
 
+/**
+* @brief Knock a player away from a point of the snake
+*
+* Replaces the player's speed toward the point with a fixed speed away
+* from it, so repeated hits cannot build up speed.
+*
+* @param player Pointer to player entity
+* @param fromX X position of the point
+* @param fromY Y position of the point
+*/
+static void SnakeBossKnockBack(Entity* player, float fromX, float fromY) {
+    SimReal offsetX = SimRealFromFloat(player->x) - SimRealFromFloat(fromX);
+    SimReal offsetY = SimRealFromFloat(player->y) - SimRealFromFloat(fromY);
+    SimReal distance = SimRealLength(offsetX, offsetY);
+    if (distance <= 0) return;
+
+    SimReal normalX = SimRealDiv(offsetX, distance);
+    SimReal normalY = SimRealDiv(offsetY, distance);
+    SimReal speedX = SimRealFromFloat(player->speedX);
+    SimReal speedY = SimRealFromFloat(player->speedY);
+
+    // Drop the speed along the normal, then add the knockback
+    SimReal alongNormal = SimRealMul(speedX, normalX) + SimRealMul(speedY, normalY);
+    SimReal change = SimRealFromFloat(SNAKE_KNOCKBACK_SPEED) - alongNormal;
+    if (change <= 0) return;
+
+    player->speedX = SimRealToFloat(speedX + SimRealMul(normalX, change));
+    player->speedY = SimRealToFloat(speedY + SimRealMul(normalY, change));
+}
+
 /**
 * @brief Handle snake boss collision with the player
 *
@@ -763,20 +860,19 @@ bool SnakeBossHandlePlayerCollision(Entity* snakeBoss, Entity* player) {
     // Check collision with head
     float headX = bossData->segments[0].worldX;
     float headY = bossData->segments[0].worldY;
-    float distance = sqrtf((player->x - headX) * (player->x - headX) +
-        (player->y - headY) * (player->y - headY));
+    SimReal offsetX = SimRealFromFloat(player->x) - SimRealFromFloat(headX);
+    SimReal offsetY = SimRealFromFloat(player->y) - SimRealFromFloat(headY);
+    SimReal distance = SimRealLength(offsetX, offsetY);
 
     float collisionRadius = (player->width + player->height) / 4.0f;
 
-    if (distance < SNAKE_HEAD_RADIUS + collisionRadius) {
+    if (distance < SimRealFromFloat(SNAKE_HEAD_RADIUS + collisionRadius)) {
         // Damage player
         playerData->currentHealth -= 10.0f;
         if (playerData->currentHealth < 0) playerData->currentHealth = 0;
 
-        // Push player away
-        float pushForce = 5.0f;
-        player->speedX += (player->x - headX) * pushForce;
-        player->speedY += (player->y - headY) * pushForce;
+        // Knock player away (the physics solver separates them)
+        SnakeBossKnockBack(player, headX, headY);
 
         return true;
     }
@@ -808,10 +904,8 @@ bool SnakeBossHandlePlayerCollision(Entity* snakeBoss, Entity* player) {
             playerData->currentHealth -= 5.0f;
             if (playerData->currentHealth < 0) playerData->currentHealth = 0;
 
-            // Push player away
-            float pushForce = 3.0f;
-            player->speedX += (player->x - segX) * pushForce;
-            player->speedY += (player->y - segY) * pushForce;
+            // Knock player away (the physics solver separates them)
+            SnakeBossKnockBack(player, segX, segY);
 
             return true;
         }
@@ -820,6 +914,30 @@ bool SnakeBossHandlePlayerCollision(Entity* snakeBoss, Entity* player) {
     return false;
 }
 
+/**
+* @brief Add the snake boss to a physics solve
+*
+* The head is an immovable circle and each body segment an immovable box,
+* so players cannot walk through the snake.
+*
+* @param snakeBoss Pointer to snake boss entity
+* @param solver Pointer to physics solver
+*/
+void SnakeBossAddPhysicsBodies(Entity* snakeBoss, PhysicsSolver* solver) {
+    if (!snakeBoss || !solver || !IsSnakeBoss(snakeBoss)) return;
+
+    SnakeBossData* bossData = SnakeBossGetData(snakeBoss);
+    if (!bossData || bossData->segmentCount <= 0) return;
+
+    PhysicsSolverAddCircle(solver, bossData->segments[0].worldX, bossData->segments[0].worldY,
+        SNAKE_HEAD_RADIUS, PHYSICS_LAYER_ENEMY);
+
+    for (int i = 1; i < bossData->segmentCount; i++) {
+        PhysicsSolverAddBox(solver, bossData->segments[i].worldX, bossData->segments[i].worldY,
+            SNAKE_SEGMENT_WIDTH / 2.0f, SNAKE_SEGMENT_HEIGHT / 2.0f, PHYSICS_LAYER_ENEMY);
+    }
+}
+
 /**
 * @brief Make the snake boss grow by one segment
 *
@@ -872,7 +990,7 @@ void SnakeBossGrow(Entity* snakeBoss) {
 
         // Make the snake faster as it grows
         bossData->moveInterval = fmaxf(SNAKE_MIN_MOVE_INTERVAL,
-            bossData->moveInterval - SNAKE_INTERVAL_DECREASE);
+            bossData->moveInterval - bossData->intervalStep);
     }
 }
 
@@ -899,7 +1017,7 @@ bool SnakeBossShrink(Entity* snakeBoss) {
 
     // Make the snake slower as it shrinks
     bossData->moveInterval = fminf(SNAKE_INITIAL_MOVE_INTERVAL,
-        bossData->moveInterval + SNAKE_INTERVAL_DECREASE);
+        bossData->moveInterval + bossData->intervalStep);
 
     return true;
 }
@@ -11,6 +11,9 @@
 #include "entity.h"
 #include "world.h"
 #include "ball.h"
+#include "physics.h"
+
+#define SNAKE_INTERVAL_DECREASE 0.05f // How much to decrease interval per segment
 
 /**
 * @brief Snake boss state enumeration
@@ -59,6 +62,8 @@ typedef struct {
     float moveInterval;      // Time between moves (decreases as snake grows)
     float growTimer;         // Timer for growth animation
     float shrinkTimer;       // Timer for shrink animation
+    int movesSinceRepath;    // Moves since the path to the ball was recalculated
+    float intervalStep;      // Move interval change per segment gained or lost
 
     Color headColor;         // Color of the snake head
     Color bodyColor;         // Color of the body segments
@@ -77,13 +82,17 @@ Entity* SnakeBossCreate(int gridX, int gridY, int initialLength);
 /**
 * @brief Update snake boss state
 *
+* The snake chases whichever ball is nearest its head, and collides with
+* every ball the pool's grid finds near it.
+*
 * @param snakeBoss Pointer to snake boss entity
 * @param world Pointer to game world
-* @param ball Pointer to ball entity
-* @param player Pointer to player entity
+* @param balls Pointer to ball pool (grid built for this step)
+* @param players Players the snake can hit
+* @param playerCount Number of players
 * @param deltaTime Time elapsed since last update
 */
-void SnakeBossUpdate(Entity* snakeBoss, World* world, Entity* ball, Entity* player, float deltaTime);
+void SnakeBossUpdate(Entity* snakeBoss, World* world, BallPool* balls, Entity** players, int playerCount, float deltaTime);
 
 /**
 * @brief Render snake boss
@@ -95,17 +104,23 @@ void SnakeBossRender(Entity* snakeBoss);
 /**
 * @brief Handle snake boss collision with the ball
 *
+* A blue ball that hits the snake awards XP to the player who kicked it.
+*
 * @param snakeBoss Pointer to snake boss entity
 * @param ball Pointer to ball entity
-* @param player Pointer to player entity (for XP awards)
+* @param players Players, indexed by BallData kickerIndex (for XP awards)
+* @param playerCount Number of players
 * @return true If collision occurred
 * @return false If no collision
 */
-bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* player);
+bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity** players, int playerCount);
 
 /**
 * @brief Handle snake boss collision with the player
 *
+* Damages and knocks back a touching player. Keeping the player out of
+* the snake is left to the physics solver.
+*
 * @param snakeBoss Pointer to snake boss entity
 * @param player Pointer to player entity
 * @return true If collision occurred
@@ -113,6 +128,14 @@ bool SnakeBossHandleBallCollision(Entity* snakeBoss, Entity* ball, Entity* playe
 */
 bool SnakeBossHandlePlayerCollision(Entity* snakeBoss, Entity* player);
 
+/**
+* @brief Add the snake boss to a physics solve
+*
+* @param snakeBoss Pointer to snake boss entity
+* @param solver Pointer to physics solver
+*/
+void SnakeBossAddPhysicsBodies(Entity* snakeBoss, PhysicsSolver* solver);
+
 /**
 * @brief Make the snake boss grow by one segment
 *
@@ -0,0 +1,140 @@
+/**
+ * @file surface.c
+ * @brief Implementation of per-step surface sampling
+ */
+
+#include <math.h>
+#include "surface.h"
+#include "player.h"
+#include "ball.h"
+#include "config.h"
+
+/**
+ * @brief Start collecting entities for a step
+ *
+ * @param sampler Pointer to sampler
+ */
+void SurfaceSamplerBegin(SurfaceSampler* sampler) {
+    if (!sampler) return;
+
+    sampler->sampleCount = 0;
+}
+
+/**
+ * @brief Add an entity to this step's sampling
+ *
+ * @param sampler Pointer to sampler
+ * @param entity Player or ball entity
+ * @return bool Whether the entity fit
+ */
+bool SurfaceSamplerAdd(SurfaceSampler* sampler, Entity* entity) {
+    if (!sampler || !entity) return false;
+
+    if (sampler->sampleCount >= SURFACE_MAX_SAMPLES) {
+        TraceLog(LOG_DEBUG, "Surface sampler full, entity keeps its last surface");
+        return false;
+    }
+
+    SurfaceSample* sample = &sampler->samples[sampler->sampleCount++];
+    sample->entity = entity;
+    sample->tileX = (int)floorf(entity->x / TILE_WIDTH);
+    sample->tileY = (int)floorf(entity->y / TILE_HEIGHT);
+    sample->tileType = TILE_TYPE_EMPTY;
+    sample->friction = 1.0f;
+    sample->damagePerSecond = 0.0f;
+    return true;
+}
+
+/**
+ * @brief Look up the tile under every added entity
+ *
+ * Fixed-size worlds read their tile array directly. Streamed worlds go
+ * through the chunk map, reusing the previous lookup while entities
+ * share a tile, which crowds of balls usually do.
+ *
+ * @param sampler Pointer to sampler
+ * @param world Pointer to world
+ */
+void SurfaceSamplerSample(SurfaceSampler* sampler, World* world) {
+    if (!sampler || !world) return;
+
+    if (world->tiles && !world->chunks) {
+        const unsigned char* tiles = world->tiles;
+        int width = world->width;
+        int height = world->height;
+
+        for (int i = 0; i < sampler->sampleCount; i++) {
+            SurfaceSample* sample = &sampler->samples[i];
+            if (sample->tileX < 0 || sample->tileX >= width || sample->tileY < 0 || sample->tileY >= height) {
+                sample->tileType = TILE_TYPE_WALL;
+            }
+            else {
+                sample->tileType = (TileType)tiles[sample->tileY * width + sample->tileX];
+            }
+        }
+    }
+    else {
+        int lastX = 0;
+        int lastY = 0;
+        TileType lastType = TILE_TYPE_WALL;
+        bool haveLast = false;
+
+        for (int i = 0; i < sampler->sampleCount; i++) {
+            SurfaceSample* sample = &sampler->samples[i];
+            if (!haveLast || sample->tileX != lastX || sample->tileY != lastY) {
+                lastX = sample->tileX;
+                lastY = sample->tileY;
+                lastType = WorldGetTileType(world, lastX, lastY);
+                haveLast = true;
+            }
+            sample->tileType = lastType;
+        }
+    }
+
+    // Read the surface out of the tile property table
+    for (int i = 0; i < sampler->sampleCount; i++) {
+        SurfaceSample* sample = &sampler->samples[i];
+        const TileProperties* properties = TileGetProperties(sample->tileType);
+        sample->friction = properties->friction;
+        sample->damagePerSecond = properties->damagePerSecond;
+    }
+}
+
+/**
+ * @brief Hand each entity its surface
+ *
+ * Sets the surface friction players and balls move with this step and
+ * deals tile damage to living players.
+ *
+ * @param sampler Pointer to sampler
+ * @param deltaTime Step length in seconds
+ */
+void SurfaceSamplerApply(SurfaceSampler* sampler, float deltaTime) {
+    if (!sampler) return;
+
+    for (int i = 0; i < sampler->sampleCount; i++) {
+        const SurfaceSample* sample = &sampler->samples[i];
+        Entity* entity = sample->entity;
+        if (!entity->typeData) continue;
+
+        switch (entity->type) {
+        case ENTITY_PLAYER: {
+            PlayerData* playerData = (PlayerData*)entity->typeData;
+            playerData->surfaceFriction = sample->friction;
+
+            if (sample->damagePerSecond > 0.0f && playerData->state == PLAYER_STATE_ALIVE) {
+                playerData->currentHealth -= sample->damagePerSecond * deltaTime;
+                if (playerData->currentHealth < 0) playerData->currentHealth = 0;
+            }
+            break;
+        }
+
+        case ENTITY_BALL:
+            ((BallData*)entity->typeData)->surfaceFriction = sample->friction;
+            break;
+
+        default:
+            break;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @file surface.h
+ * @brief Per-step sampling of the tiles under moving entities
+ *
+ * This file defines the stage that finds which tile each player and
+ * ball stands on and hands them that tile's surface: a friction
+ * multiplier (ice slides, water drags) and damage over time (lava,
+ * water). Entities are added once per step, then all their tiles are
+ * looked up in one pass over the world grid before any of them move,
+ * so the cost stays a few array loads per entity with hundreds in play.
+ */
+#ifndef MESSY_GAME_SURFACE_H
+#define MESSY_GAME_SURFACE_H
+
+#include <stdbool.h>
+#include "entity.h"
+#include "world.h"
+
+#define SURFACE_MAX_SAMPLES 512 // Upper bound on entities sampled in one step
+
+/**
+ * @brief Surface under one entity
+ */
+typedef struct {
+    Entity* entity;            // Entity standing on the tile
+    int tileX;                 // Tile column under the entity's center
+    int tileY;                 // Tile row under the entity's center
+    TileType tileType;         // Tile under the entity's center
+    float friction;            // Friction multiplier of the tile (1 = normal floor)
+    float damagePerSecond;     // Damage per second the tile deals
+} SurfaceSample;
+
+/**
+ * @brief Surface sampler
+ *
+ * Entities are collected fresh each step between SurfaceSamplerBegin
+ * and SurfaceSamplerApply; nothing carries over between steps.
+ */
+typedef struct {
+    SurfaceSample samples[SURFACE_MAX_SAMPLES]; // Entities sampled this step
+    int sampleCount;           // Number of samples
+} SurfaceSampler;
+
+/**
+ * @brief Start collecting entities for a step
+ *
+ * @param sampler Pointer to sampler
+ */
+void SurfaceSamplerBegin(SurfaceSampler* sampler);
+
+/**
+ * @brief Add an entity to this step's sampling
+ *
+ * @param sampler Pointer to sampler
+ * @param entity Player or ball entity
+ * @return bool Whether the entity fit
+ */
+bool SurfaceSamplerAdd(SurfaceSampler* sampler, Entity* entity);
+
+/**
+ * @brief Look up the tile under every added entity
+ *
+ * @param sampler Pointer to sampler
+ * @param world Pointer to world
+ */
+void SurfaceSamplerSample(SurfaceSampler* sampler, World* world);
+
+/**
+ * @brief Hand each entity its surface
+ *
+ * Sets the surface friction players and balls move with this step and
+ * deals tile damage to living players.
+ *
+ * @param sampler Pointer to sampler
+ * @param deltaTime Step length in seconds
+ */
+void SurfaceSamplerApply(SurfaceSampler* sampler, float deltaTime);
+
+#endif // MESSY_GAME_SURFACE_H
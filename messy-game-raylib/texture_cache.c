@@ -0,0 +1,219 @@
+/**
+ * @file texture_cache.c
+ * @brief Implementation of pre-baked texture cache
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "texture_cache.h"
+#include "textures.h"
+#include "config.h"
+
+// FNV-1a 64-bit parameters
+#define TEXTURE_CACHE_FNV_OFFSET 0xCBF29CE484222325ULL
+#define TEXTURE_CACHE_FNV_PRIME 0x100000001B3ULL
+
+// Compile-time layout check: the format must not depend on compiler padding, and
+// the 64-byte header keeps the pixel data that follows it cache-line aligned
+typedef char TextureCacheHeaderSizeCheck[(sizeof(TextureCacheHeader) == 64) ? 1 : -1];
+
+/**
+ * @brief Build the cache blob path for a source hash
+ *
+ * @param hash Source hash
+ * @param path Buffer to store path
+ * @param pathSize Size of buffer
+ */
+static void TextureCachePath(uint64_t hash, char* path, size_t pathSize) {
+    sprintf_s(path, pathSize, "%s/%016llx.tex", ASSET_CACHE_PATH, (unsigned long long)hash);
+}
+
+/**
+ * @brief Hash a file's contents
+ *
+ * @param path Path to file
+ * @param hash Pointer to store the hash
+ * @return bool Whether the file could be read
+ */
+bool TextureCacheHashFile(const char* path, uint64_t* hash) {
+    if (!path || !hash) return false;
+
+    PlatformFileMap map;
+    if (!PlatformMapFile(path, &map)) return false;
+
+    // FNV-1a over the raw file bytes
+    uint64_t value = TEXTURE_CACHE_FNV_OFFSET;
+    const unsigned char* bytes = (const unsigned char*)map.data;
+    for (size_t i = 0; i < map.size; i++) {
+        value ^= bytes[i];
+        value *= TEXTURE_CACHE_FNV_PRIME;
+    }
+
+    PlatformUnmapFile(&map);
+
+    *hash = value;
+    return true;
+}
+
+/**
+ * @brief Open the cached blob for a source image
+ *
+ * Maps the blob and points the returned image at the pixel data inside
+ * the mapping, so nothing is decoded or copied.
+ *
+ * @param sourcePath Path to source image
+ * @param entry Pointer to entry to fill
+ * @return bool Whether a valid, up-to-date blob was found
+ */
+bool TextureCacheOpen(const char* sourcePath, TextureCacheEntry* entry) {
+    if (!sourcePath || !entry) return false;
+
+    memset(entry, 0, sizeof(TextureCacheEntry));
+
+    uint64_t hash;
+    if (!TextureCacheHashFile(sourcePath, &hash)) return false;
+
+    char path[256];
+    TextureCachePath(hash, path, sizeof(path));
+    if (!PlatformMapFile(path, &entry->map)) return false;
+
+    // Validate the header against the source and the file size
+    const TextureCacheHeader* header = (const TextureCacheHeader*)entry->map.data;
+    bool valid = entry->map.size >= sizeof(TextureCacheHeader) &&
+        memcmp(header->magic, TEXTURE_CACHE_MAGIC, 4) == 0 &&
+        header->version == TEXTURE_CACHE_VERSION &&
+        header->sourceHash == hash &&
+        header->width > 0 && header->height > 0 && header->mipmaps == 1 &&
+        header->dataSize == (uint32_t)GetPixelDataSize(header->width, header->height, header->format) &&
+        header->dataOffset >= sizeof(TextureCacheHeader) &&
+        header->dataOffset <= entry->map.size &&
+        header->dataSize <= entry->map.size - header->dataOffset;
+
+    if (!valid) {
+        TraceLog(LOG_WARNING, "Ignoring invalid texture cache blob: %s", path);
+        PlatformUnmapFile(&entry->map);
+        return false;
+    }
+
+    entry->image.data = (unsigned char*)entry->map.data + header->dataOffset;
+    entry->image.width = header->width;
+    entry->image.height = header->height;
+    entry->image.mipmaps = header->mipmaps;
+    entry->image.format = header->format;
+
+    return true;
+}
+
+/**
+ * @brief Release an opened cache blob
+ *
+ * @param entry Pointer to entry (cleared on return)
+ */
+void TextureCacheClose(TextureCacheEntry* entry) {
+    if (!entry) return;
+
+    PlatformUnmapFile(&entry->map);
+    entry->image = (Image){ 0 };
+}
+
+/**
+ * @brief Store a decoded image in the cache
+ *
+ * The blob is written under a temporary name and renamed into place, so
+ * a reader never maps a half-written blob.
+ *
+ * @param sourcePath Path to source image the pixels came from
+ * @param image Decoded image
+ * @return bool Whether the blob was written
+ */
+bool TextureCacheStore(const char* sourcePath, Image image) {
+    if (!sourcePath || !image.data || image.mipmaps != 1) return false;
+
+    uint64_t hash;
+    if (!TextureCacheHashFile(sourcePath, &hash)) return false;
+
+    if (!DirectoryExists(ASSET_CACHE_PATH) && MakeDirectory(ASSET_CACHE_PATH) != 0) {
+        TraceLog(LOG_WARNING, "Failed to create texture cache directory: %s", ASSET_CACHE_PATH);
+        return false;
+    }
+
+    TextureCacheHeader header = { 0 };
+    memcpy(header.magic, TEXTURE_CACHE_MAGIC, 4);
+    header.version = TEXTURE_CACHE_VERSION;
+    header.sourceHash = hash;
+    header.width = image.width;
+    header.height = image.height;
+    header.mipmaps = image.mipmaps;
+    header.format = image.format;
+    header.dataOffset = sizeof(TextureCacheHeader);
+    header.dataSize = (uint32_t)GetPixelDataSize(image.width, image.height, image.format);
+
+    char path[256];
+    char tempPath[264];
+    TextureCachePath(hash, path, sizeof(path));
+    sprintf_s(tempPath, sizeof(tempPath), "%s.tmp", path);
+
+    FILE* file = fopen(tempPath, "wb");
+    if (!file) {
+        TraceLog(LOG_WARNING, "Failed to open texture cache blob for writing: %s", tempPath);
+        return false;
+    }
+
+    // Header followed directly by pixels
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(image.data, 1, header.dataSize, file) == header.dataSize;
+    success &= fclose(file) == 0;
+
+    // Replace any existing blob
+    remove(path);
+    if (!success || rename(tempPath, path) != 0) {
+        TraceLog(LOG_WARNING, "Failed to write texture cache blob: %s", path);
+        remove(tempPath);
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "Cached %s as %s (%dx%d)", sourcePath, path, image.width, image.height);
+    return true;
+}
+
+/**
+ * @brief Decode a source image and store it in the cache
+ *
+ * @param sourcePath Path to source image
+ * @return bool Whether the blob was written
+ */
+bool TextureCacheCook(const char* sourcePath) {
+    if (!sourcePath) return false;
+
+    Image image = LoadImage(sourcePath);
+    if (image.data == NULL) {
+        TraceLog(LOG_ERROR, "Failed to load image: %s", sourcePath);
+        return false;
+    }
+
+    bool success = TextureCacheStore(sourcePath, image);
+    UnloadImage(image);
+
+    return success;
+}
+
+/**
+ * @brief Cook every initial game texture
+ *
+ * @return int Number of textures that failed to cook
+ */
+int TextureCacheCookGameAssets(void) {
+    const TextureAssetDesc* assets = NULL;
+    int assetCount = TextureManagerGetGameAssets(&assets);
+
+    int failedCount = 0;
+    for (int i = 0; i < assetCount; i++) {
+        if (!TextureCacheCook(assets[i].filePath)) {
+            failedCount++;
+        }
+    }
+
+    TraceLog(LOG_INFO, "Cooked %d of %d textures", assetCount - failedCount, assetCount);
+    return failedCount;
+}
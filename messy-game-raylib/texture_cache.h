@@ -0,0 +1,99 @@
+/**
+ * @file texture_cache.h
+ * @brief Pre-baked texture cache
+ *
+ * This file defines the cache of GPU-ready texture blobs. A blob holds the
+ * decoded pixels of a source image exactly as they are uploaded, keyed by
+ * a hash of the source file's bytes, so a cache hit replaces PNG decoding
+ * with a file mapping. Blobs are produced offline with --cook-assets, or on
+ * the first run that misses the cache.
+ */
+#ifndef MESSY_GAME_TEXTURE_CACHE_H
+#define MESSY_GAME_TEXTURE_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "raylib.h"
+#include "platform.h"
+
+// Cache file identification
+#define TEXTURE_CACHE_MAGIC "MGTX"     // First four bytes of every cache blob
+#define TEXTURE_CACHE_VERSION 1        // Bump when the layout changes
+
+/**
+ * @brief Cache blob header, followed by the pixel data at dataOffset
+ */
+typedef struct {
+    char magic[4];             // TEXTURE_CACHE_MAGIC
+    uint32_t version;          // TEXTURE_CACHE_VERSION
+    uint64_t sourceHash;       // Hash of the source file's bytes
+    int32_t width;             // Image width in pixels
+    int32_t height;            // Image height in pixels
+    int32_t mipmaps;           // Number of mipmap levels stored
+    int32_t format;            // PixelFormat of the stored data
+    uint32_t dataOffset;       // Offset of pixel data from start of file
+    uint32_t dataSize;         // Size of pixel data in bytes
+    uint32_t reserved[6];      // Must be zero
+} TextureCacheHeader;
+
+/**
+ * @brief Opened cache blob
+ *
+ * image.data points into the mapped file, so the image must not be passed
+ * to UnloadImage; release it with TextureCacheClose.
+ */
+typedef struct {
+    PlatformFileMap map;       // Mapped cache blob
+    Image image;               // Image describing the mapped pixels
+} TextureCacheEntry;
+
+/**
+ * @brief Hash a file's contents
+ *
+ * @param path Path to file
+ * @param hash Pointer to store the hash
+ * @return bool Whether the file could be read
+ */
+bool TextureCacheHashFile(const char* path, uint64_t* hash);
+
+/**
+ * @brief Open the cached blob for a source image
+ *
+ * @param sourcePath Path to source image
+ * @param entry Pointer to entry to fill
+ * @return bool Whether a valid, up-to-date blob was found
+ */
+bool TextureCacheOpen(const char* sourcePath, TextureCacheEntry* entry);
+
+/**
+ * @brief Release an opened cache blob
+ *
+ * @param entry Pointer to entry (cleared on return)
+ */
+void TextureCacheClose(TextureCacheEntry* entry);
+
+/**
+ * @brief Store a decoded image in the cache
+ *
+ * @param sourcePath Path to source image the pixels came from
+ * @param image Decoded image
+ * @return bool Whether the blob was written
+ */
+bool TextureCacheStore(const char* sourcePath, Image image);
+
+/**
+ * @brief Decode a source image and store it in the cache
+ *
+ * @param sourcePath Path to source image
+ * @return bool Whether the blob was written
+ */
+bool TextureCacheCook(const char* sourcePath);
+
+/**
+ * @brief Cook every initial game texture
+ *
+ * @return int Number of textures that failed to cook
+ */
+int TextureCacheCookGameAssets(void);
+
+#endif // MESSY_GAME_TEXTURE_CACHE_H
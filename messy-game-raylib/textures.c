@@ -6,28 +6,17 @@
 #include <stdlib.h>
 #include <string.h>
 #include "textures.h"
+#include "texture_cache.h"
 #include "config.h"
 
- // Singleton instance for global access
-static TextureManager* gTextureManager = NULL;
-
-/**
- * @brief Get global texture manager instance
- *
- * @return TextureManager* Pointer to the global texture manager
- */
-TextureManager* GetTextureManager(void) {
-    return gTextureManager;
-}
-
-/**
- * @brief Set global texture manager instance
- *
- * @param manager Pointer to texture manager
- */
-void SetTextureManager(TextureManager* manager) {
-    gTextureManager = manager;
-}
+// Textures loaded at startup
+static const TextureAssetDesc gGameAssets[] = {
+    // Tilemap - using 25x25 tile size
+    { TEXTURE_TILEMAP, TILEMAP_ASSET_PATH, TILE_WIDTH, TILE_HEIGHT },
+    // Player sprites - using 25x25 sprite size for new spritesheet
+    { TEXTURE_PLAYER, PLAYER_ASSET_PATH, SPRITE_WIDTH, SPRITE_HEIGHT },
+    // Add more assets here as needed
+};
 
 /**
  * @brief Create a new texture manager
@@ -64,9 +53,6 @@ TextureManager* TextureManagerCreate(int initialCapacity) {
     manager->count = 0;
     manager->capacity = initialCapacity;
 
-    // Set as global instance
-    SetTextureManager(manager);
-
     return manager;
 }
 
@@ -84,11 +70,6 @@ void TextureManagerDestroy(TextureManager* manager) {
     // Free resources
     free(manager->textures);
 
-    // Clear global reference if this is the current manager
-    if (gTextureManager == manager) {
-        gTextureManager = NULL;
-    }
-
     // Free manager
     free(manager);
 }
@@ -106,30 +87,86 @@ void TextureManagerDestroy(TextureManager* manager) {
 bool TextureManagerLoad(TextureManager* manager, TextureID id, const char* filePath, int tileWidth, int tileHeight) {
     if (!manager || id < 0 || id >= TEXTURE_COUNT || !filePath) return false;
 
-    // Unload existing texture if loaded
-    if (manager->textures[id].loaded) {
-        TextureManagerUnload(manager, id);
+    // Upload straight from the pre-baked blob if there is one
+    TextureCacheEntry cached;
+    if (TextureCacheOpen(filePath, &cached)) {
+        bool success = TextureManagerUploadImage(manager, id, cached.image, filePath, tileWidth, tileHeight);
+        TextureCacheClose(&cached);
+        return success;
     }
 
-    // Load texture
+    // Load image
     Image image = LoadImage(filePath);
     if (image.data == NULL) {
         TraceLog(LOG_ERROR, "Failed to load image: %s", filePath);
         return false;
     }
 
-    // Create texture from image
-    Texture2D texture = LoadTextureFromImage(image);
+    // Bake it so the next launch skips decoding
+    if (ASSET_CACHE_WRITE_ON_MISS) {
+        TextureCacheStore(filePath, image);
+    }
+
+    return TextureManagerLoadFromImage(manager, id, image, filePath, tileWidth, tileHeight);
+}
+
+/**
+ * @brief Create a texture from an already decoded image
+ *
+ * This is the GPU upload half of TextureManagerLoad, split out so that
+ * images can be decoded on another thread.
+ *
+ * @param manager Pointer to texture manager
+ * @param id Texture ID
+ * @param image Decoded image (unloaded by this call)
+ * @param filePath Path the image was loaded from
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the texture was created
+ */
+bool TextureManagerLoadFromImage(TextureManager* manager, TextureID id, Image image, const char* filePath, int tileWidth, int tileHeight) {
+    bool success = TextureManagerUploadImage(manager, id, image, filePath, tileWidth, tileHeight);
     UnloadImage(image);
 
+    return success;
+}
+
+/**
+ * @brief Create a texture from image pixels without taking the image
+ *
+ * The pixels are uploaded directly, so they may live in a mapped file.
+ *
+ * @param manager Pointer to texture manager
+ * @param id Texture ID
+ * @param image Image to upload (still owned by the caller)
+ * @param filePath Path the image was loaded from
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the texture was created
+ */
+bool TextureManagerUploadImage(TextureManager* manager, TextureID id, Image image, const char* filePath, int tileWidth, int tileHeight) {
+    if (!manager || id < 0 || id >= TEXTURE_COUNT || !filePath || image.data == NULL) return false;
+
+    // Create texture from image before touching the existing one, so a
+    // failed reload keeps the old texture on screen
+    Texture2D texture = LoadTextureFromImage(image);
+
     if (texture.id == 0) {
         TraceLog(LOG_ERROR, "Failed to create texture from image: %s", filePath);
         return false;
     }
 
+    // Copy the path first, it may be the one about to be freed
+    char* pathCopy = _strdup(filePath);
+
+    // Swap out existing texture if loaded
+    if (manager->textures[id].loaded) {
+        TextureManagerUnload(manager, id);
+    }
+
     // Store texture info
     manager->textures[id].texture = texture;
-    manager->textures[id].filePath = _strdup(filePath);
+    manager->textures[id].filePath = pathCopy;
     manager->textures[id].loaded = true;
     manager->textures[id].tileWidth = tileWidth;
     manager->textures[id].tileHeight = tileHeight;
@@ -290,13 +327,30 @@ bool TextureManagerLoadGameAssets(TextureManager* manager) {
 
     bool success = true;
 
-    // Load tilemap - using 25x25 tile size
-    success &= TextureManagerLoad(manager, TEXTURE_TILEMAP, TILEMAP_ASSET_PATH, TILE_WIDTH, TILE_HEIGHT);
+    // Load every startup asset synchronously
+    for (int i = 0; i < (int)(sizeof(gGameAssets) / sizeof(gGameAssets[0])); i++) {
+        success &= TextureManagerLoad(
+            manager,
+            gGameAssets[i].id,
+            gGameAssets[i].filePath,
+            gGameAssets[i].tileWidth,
+            gGameAssets[i].tileHeight
+        );
+    }
 
-    // Load player sprites - using 25x25 sprite size for new spritesheet
-    success &= TextureManagerLoad(manager, TEXTURE_PLAYER, PLAYER_ASSET_PATH, SPRITE_WIDTH, SPRITE_HEIGHT);
+    return success;
+}
 
-    // Add more asset loading here as needed
+/**
+ * @brief Get the list of initial game assets
+ *
+ * @param assets Pointer to store the asset array
+ * @return int Number of assets
+ */
+int TextureManagerGetGameAssets(const TextureAssetDesc** assets) {
+    if (assets) {
+        *assets = gGameAssets;
+    }
 
-    return success;
+    return (int)(sizeof(gGameAssets) / sizeof(gGameAssets[0]));
 }
\ No newline at end of file
@@ -45,6 +45,18 @@ typedef struct {
     // Add more texture attributes as needed
 } TextureInfo;
 
+/**
+ * @brief Texture asset description
+ *
+ * Describes a texture file the game loads at startup.
+ */
+typedef struct {
+    TextureID id;            // Texture slot to load into
+    const char* filePath;    // Path to texture file
+    int tileWidth;           // Width of tiles (if tileset) or 0
+    int tileHeight;          // Height of tiles (if tileset) or 0
+} TextureAssetDesc;
+
 /**
  * @brief Texture manager structure
  *
@@ -84,6 +96,38 @@ void TextureManagerDestroy(TextureManager* manager);
  */
 bool TextureManagerLoad(TextureManager* manager, TextureID id, const char* filePath, int tileWidth, int tileHeight);
 
+/**
+ * @brief Create a texture from image pixels without taking the image
+ *
+ * Must be called on the thread that owns the graphics context. The caller
+ * keeps ownership of the image (e.g. pixels in a mapped cache blob).
+ *
+ * @param manager Pointer to texture manager
+ * @param id Texture ID
+ * @param image Image to upload
+ * @param filePath Path the image was loaded from
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the texture was created
+ */
+bool TextureManagerUploadImage(TextureManager* manager, TextureID id, Image image, const char* filePath, int tileWidth, int tileHeight);
+
+/**
+ * @brief Create a texture from an already decoded image
+ *
+ * Must be called on the thread that owns the graphics context. The image
+ * is always unloaded by this call.
+ *
+ * @param manager Pointer to texture manager
+ * @param id Texture ID
+ * @param image Decoded image
+ * @param filePath Path the image was loaded from
+ * @param tileWidth Width of tiles (if tileset) or 0
+ * @param tileHeight Height of tiles (if tileset) or 0
+ * @return bool Whether the texture was created
+ */
+bool TextureManagerLoadFromImage(TextureManager* manager, TextureID id, Image image, const char* filePath, int tileWidth, int tileHeight);
+
 /**
  * @brief Unload a texture
  *
@@ -147,6 +191,12 @@ Rectangle TextureManagerGetTileRect(TextureManager* manager, TextureID id, int t
  */
 bool TextureManagerLoadGameAssets(TextureManager* manager);
 
-TextureManager* GetTextureManager(void);
+/**
+ * @brief Get the list of initial game assets
+ *
+ * @param assets Pointer to store the asset array
+ * @return int Number of assets
+ */
+int TextureManagerGetGameAssets(const TextureAssetDesc** assets);
 
 #endif // MESSY_GAME_TEXTURES_H
\ No newline at end of file
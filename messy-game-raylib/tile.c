@@ -12,6 +12,23 @@
 #include "renderer.h"
 #include <stdlib.h>
 
+// Properties of each tile type, indexed by TileType
+static const TileProperties gTileProperties[TILE_TYPE_COUNT] = {
+    // flags, base color, border color, tint, texture, friction, damage per second
+    [TILE_TYPE_EMPTY] = { TILE_FLAG_NONE, { TILE_FLOOR_RGBA }, { TILE_FLOOR_BORDER_RGBA }, { TILE_FLOOR_RGBA }, 4, 4, 1.0f, 0.0f },
+    [TILE_TYPE_WALL] = { TILE_FLAG_SOLID, { TILE_WALL_RGBA }, { TILE_WALL_BORDER_RGBA }, { TILE_WALL_RGBA }, 15, 6, 1.0f, 0.0f },
+    [TILE_TYPE_WATER] = { TILE_FLAG_DAMAGE, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 10, 4, TILE_WATER_FRICTION, TILE_WATER_DAMAGE_PER_SECOND },
+    [TILE_TYPE_LAVA] = { TILE_FLAG_DAMAGE, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 10, 7, 1.0f, TILE_LAVA_DAMAGE_PER_SECOND },
+    [TILE_TYPE_ICE] = { TILE_FLAG_SLIPPERY, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 7, 4, TILE_ICE_FRICTION, 0.0f },
+    [TILE_TYPE_DOOR] = { TILE_FLAG_TRANSITION, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 9, 1, 1.0f, 0.0f },
+    [TILE_TYPE_SWITCH] = { TILE_FLAG_TRIGGER, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 8, 6, 1.0f, 0.0f },
+};
+
+// Properties reported for values outside TileType
+static const TileProperties gTileUnknownProperties = {
+    TILE_FLAG_NONE, { 255, 255, 255, 255 }, { 0, 0, 0, 0 }, { 255, 255, 255, 255 }, 0, 0, 1.0f, 0.0f
+};
+
  /**
  * @brief Create a new tile
  *
@@ -29,29 +46,16 @@ Tile* TileCreate(int x, int y, TileType type) {
         return NULL;
     }
 
-    // Initialize tile properties
+    // Initialize tile properties from its type
+    const TileProperties* properties = TileGetProperties(type);
     tile->x = x;
     tile->y = y;
     tile->type = type;
-
-    // Set color based on tile type
-    if (type == TILE_TYPE_WALL) {
-        tile->tint = TILE_WALL_COLOR;
-    }
-    else if (type == TILE_TYPE_EMPTY) {
-        tile->tint = TILE_FLOOR_COLOR;
-    }
-    else {
-        tile->tint = WHITE; // Default tint for other types
-    }
-
+    tile->tint = properties->tint;
     tile->data = 0;
-
-    // Set default flags based on type
-    tile->flags = TileGetDefaultFlags(type);
-
-    // Set default texture coordinates based on type
-    TileGetDefaultTexture(type, &tile->textureX, &tile->textureY);
+    tile->flags = properties->flags;
+    tile->textureX = properties->textureX;
+    tile->textureY = properties->textureY;
 
     return tile;
 }
@@ -72,40 +76,21 @@ void TileDestroy(Tile* tile) {
 * @brief Render tile at specified position
 *
 * @param tile Pointer to tile
+* @param renderer Renderer to draw with
 * @param posX X position to render
 * @param posY Y position to render
 */
-void TileRender(Tile* tile, int posX, int posY) {
-    if (!tile) return;
+void TileRender(Tile* tile, Renderer* renderer, int posX, int posY) {
+    if (!tile || !renderer) return;
 
-    // Get renderer (normally would be passed as parameter)
-    Renderer* renderer = GetRenderer();
-    if (!renderer) return;
-
-    // Determine base color and border color based on tile type
-    Color baseColor;
-    Color borderColor;
-
-    if (tile->type == TILE_TYPE_WALL) {
-        baseColor = TILE_WALL_COLOR;
-        borderColor = TILE_WALL_BORDER_COLOR;
-    }
-    else if (tile->type == TILE_TYPE_EMPTY) {
-        baseColor = TILE_FLOOR_COLOR;
-        borderColor = TILE_FLOOR_BORDER_COLOR;
-    }
-    else {
-        // For other tile types, use the tile's tint
-        baseColor = tile->tint;
-        borderColor = BLANK; // Default to transparent borders
-    }
+    const TileProperties* properties = TileGetProperties(tile->type);
 
     // Draw base rectangle with configured color
-    DrawRectangle(posX, posY, TILE_WIDTH, TILE_HEIGHT, baseColor);
+    DrawRectangle(posX, posY, TILE_WIDTH, TILE_HEIGHT, properties->baseColor);
 
     // Only draw border if not transparent
-    if (borderColor.a > 0) {
-        DrawRectangleLines(posX, posY, TILE_WIDTH, TILE_HEIGHT, borderColor);
+    if (properties->borderColor.a > 0) {
+        DrawRectangleLines(posX, posY, TILE_WIDTH, TILE_HEIGHT, properties->borderColor);
     }
 
     // Render using the tile's texture coordinates
@@ -119,8 +104,30 @@ void TileRender(Tile* tile, int posX, int posY) {
         tile->tint
     );
 
-    // Draw additional indicators for special tile properties
-    if (tile->flags & TILE_FLAG_DAMAGE) {
+    // Draw the indicators for special tile properties in one sprite
+    RendererDrawTileOverlay(renderer, tile->flags, posX, posY);
+}
+
+/**
+ * @brief Get the overlay sprite index for a set of flags
+ *
+ * @param flags Combination of TileFlags
+ * @return int Index from 0 to TILE_OVERLAY_COUNT - 1 (0 draws nothing)
+ */
+int TileGetOverlayIndex(unsigned int flags) {
+    // The overlay flags are the four bits above TILE_FLAG_SOLID
+    return (int)((flags & TILE_FLAG_OVERLAY_MASK) >> 1);
+}
+
+/**
+ * @brief Draw the indicators for a tile's flags with primitives
+ *
+ * @param flags Combination of TileFlags
+ * @param posX X position to draw at
+ * @param posY Y position to draw at
+ */
+void TileDrawFlagIndicators(unsigned int flags, int posX, int posY) {
+    if (flags & TILE_FLAG_DAMAGE) {
         // Draw damage indicator (red outline)
         DrawRectangleLines(
             posX,
@@ -131,19 +138,22 @@ void TileRender(Tile* tile, int posX, int posY) {
         );
     }
 
-    if (tile->flags & TILE_FLAG_SLIPPERY) {
-        // Draw slippery indicator (blue corners)
+    if (flags & TILE_FLAG_SLIPPERY) {
+        // Draw slippery indicator (blue corners), kept inside the tile so
+        // baked overlays do not bleed into the neighbouring atlas sprite
+        int right = posX + TILE_WIDTH - 1;
+        int bottom = posY + TILE_HEIGHT - 1;
         DrawLine(posX, posY, posX + 4, posY, BLUE);
         DrawLine(posX, posY, posX, posY + 4, BLUE);
-        DrawLine(posX + TILE_WIDTH - 4, posY, posX + TILE_WIDTH, posY, BLUE);
-        DrawLine(posX + TILE_WIDTH, posY, posX + TILE_WIDTH, posY + 4, BLUE);
-        DrawLine(posX, posY + TILE_HEIGHT, posX + 4, posY + TILE_HEIGHT, BLUE);
-        DrawLine(posX, posY + TILE_HEIGHT - 4, posX, posY + TILE_HEIGHT, BLUE);
-        DrawLine(posX + TILE_WIDTH - 4, posY + TILE_HEIGHT, posX + TILE_WIDTH, posY + TILE_HEIGHT, BLUE);
-        DrawLine(posX + TILE_WIDTH, posY + TILE_HEIGHT - 4, posX + TILE_WIDTH, posY + TILE_HEIGHT, BLUE);
+        DrawLine(right - 4, posY, right, posY, BLUE);
+        DrawLine(right, posY, right, posY + 4, BLUE);
+        DrawLine(posX, bottom, posX + 4, bottom, BLUE);
+        DrawLine(posX, bottom - 4, posX, bottom, BLUE);
+        DrawLine(right - 4, bottom, right, bottom, BLUE);
+        DrawLine(right, bottom - 4, right, bottom, BLUE);
     }
 
-    if (tile->flags & TILE_FLAG_TRIGGER) {
+    if (flags & TILE_FLAG_TRIGGER) {
         // Draw trigger indicator (yellow dot in center)
         DrawCircle(
             posX + TILE_WIDTH / 2,
@@ -153,7 +163,7 @@ void TileRender(Tile* tile, int posX, int posY) {
         );
     }
 
-    if (tile->flags & TILE_FLAG_TRANSITION) {
+    if (flags & TILE_FLAG_TRANSITION) {
         // Draw transition indicator (green diamond in center)
         DrawPoly(
             (Vector2) {
@@ -207,6 +217,17 @@ bool TileHasFlags(Tile* tile, unsigned int flags) {
     return (tile->flags & flags) == flags;
 }
 
+/**
+ * @brief Get the properties of a tile type
+ *
+ * @param type Tile type
+ * @return const TileProperties* Properties (no flags and texture 0,0 for unknown types)
+ */
+const TileProperties* TileGetProperties(TileType type) {
+    if ((unsigned int)type >= TILE_TYPE_COUNT) return &gTileUnknownProperties;
+    return &gTileProperties[type];
+}
+
 /**
  * @brief Get default flags for a tile type
  *
@@ -214,31 +235,7 @@ bool TileHasFlags(Tile* tile, unsigned int flags) {
  * @return unsigned int Default flags for this tile type
  */
 unsigned int TileGetDefaultFlags(TileType type) {
-    switch (type) {
-    case TILE_TYPE_EMPTY:
-        return TILE_FLAG_NONE;
-
-    case TILE_TYPE_WALL:
-        return TILE_FLAG_SOLID;
-
-    case TILE_TYPE_WATER:
-        return TILE_FLAG_DAMAGE;
-
-    case TILE_TYPE_LAVA:
-        return TILE_FLAG_DAMAGE;
-
-    case TILE_TYPE_ICE:
-        return TILE_FLAG_SLIPPERY;
-
-    case TILE_TYPE_DOOR:
-        return TILE_FLAG_TRANSITION;
-
-    case TILE_TYPE_SWITCH:
-        return TILE_FLAG_TRIGGER;
-
-    default:
-        return TILE_FLAG_NONE;
-    }
+    return TileGetProperties(type)->flags;
 }
 
 /**
@@ -251,47 +248,7 @@ unsigned int TileGetDefaultFlags(TileType type) {
 void TileGetDefaultTexture(TileType type, int* textureX, int* textureY) {
     if (!textureX || !textureY) return;
 
-    // These coordinates are based on the specific tileset used in the game
-    // The real implementation would use the actual coordinates from your tileset
-    switch (type) {
-    case TILE_TYPE_EMPTY:
-        *textureX = 4;
-        *textureY = 4;
-        break;
-
-    case TILE_TYPE_WALL:
-        *textureX = 15;
-        *textureY = 6;
-        break;
-
-    case TILE_TYPE_WATER:
-        *textureX = 10;
-        *textureY = 4;
-        break;
-
-    case TILE_TYPE_LAVA:
-        *textureX = 10;
-        *textureY = 7;
-        break;
-
-    case TILE_TYPE_ICE:
-        *textureX = 7;
-        *textureY = 4;
-        break;
-
-    case TILE_TYPE_DOOR:
-        *textureX = 9;
-        *textureY = 1;
-        break;
-
-    case TILE_TYPE_SWITCH:
-        *textureX = 8;
-        *textureY = 6;
-        break;
-
-    default:
-        *textureX = 0;
-        *textureY = 0;
-        break;
-    }
+    const TileProperties* properties = TileGetProperties(type);
+    *textureX = properties->textureX;
+    *textureY = properties->textureY;
 }
\ No newline at end of file
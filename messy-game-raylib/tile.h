@@ -3,7 +3,9 @@
  * @brief Tile definitions and functions
  *
  * This file defines the tile structure and functions for managing
- * individual tiles in the game world.
+ * individual tiles in the game world. Everything a tile type implies
+ * (flags, colors, texture, friction, damage) comes from one static
+ * property table, so looking a property up is a single array load.
  */
 
 #ifndef MESSY_GAME_TILE_H
@@ -11,6 +13,8 @@
 
 #include "raylib.h"
 
+struct Renderer; // Render context, defined in renderer.h
+
  /**
   * @brief Tile types enumeration
   *
@@ -43,6 +47,23 @@ typedef enum {
     // Add more flags as needed
 } TileFlags;
 
+#define TILE_FLAG_OVERLAY_MASK (TILE_FLAG_DAMAGE | TILE_FLAG_SLIPPERY | TILE_FLAG_TRIGGER | TILE_FLAG_TRANSITION) // Flags drawn as an overlay
+#define TILE_OVERLAY_COUNT 16  // Overlay flag combinations (one baked sprite each)
+
+/**
+ * @brief Properties shared by every tile of a type
+ */
+typedef struct {
+    unsigned int flags;        // Default TileFlags
+    Color baseColor;           // Fill drawn under the texture
+    Color borderColor;         // Outline color (transparent for none)
+    Color tint;                // Tint of new tiles
+    int textureX;              // X position in tileset
+    int textureY;              // Y position in tileset
+    float friction;            // Friction multiplier for things moving over it (1 = normal)
+    float damagePerSecond;     // Damage per second to a player standing on it
+} TileProperties;
+
 /**
  * @brief Tile structure
  *
@@ -81,10 +102,11 @@ void TileDestroy(Tile* tile);
  * @brief Render tile at specified position
  *
  * @param tile Pointer to tile
+ * @param renderer Renderer to draw with
  * @param posX X position to render
  * @param posY Y position to render
  */
-void TileRender(Tile* tile, int posX, int posY);
+void TileRender(Tile* tile, struct Renderer* renderer, int posX, int posY);
 
 /**
  * @brief Set tile texture coordinates
@@ -113,6 +135,34 @@ void TileSetFlags(Tile* tile, unsigned int flags);
  */
 bool TileHasFlags(Tile* tile, unsigned int flags);
 
+/**
+ * @brief Get the properties of a tile type
+ *
+ * @param type Tile type
+ * @return const TileProperties* Properties (no flags and texture 0,0 for unknown types)
+ */
+const TileProperties* TileGetProperties(TileType type);
+
+/**
+ * @brief Get the overlay sprite index for a set of flags
+ *
+ * @param flags Combination of TileFlags
+ * @return int Index from 0 to TILE_OVERLAY_COUNT - 1 (0 draws nothing)
+ */
+int TileGetOverlayIndex(unsigned int flags);
+
+/**
+ * @brief Draw the indicators for a tile's flags with primitives
+ *
+ * Used to bake the overlay sprites; tiles themselves draw the baked
+ * sprite.
+ *
+ * @param flags Combination of TileFlags
+ * @param posX X position to draw at
+ * @param posY Y position to draw at
+ */
+void TileDrawFlagIndicators(unsigned int flags, int posX, int posY);
+
 /**
  * @brief Get default flags for a tile type
  *
@@ -0,0 +1,93 @@
+/**
+ * @file tile_event.c
+ * @brief Implementation of tile events
+ */
+
+#include "tile_event.h"
+#include "raylib.h"
+
+/**
+ * @brief Remove every queued event
+ *
+ * @param queue Pointer to queue
+ */
+void TileEventQueueClear(TileEventQueue* queue) {
+    if (!queue) return;
+
+    queue->head = 0;
+    queue->count = 0;
+}
+
+/**
+ * @brief Append an event
+ *
+ * @param queue Pointer to queue
+ * @param event Event to append
+ * @return true If the event was queued
+ * @return false If the queue is full
+ */
+bool TileEventQueuePush(TileEventQueue* queue, TileEvent event) {
+    if (!queue || queue->count >= TILE_EVENT_QUEUE_CAPACITY) return false;
+
+    queue->events[(queue->head + queue->count) % TILE_EVENT_QUEUE_CAPACITY] = event;
+    queue->count++;
+    return true;
+}
+
+/**
+ * @brief Remove the oldest event
+ *
+ * @param queue Pointer to queue
+ * @param event Pointer to store the event
+ * @return true If an event was removed
+ * @return false If the queue is empty
+ */
+bool TileEventQueuePop(TileEventQueue* queue, TileEvent* event) {
+    if (!queue || !event || queue->count == 0) return false;
+
+    *event = queue->events[queue->head];
+    queue->head = (queue->head + 1) % TILE_EVENT_QUEUE_CAPACITY;
+    queue->count--;
+    return true;
+}
+
+/**
+ * @brief Queue an event for every sampled entity that entered an event tile
+ *
+ * @param queue Pointer to queue
+ * @param sampler Sampler holding this step's tiles
+ * @return int Number of events queued
+ */
+int TileEventDetect(TileEventQueue* queue, const SurfaceSampler* sampler) {
+    if (!queue || !sampler) return 0;
+
+    int queued = 0;
+    for (int i = 0; i < sampler->sampleCount; i++) {
+        const SurfaceSample* sample = &sampler->samples[i];
+        Entity* entity = sample->entity;
+
+        // Only a change of tile can raise an event
+        if (entity->tileX == sample->tileX && entity->tileY == sample->tileY) continue;
+        entity->tileX = sample->tileX;
+        entity->tileY = sample->tileY;
+
+        unsigned int flags = TileGetProperties(sample->tileType)->flags;
+        if (!(flags & (TILE_FLAG_TRIGGER | TILE_FLAG_TRANSITION))) continue;
+
+        TileEvent event = {
+            .type = (flags & TILE_FLAG_TRANSITION) ? TILE_EVENT_TRANSITION : TILE_EVENT_TRIGGER,
+            .entity = entity,
+            .tileX = sample->tileX,
+            .tileY = sample->tileY,
+            .tileType = sample->tileType
+        };
+
+        if (!TileEventQueuePush(queue, event)) {
+            TraceLog(LOG_DEBUG, "Tile event queue full, dropping event at (%d, %d)", sample->tileX, sample->tileY);
+            continue;
+        }
+        queued++;
+    }
+
+    return queued;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file tile_event.h
+ * @brief Events raised by entities stepping onto special tiles
+ *
+ * This file defines the queue of tile events. After the surface sampler
+ * has found the tile under every player and ball, entities whose tile
+ * changed onto a trigger or transition tile each queue one event; the
+ * game drains the queue in the same step, before anything moves.
+ */
+#ifndef MESSY_GAME_TILE_EVENT_H
+#define MESSY_GAME_TILE_EVENT_H
+
+#include <stdbool.h>
+#include "entity.h"
+#include "tile.h"
+#include "surface.h"
+
+#define TILE_EVENT_QUEUE_CAPACITY 64 // Most tile events raised in one step
+
+/**
+ * @brief Tile event types enumeration
+ */
+typedef enum {
+    TILE_EVENT_TRIGGER,        // Entered a TILE_FLAG_TRIGGER tile (switches)
+    TILE_EVENT_TRANSITION,     // Entered a TILE_FLAG_TRANSITION tile (doors)
+    TILE_EVENT_COUNT
+} TileEventType;
+
+/**
+ * @brief Tile event
+ */
+typedef struct {
+    TileEventType type;        // What happened
+    Entity* entity;            // Entity that entered the tile
+    int tileX;                 // Tile X position in tiles
+    int tileY;                 // Tile Y position in tiles
+    TileType tileType;         // Type of the tile entered
+} TileEvent;
+
+/**
+ * @brief Fixed-capacity event ring buffer
+ */
+typedef struct {
+    TileEvent events[TILE_EVENT_QUEUE_CAPACITY]; // Event storage
+    int head;                  // Index of oldest event
+    int count;                 // Number of queued events
+} TileEventQueue;
+
+/**
+ * @brief Remove every queued event
+ *
+ * @param queue Pointer to queue
+ */
+void TileEventQueueClear(TileEventQueue* queue);
+
+/**
+ * @brief Append an event
+ *
+ * @param queue Pointer to queue
+ * @param event Event to append
+ * @return true If the event was queued
+ * @return false If the queue is full
+ */
+bool TileEventQueuePush(TileEventQueue* queue, TileEvent event);
+
+/**
+ * @brief Remove the oldest event
+ *
+ * @param queue Pointer to queue
+ * @param event Pointer to store the event
+ * @return true If an event was removed
+ * @return false If the queue is empty
+ */
+bool TileEventQueuePop(TileEventQueue* queue, TileEvent* event);
+
+/**
+ * @brief Queue an event for every sampled entity that entered an event tile
+ *
+ * Also records each entity's tile, so standing on a tile raises its
+ * event once.
+ *
+ * @param queue Pointer to queue
+ * @param sampler Sampler holding this step's tiles
+ * @return int Number of events queued
+ */
+int TileEventDetect(TileEventQueue* queue, const SurfaceSampler* sampler);
+
+#endif // MESSY_GAME_TILE_EVENT_H
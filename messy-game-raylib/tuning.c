@@ -0,0 +1,102 @@
+/**
+ * @file tuning.c
+ * @brief Implementation of per-game balancing parameters
+ */
+
+#include <math.h>
+#include <string.h>
+#include <stddef.h>
+#include "tuning.h"
+#include "config.h"
+#include "player.h"
+#include "snake_boss.h"
+
+/**
+ * @brief Tuning parameter description
+ */
+typedef struct {
+    const char* name;          // Config name
+    size_t offset;             // Offset of the field in GameTuning
+    bool isInteger;            // Whether the field is an int
+} GameTuningParameter;
+
+// Every parameter that can be set by name
+static const GameTuningParameter gTuningParameters[] = {
+    { "BALL_FRICTION", offsetof(GameTuning, ballFriction), false },
+    { "BALL_COUNT", offsetof(GameTuning, ballCount), true },
+    { "PLAYER_BASE_KICK_FORCE", offsetof(GameTuning, playerKickForce), false },
+    { "PLAYER_XP_PER_HIT", offsetof(GameTuning, playerXpPerHit), false },
+    { "SNAKE_INTERVAL_DECREASE", offsetof(GameTuning, snakeIntervalDecrease), false },
+    { "WIN_PLAYER_SEGMENTS_SNAKEBOSS", offsetof(GameTuning, winSegmentsPerGoal), true },
+    { "WIN_ENEMY_DAMAGE_TO_PLAYER", offsetof(GameTuning, winEnemyDamageToPlayer), false },
+};
+
+#define TUNING_PARAMETER_COUNT ((int)(sizeof(gTuningParameters) / sizeof(gTuningParameters[0])))
+
+/**
+ * @brief Find a tuning parameter by its config name
+ *
+ * @param name Config name
+ * @return const GameTuningParameter* Parameter, or NULL if unknown
+ */
+static const GameTuningParameter* GameTuningFind(const char* name) {
+    if (!name) return NULL;
+
+    for (int i = 0; i < TUNING_PARAMETER_COUNT; i++) {
+        if (strcmp(gTuningParameters[i].name, name) == 0) {
+            return &gTuningParameters[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Fill tuning with the config values
+ *
+ * @param tuning Pointer to tuning
+ */
+void GameTuningDefaults(GameTuning* tuning) {
+    if (!tuning) return;
+
+    tuning->ballFriction = BALL_FRICTION;
+    tuning->ballCount = BALL_COUNT;
+    tuning->playerKickForce = PLAYER_BASE_KICK_FORCE;
+    tuning->playerXpPerHit = PLAYER_XP_PER_HIT;
+    tuning->snakeIntervalDecrease = SNAKE_INTERVAL_DECREASE;
+    tuning->winSegmentsPerGoal = WIN_PLAYER_SEGMENTS_SNAKEBOSS;
+    tuning->winEnemyDamageToPlayer = WIN_ENEMY_DAMAGE_TO_PLAYER;
+}
+
+/**
+ * @brief Set a tuning parameter by its config name
+ *
+ * @param tuning Pointer to tuning
+ * @param name Config name of the parameter, e.g. "BALL_FRICTION"
+ * @param value New value (rounded for integer parameters)
+ * @return bool Whether the name is a tuning parameter
+ */
+bool GameTuningSet(GameTuning* tuning, const char* name, float value) {
+    const GameTuningParameter* parameter = GameTuningFind(name);
+    if (!tuning || !parameter) return false;
+
+    char* field = (char*)tuning + parameter->offset;
+    if (parameter->isInteger) {
+        *(int*)field = (int)lroundf(value);
+    }
+    else {
+        *(float*)field = value;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check whether a name is a tuning parameter
+ *
+ * @param name Config name of the parameter
+ * @return bool Whether the name is a tuning parameter
+ */
+bool GameTuningHasParameter(const char* name) {
+    return GameTuningFind(name) != NULL;
+}
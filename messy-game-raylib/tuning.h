@@ -0,0 +1,53 @@
+/**
+ * @file tuning.h
+ * @brief Per-game balancing parameters
+ *
+ * This file defines the gameplay numbers a match is played with. They
+ * start at their config values and are copied into the ball, players,
+ * snake bosses and win condition as those are created, so games with
+ * different tuning can run side by side, such as in a parameter sweep.
+ */
+#ifndef MESSY_GAME_TUNING_H
+#define MESSY_GAME_TUNING_H
+
+#include <stdbool.h>
+
+/**
+ * @brief Game tuning structure
+ */
+typedef struct {
+    float ballFriction;            // BALL_FRICTION
+    int ballCount;                 // BALL_COUNT
+    float playerKickForce;         // PLAYER_BASE_KICK_FORCE
+    float playerXpPerHit;          // PLAYER_XP_PER_HIT
+    float snakeIntervalDecrease;   // SNAKE_INTERVAL_DECREASE
+    int winSegmentsPerGoal;        // WIN_PLAYER_SEGMENTS_SNAKEBOSS
+    float winEnemyDamageToPlayer;  // WIN_ENEMY_DAMAGE_TO_PLAYER
+} GameTuning;
+
+/**
+ * @brief Fill tuning with the config values
+ *
+ * @param tuning Pointer to tuning
+ */
+void GameTuningDefaults(GameTuning* tuning);
+
+/**
+ * @brief Set a tuning parameter by its config name
+ *
+ * @param tuning Pointer to tuning
+ * @param name Config name of the parameter, e.g. "BALL_FRICTION"
+ * @param value New value (rounded for integer parameters)
+ * @return bool Whether the name is a tuning parameter
+ */
+bool GameTuningSet(GameTuning* tuning, const char* name, float value);
+
+/**
+ * @brief Check whether a name is a tuning parameter
+ *
+ * @param name Config name of the parameter
+ * @return bool Whether the name is a tuning parameter
+ */
+bool GameTuningHasParameter(const char* name);
+
+#endif // MESSY_GAME_TUNING_H
@@ -10,6 +10,54 @@
 #include "ball.h"
 #include "player.h"
 #include "snake_boss.h"
+#include "fixed.h"
+
+#define WIN_CONDITION_SINE_STEPS 360 // Entries in gWinConditionSine (one per degree)
+
+/**
+ * @brief Sine of each whole degree in Q16.16
+ *
+ * Ejection angles are whole degrees from the simulation RNG, so a table
+ * gives the same direction on every platform where libm sinf/cosf may not.
+ */
+static const Fixed gWinConditionSine[WIN_CONDITION_SINE_STEPS] = {
+    0, 1144, 2287, 3430, 4572, 5712, 6850, 7987, 9121, 10252,
+    11380, 12505, 13626, 14742, 15855, 16962, 18064, 19161, 20252, 21336,
+    22415, 23486, 24550, 25607, 26656, 27697, 28729, 29753, 30767, 31772,
+    32768, 33754, 34729, 35693, 36647, 37590, 38521, 39441, 40348, 41243,
+    42126, 42995, 43852, 44695, 45525, 46341, 47143, 47930, 48703, 49461,
+    50203, 50931, 51643, 52339, 53020, 53684, 54332, 54963, 55578, 56175,
+    56756, 57319, 57865, 58393, 58903, 59396, 59870, 60326, 60764, 61183,
+    61584, 61966, 62328, 62672, 62997, 63303, 63589, 63856, 64104, 64332,
+    64540, 64729, 64898, 65048, 65177, 65287, 65376, 65446, 65496, 65526,
+    65536, 65526, 65496, 65446, 65376, 65287, 65177, 65048, 64898, 64729,
+    64540, 64332, 64104, 63856, 63589, 63303, 62997, 62672, 62328, 61966,
+    61584, 61183, 60764, 60326, 59870, 59396, 58903, 58393, 57865, 57319,
+    56756, 56175, 55578, 54963, 54332, 53684, 53020, 52339, 51643, 50931,
+    50203, 49461, 48703, 47930, 47143, 46341, 45525, 44695, 43852, 42995,
+    42126, 41243, 40348, 39441, 38521, 37590, 36647, 35693, 34729, 33754,
+    32768, 31772, 30767, 29753, 28729, 27697, 26656, 25607, 24550, 23486,
+    22415, 21336, 20252, 19161, 18064, 16962, 15855, 14742, 13626, 12505,
+    11380, 10252, 9121, 7987, 6850, 5712, 4572, 3430, 2287, 1144,
+    0, -1144, -2287, -3430, -4572, -5712, -6850, -7987, -9121, -10252,
+    -11380, -12505, -13626, -14742, -15855, -16962, -18064, -19161, -20252, -21336,
+    -22415, -23486, -24550, -25607, -26656, -27697, -28729, -29753, -30767, -31772,
+    -32768, -33754, -34729, -35693, -36647, -37590, -38521, -39441, -40348, -41243,
+    -42126, -42995, -43852, -44695, -45525, -46341, -47143, -47930, -48703, -49461,
+    -50203, -50931, -51643, -52339, -53020, -53684, -54332, -54963, -55578, -56175,
+    -56756, -57319, -57865, -58393, -58903, -59396, -59870, -60326, -60764, -61183,
+    -61584, -61966, -62328, -62672, -62997, -63303, -63589, -63856, -64104, -64332,
+    -64540, -64729, -64898, -65048, -65177, -65287, -65376, -65446, -65496, -65526,
+    -65536, -65526, -65496, -65446, -65376, -65287, -65177, -65048, -64898, -64729,
+    -64540, -64332, -64104, -63856, -63589, -63303, -62997, -62672, -62328, -61966,
+    -61584, -61183, -60764, -60326, -59870, -59396, -58903, -58393, -57865, -57319,
+    -56756, -56175, -55578, -54963, -54332, -53684, -53020, -52339, -51643, -50931,
+    -50203, -49461, -48703, -47930, -47143, -46341, -45525, -44695, -43852, -42995,
+    -42126, -41243, -40348, -39441, -38521, -37590, -36647, -35693, -34729, -33754,
+    -32768, -31772, -30767, -29753, -28729, -27697, -26656, -25607, -24550, -23486,
+    -22415, -21336, -20252, -19161, -18064, -16962, -15855, -14742, -13626, -12505,
+    -11380, -10252, -9121, -7987, -6850, -5712, -4572, -3430, -2287, -1144,
+};
 
  /**
   * @brief Create a new win condition
@@ -32,10 +80,14 @@ WinCondition* WinConditionCreate(float x, float y, float radius) {
     winCondition->position = (Vector2){ x, y };
     winCondition->radius = radius;
     winCondition->state = WIN_STATE_IDLE;
+    winCondition->heldBallSlot = -1;
     winCondition->stateTimer = 0.0f;
     winCondition->flashTextActive = false;
     winCondition->flashTextTimer = 0.0f;
     winCondition->flashTextAlpha = 0.0f;
+    winCondition->segmentsPerGoal = WIN_PLAYER_SEGMENTS_SNAKEBOSS;
+    winCondition->enemyDamageToPlayer = WIN_ENEMY_DAMAGE_TO_PLAYER;
+    WinConditionSeed(winCondition, GAME_DEFAULT_SEED);
 
     // Allocate memory for particles
     winCondition->particleCount = WIN_THUNDER_PARTICLE_COUNT;
@@ -59,6 +111,21 @@ WinCondition* WinConditionCreate(float x, float y, float radius) {
     return winCondition;
 }
 
+/**
+ * @brief Seed the win condition's random generator
+ *
+ * Ejection angles and thunder particles are drawn from this generator,
+ * so the same seed always reproduces the same sequence.
+ *
+ * @param winCondition Pointer to win condition
+ * @param seed Game seed
+ */
+void WinConditionSeed(WinCondition* winCondition, uint64_t seed) {
+    if (!winCondition) return;
+
+    RngSeed(&winCondition->rng, seed, RNG_STREAM_WIN_CONDITION);
+}
+
 /**
  * @brief Destroy win condition and free resources
  *
@@ -224,18 +291,18 @@ void WinConditionTriggerThunder(
 
         // Calculate position along the line with some randomness
         float progress = (float)i / (float)winCondition->particleCount;
-        float randomOffsetX = (float)GetRandomValue(-10, 10);
-        float randomOffsetY = (float)GetRandomValue(-10, 10);
+        float randomOffsetX = (float)RngRange(&winCondition->rng, -10, 10);
+        float randomOffsetY = (float)RngRange(&winCondition->rng, -10, 10);
 
         particle->position.x = originX + dx * (distance * progress) + randomOffsetX;
         particle->position.y = originY + dy * (distance * progress) + randomOffsetY;
 
         // Set random velocity with bias toward target
-        particle->velocity.x = dx * WIN_THUNDER_PARTICLE_SPEED + (float)GetRandomValue(-20, 20) / 10.0f;
-        particle->velocity.y = dy * WIN_THUNDER_PARTICLE_SPEED + (float)GetRandomValue(-20, 20) / 10.0f;
+        particle->velocity.x = dx * WIN_THUNDER_PARTICLE_SPEED + (float)RngRange(&winCondition->rng, -20, 20) / 10.0f;
+        particle->velocity.y = dy * WIN_THUNDER_PARTICLE_SPEED + (float)RngRange(&winCondition->rng, -20, 20) / 10.0f;
 
         // Set size and alpha
-        particle->size = WIN_THUNDER_PARTICLE_SIZE * (1.0f - (float)GetRandomValue(0, 5) / 10.0f);
+        particle->size = WIN_THUNDER_PARTICLE_SIZE * (1.0f - (float)RngRange(&winCondition->rng, 0, 5) / 10.0f);
         particle->alpha = 1.0f;
         particle->active = true;
     }
@@ -278,13 +345,13 @@ bool WinConditionCheckBallInHole(WinCondition* winCondition, Entity* ball) {
     if (!ballData) return false;
 
     // Calculate distance between ball and hole
-    float dx = ball->x - winCondition->position.x;
-    float dy = ball->y - winCondition->position.y;
-    float distance = sqrtf(dx * dx + dy * dy);
+    SimReal dx = SimRealFromFloat(ball->x) - SimRealFromFloat(winCondition->position.x);
+    SimReal dy = SimRealFromFloat(ball->y) - SimRealFromFloat(winCondition->position.y);
+    SimReal distance = SimRealLength(dx, dy);
 
     // Ball is in hole if its center is within the hole radius
     // We subtract a small buffer from the ball radius to make sure it's visibly inside
-    return distance < winCondition->radius - (ballData->radius * 0.8f);
+    return distance < SimRealFromFloat(winCondition->radius) - SimRealMul(SimRealFromFloat(ballData->radius), SimRealFromFloat(0.8f));
 }
 
 /**
@@ -327,7 +394,7 @@ void WinConditionHandlePlayerScore(
             SnakeBossData* bossData = SnakeBossGetData(entities[i]);
             if (bossData && bossData->state != SNAKE_STATE_DEFEATED) {
                 // Make the snake shrink multiple segments
-                int shrinksToApply = WIN_PLAYER_SEGMENTS_SNAKEBOSS; // Number of segments to shrink
+                int shrinksToApply = winCondition->segmentsPerGoal; // Number of segments to shrink
                 for (int j = 0; j < shrinksToApply; j++) {
                     if (!SnakeBossShrink(entities[i])) {
                         // Snake is defeated
@@ -375,23 +442,27 @@ void WinConditionHandlePlayerScore(
  *
  * @param winCondition Pointer to win condition
  * @param ball Pointer to ball entity
- * @param player Pointer to player entity
+ * @param players Players to damage (players that are down are skipped)
+ * @param playerCount Number of players
  */
 void WinConditionHandleEnemyScore(
     WinCondition* winCondition,
     Entity* ball,
-    Entity* player
+    Entity** players,
+    int playerCount
 ) {
-    if (!winCondition || !ball || !player) return;
+    if (!winCondition || !ball || !players) return;
 
     // Trigger visual effects
     WinConditionTriggerFlashText(winCondition);
 
-    // Apply damage to player
-    PlayerData* playerData = PlayerGetData(player);
-    if (playerData) {
+    for (int i = 0; i < playerCount; i++) {
+        Entity* player = players[i];
+        if (!PlayerIsAlive(player)) continue;
+
         // Apply damage to player
-        playerData->currentHealth -= WIN_ENEMY_DAMAGE_TO_PLAYER;
+        PlayerData* playerData = PlayerGetData(player);
+        playerData->currentHealth -= winCondition->enemyDamageToPlayer;
         if (playerData->currentHealth < 0) {
             playerData->currentHealth = 0;
         }
@@ -405,8 +476,8 @@ void WinConditionHandleEnemyScore(
             player->y
         );
 
-        TraceLog(LOG_INFO, "Enemy scored! Player health reduced to %.1f",
-            playerData->currentHealth);
+        TraceLog(LOG_INFO, "Enemy scored! Player %d health reduced to %.1f",
+            i, playerData->currentHealth);
     }
 }
 
@@ -469,18 +540,47 @@ void WinConditionEjectBall(WinCondition* winCondition, Entity* ball) {
     ballData->innerColor = WHITE;
     ballData->outerColor = WHITE;
 
-    // Calculate random ejection angle
-    float angle = (float)GetRandomValue(0, 359) * DEG2RAD;
-    float speed = BALL_INITIAL_SPEED * 1.5f; // Slightly faster than normal
+    // Calculate random ejection angle (cosine is the sine a quarter turn on)
+    int degrees = RngRange(&winCondition->rng, 0, WIN_CONDITION_SINE_STEPS - 1);
+    SimReal sine = SimRealFromFixed(gWinConditionSine[degrees]);
+    SimReal cosine = SimRealFromFixed(gWinConditionSine[(degrees + 90) % WIN_CONDITION_SINE_STEPS]);
+    SimReal speed = SimRealFromFloat(BALL_INITIAL_SPEED * 1.5f); // Slightly faster than normal
 
     // Apply force in random direction
-    BallApplyForce(ball, cosf(angle) * speed, sinf(angle) * speed);
+    BallApplyForce(ball, SimRealToFloat(SimRealMul(cosine, speed)), SimRealToFloat(SimRealMul(sine, speed)));
 
     // Move ball slightly outside hole to prevent immediate recapture
-    ball->x = winCondition->position.x + cosf(angle) * (winCondition->radius + ballData->radius);
-    ball->y = winCondition->position.y + sinf(angle) * (winCondition->radius + ballData->radius);
+    SimReal distance = SimRealFromFloat(winCondition->radius + ballData->radius);
+    ball->x = SimRealToFloat(SimRealFromFloat(winCondition->position.x) + SimRealMul(cosine, distance));
+    ball->y = SimRealToFloat(SimRealFromFloat(winCondition->position.y) + SimRealMul(sine, distance));
 
-    TraceLog(LOG_INFO, "Ball ejected from hole at angle %.1f degrees", angle * RAD2DEG);
+    TraceLog(LOG_INFO, "Ball ejected from hole at angle %d degrees", degrees);
+}
+
+/**
+ * @brief Find a ball that has fallen into the hole
+ *
+ * @param winCondition Pointer to win condition
+ * @param balls Pointer to ball pool
+ * @return Entity* Pointer to the ball, or NULL if none is in the hole
+ */
+static Entity* WinConditionFindBallInHole(WinCondition* winCondition, BallPool* balls) {
+    Entity* nearby[BALL_POOL_CAPACITY];
+    int count = BallPoolQuery(
+        balls,
+        winCondition->position.x - winCondition->radius,
+        winCondition->position.y - winCondition->radius,
+        winCondition->position.x + winCondition->radius,
+        winCondition->position.y + winCondition->radius,
+        nearby,
+        BALL_POOL_CAPACITY
+    );
+
+    for (int i = 0; i < count; i++) {
+        if (WinConditionCheckBallInHole(winCondition, nearby[i])) return nearby[i];
+    }
+
+    return NULL;
 }
 
 /**
@@ -489,21 +589,30 @@ void WinConditionEjectBall(WinCondition* winCondition, Entity* ball) {
  * Main update function for the win condition system.
  *
  * @param winCondition Pointer to win condition
- * @param ball Pointer to ball entity
- * @param player Pointer to player entity
+ * @param balls Pointer to ball pool (grid built for this step)
+ * @param players Players an enemy goal can damage
+ * @param playerCount Number of players
  * @param entities Array of all entities
  * @param entityCount Number of entities
  * @param deltaTime Time elapsed since last update
  */
 void WinConditionUpdate(
     WinCondition* winCondition,
-    Entity* ball,
-    Entity* player,
+    BallPool* balls,
+    Entity** players,
+    int playerCount,
     Entity** entities,
     int entityCount,
     float deltaTime
 ) {
-    if (!winCondition || !ball || !player) return;
+    if (!winCondition || !balls || !players) return;
+
+    // The held ball, if it is still in play
+    Entity* ball = BallPoolGetBall(balls, winCondition->heldBallSlot);
+    if (!ball && winCondition->state != WIN_STATE_IDLE) {
+        winCondition->state = WIN_STATE_IDLE;
+        winCondition->heldBallSlot = -1;
+    }
 
     // Update thunder particles
     WinConditionUpdateThunder(winCondition, deltaTime);
@@ -514,11 +623,14 @@ void WinConditionUpdate(
     // Handle state-specific updates
     switch (winCondition->state) {
     case WIN_STATE_IDLE:
-        // Check if ball has fallen into hole
-        if (WinConditionCheckBallInHole(winCondition, ball)) {
+        // Check if a ball has fallen into hole
+        ball = WinConditionFindBallInHole(winCondition, balls);
+        if (ball) {
             BallData* ballData = BallGetData(ball);
             if (!ballData) break;
 
+            winCondition->heldBallSlot = BallPoolGetSlot(balls, ball);
+
             // Determine action based on ball state
             if (ballData->state == BALL_STATE_PLAYER) {
                 // Player scored
@@ -528,7 +640,7 @@ void WinConditionUpdate(
             else if (ballData->state == BALL_STATE_SNAKE) {
                 // Enemy scored
                 winCondition->state = WIN_STATE_ENEMY_SCORED;
-                WinConditionHandleEnemyScore(winCondition, ball, player);
+                WinConditionHandleEnemyScore(winCondition, ball, players, playerCount);
             }
             else {
                 // Neutral ball
@@ -558,6 +670,7 @@ void WinConditionUpdate(
         if (WinConditionHandleNeutralBall(winCondition, ball, deltaTime)) {
             WinConditionEjectBall(winCondition, ball);
             winCondition->state = WIN_STATE_IDLE;
+            winCondition->heldBallSlot = -1;
         }
         break;
     }
@@ -3,7 +3,8 @@
  * @brief Win condition definitions and functions
  *
  * This file defines structures and functions for the win condition system,
- * which includes a hole that the ball can fall into to trigger various effects.
+ * which includes a hole that the balls can fall into to trigger various effects.
+ * The hole holds one ball at a time.
  */
 
 #ifndef MESSY_GAME_WIN_CONDITION_H
@@ -13,6 +14,7 @@
 #include "entity.h"
 #include "ball.h"
 #include "world.h"
+#include "rng.h"
 
  /**
   * @brief Win condition state enumeration
@@ -48,12 +50,16 @@ typedef struct {
     Vector2 position;               // Position of hole
     float radius;                   // Radius of hole
     WinConditionState state;        // Current state
+    int heldBallSlot;               // Ball pool slot of the ball in the hole (-1 when empty)
     float stateTimer;               // Timer for state transitions
     ThunderParticle* particles;     // Array of thunder particles
     int particleCount;              // Number of particles
     bool flashTextActive;           // Whether flash text is active
     float flashTextTimer;           // Timer for flash text
     float flashTextAlpha;           // Alpha for flash text
+    Rng rng;                        // Random generator for ejection and effects
+    int segmentsPerGoal;            // Segments shrunk from each snake boss per player goal
+    float enemyDamageToPlayer;      // Damage to the player per enemy goal
 } WinCondition;
 
 /**
@@ -66,6 +72,14 @@ typedef struct {
  */
 WinCondition* WinConditionCreate(float x, float y, float radius);
 
+/**
+ * @brief Seed the win condition's random generator
+ *
+ * @param winCondition Pointer to win condition
+ * @param seed Game seed
+ */
+void WinConditionSeed(WinCondition* winCondition, uint64_t seed);
+
 /**
  * @brief Destroy win condition and free resources
  *
@@ -76,17 +90,22 @@ void WinConditionDestroy(WinCondition* winCondition);
 /**
  * @brief Update win condition state
  *
+ * While the hole is empty, the balls the pool's grid finds near it are
+ * checked; the first one in the hole is captured.
+ *
  * @param winCondition Pointer to win condition
- * @param ball Pointer to ball entity
- * @param player Pointer to player entity
+ * @param balls Pointer to ball pool (grid built for this step)
+ * @param players Players an enemy goal can damage
+ * @param playerCount Number of players
  * @param entities Array of all entities
  * @param entityCount Number of entities
  * @param deltaTime Time elapsed since last update
  */
 void WinConditionUpdate(
     WinCondition* winCondition,
-    Entity* ball,
-    Entity* player,
+    BallPool* balls,
+    Entity** players,
+    int playerCount,
     Entity** entities,
     int entityCount,
     float deltaTime
@@ -129,12 +148,14 @@ void WinConditionHandlePlayerScore(
  *
  * @param winCondition Pointer to win condition
  * @param ball Pointer to ball entity
- * @param player Pointer to player entity
+ * @param players Players to damage (players that are down are skipped)
+ * @param playerCount Number of players
  */
 void WinConditionHandleEnemyScore(
     WinCondition* winCondition,
     Entity* ball,
-    Entity* player
+    Entity** players,
+    int playerCount
 );
 
 /**
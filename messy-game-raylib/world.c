@@ -1,17 +1,110 @@
 #include "world.h"
 #include "config.h"
 #include "game.h"
+#include "level.h"
+#include "fixed.h"
+#include "platform.h"
 #include <stdlib.h>
+#include <string.h>
 
-World* WorldCreate(int width, int height) {
+/**
+ * @brief Side of a room a door can be on
+ */
+typedef struct {
+    ConnectionDirection direction; // Connection through the door
+    int stepX;                 // X tile step going out through the door
+    int stepY;                 // Y tile step going out through the door
+} WorldDoorSide;
+
+#define WORLD_DOOR_SIDE_COUNT 4 // Sides in gWorldDoorSides (opposite sides are two apart)
+
+/**
+ * @brief Door sides in clockwise order
+ */
+static const WorldDoorSide gWorldDoorSides[WORLD_DOOR_SIDE_COUNT] = {
+    { CONNECTION_NORTH, 0, -1 },
+    { CONNECTION_EAST, 1, 0 },
+    { CONNECTION_SOUTH, 0, 1 },
+    { CONNECTION_WEST, -1, 0 },
+};
+
+// Function prototypes for helper functions
+static void WorldUpdateActiveRooms(World* world);
+
+/**
+ * @brief Add a one-way door from a room to another
+ *
+ * Doors are walked through on the world grid, so the door tile goes
+ * there as well as into the room.
+ *
+ * @param world Pointer to world
+ * @param room Room the door is in
+ * @param direction Side of the room the door is on
+ * @param connectedRoom Room the door leads to
+ * @return true Door added
+ * @return false Invalid direction
+ */
+static bool WorldAddDoor(World* world, Room* room, ConnectionDirection direction, Room* connectedRoom) {
+    if (!RoomAddConnection(room, direction, connectedRoom)) return false;
+
+    int doorX = 0, doorY = 0;
+    RoomGetDoorPosition(room, direction, &doorX, &doorY);
+    WorldSetTileType(world, room->x + doorX, room->y + doorY, TILE_TYPE_DOOR);
+
+    // The rooms to simulate may have changed
+    world->activeRoomsFor = -1;
+    return true;
+}
+
+/**
+ * @brief Allocate a world with no tiles or rooms
+ *
+ * @param width World width in tiles
+ * @param height World height in tiles
+ * @return World* Pointer to the allocated world or NULL if failed
+ */
+static World* WorldAllocate(int width, int height) {
     World* world = (World*)malloc(sizeof(World));
     if (!world) {
         TraceLog(LOG_ERROR, "Failed to create world");
         return NULL;
     }
 
+    world->tiles = NULL;
     world->width = width;
     world->height = height;
+    world->rooms = NULL;
+    world->roomCount = 0;
+    world->roomCapacity = 0;
+    world->currentRoom = 0;
+    world->activeRoomCount = 0;
+    world->activeRoomsFor = -1;
+    world->isOpenWorld = false;
+    world->spawns = NULL;
+    world->spawnCount = 0;
+    world->spawnCapacity = 0;
+    world->holePosition = (Vector2){ 0.0f, 0.0f };
+    world->holeRadius = 0.0f;
+    world->goalArea = (Rectangle){ 0 };
+    world->chunks = NULL;
+    world->roomStreamer = NULL;
+    world->dirtyRegionCount = 0;
+    world->effectTimer = 0.0f;
+
+    return world;
+}
+
+World* WorldCreate(int width, int height) {
+    World* world = WorldAllocate(width, height);
+    if (!world) return NULL;
+
+    // Allocate the tile grid (all TILE_TYPE_EMPTY)
+    world->tiles = (unsigned char*)calloc((size_t)width * (size_t)height, 1);
+    if (!world->tiles) {
+        TraceLog(LOG_ERROR, "Failed to allocate world tiles");
+        free(world);
+        return NULL;
+    }
 
     // Create a default room that fills most of the world
     int roomWidth = width * 2 / 3;
@@ -19,33 +112,142 @@ World* WorldCreate(int width, int height) {
     int roomX = (width - roomWidth) / 2;
     int roomY = (height - roomHeight) / 2;
 
-    // Allocate room array
-    world->roomCount = 1;
-    world->rooms = (Room**)malloc(sizeof(Room*) * world->roomCount);
-    if (!world->rooms) {
-        free(world);
+    Room* room = RoomCreate(1, ROOM_TYPE_NORMAL, roomX, roomY, roomWidth, roomHeight);
+    if (!room || WorldAddRoom(world, room) < 0) {
+        RoomDestroy(room);
+        WorldDestroy(world);
+        return NULL;
+    }
+
+    world->currentRoom = 0;
+
+    return world;
+}
+
+/**
+ * @brief Create a streamed open world
+ *
+ * The world has no rooms; its tiles come from a chunk map that loads,
+ * generates and saves chunks on a background thread. The chunks around
+ * the world center are loaded before returning so the player can spawn
+ * there.
+ *
+ * @param widthInChunks World width in chunks
+ * @param heightInChunks World height in chunks
+ * @param chunkDirectory Directory holding saved chunk files
+ * @param seed Seed for generating chunks with no file
+ * @return World* Pointer to the created world or NULL if failed
+ */
+World* WorldCreateOpen(int widthInChunks, int heightInChunks, const char* chunkDirectory, uint64_t seed) {
+    World* world = WorldAllocate(widthInChunks * CHUNK_SIZE, heightInChunks * CHUNK_SIZE);
+    if (!world) return NULL;
+
+    world->isOpenWorld = true;
+    world->chunks = ChunkMapCreate(widthInChunks, heightInChunks, chunkDirectory, seed);
+    if (!world->chunks) {
+        WorldDestroy(world);
         return NULL;
     }
 
-    // Create the room
-    world->rooms[0] = RoomCreate(1, ROOM_TYPE_NORMAL, roomX, roomY, roomWidth, roomHeight);
-    if (!world->rooms[0]) {
-        free(world->rooms);
+    // Have the spawn area ready for the first frame
+    ChunkMapPrefetch(world->chunks, world->width / 2, world->height / 2);
+
+    TraceLog(LOG_INFO, "Created open world %dx%d tiles", world->width, world->height);
+
+    return world;
+}
+
+/**
+ * @brief Create a room world from a generated dungeon layout
+ *
+ * Rooms get the layout of their type, which is copied into the world
+ * grid; the space between rooms is left empty, as it cannot be reached.
+ * The player and ball spawn in the start room, and the snake boss and
+ * the hole wait in the boss room.
+ *
+ * @param layout Pointer to generated layout
+ * @return World* Pointer to the created world or NULL if failed
+ */
+World* WorldCreateDungeon(const DungeonLayout* layout) {
+    if (!layout || layout->roomCount <= 0) return NULL;
+
+    World* world = WorldAllocate(layout->width, layout->height);
+    if (!world) return NULL;
+
+    world->tiles = (unsigned char*)calloc((size_t)world->width * (size_t)world->height, 1);
+    if (!world->tiles) {
+        TraceLog(LOG_ERROR, "Failed to allocate world tiles");
         free(world);
         return NULL;
     }
 
-    world->currentRoom = 0;
+    // Build every room (RoomCreate draws its type's layout) before any doors
+    for (int i = 0; i < layout->roomCount; i++) {
+        const DungeonRoom* desc = &layout->rooms[i];
 
-    // Initialize other world properties
-    world->isOpenWorld = false;
+        Room* room = RoomCreate(i + 1, desc->type, desc->x, desc->y, desc->width, desc->height);
+        if (!room || WorldAddRoom(world, room) < 0) {
+            RoomDestroy(room);
+            WorldDestroy(world);
+            return NULL;
+        }
+
+        for (int x = 0; x < room->width; x++) {
+            for (int y = 0; y < room->height; y++) {
+                WorldSetTileType(world, room->x + x, room->y + y, room->tiles[x][y].type);
+            }
+        }
+    }
+
+    for (int i = 0; i < layout->connectionCount; i++) {
+        const DungeonConnection* connection = &layout->connections[i];
+        WorldConnectRooms(world, connection->fromRoom, connection->direction, connection->toRoom);
+    }
+
+    // Spawn below the start room's center wall
+    const DungeonRoom* start = &layout->rooms[layout->startRoom];
+    int spawnX = start->x + start->width / 2;
+    int spawnY = start->y + start->height / 2 + 2;
+    WorldAddSpawn(world, SPAWN_TYPE_PLAYER, spawnX, spawnY, 0);
+    WorldAddSpawn(world, SPAWN_TYPE_BALL, spawnX + 2, spawnY, 0);
+
+    if (layout->bossRoom >= 0) {
+        const DungeonRoom* boss = &layout->rooms[layout->bossRoom];
+        WorldAddSpawn(world, SPAWN_TYPE_SNAKE_BOSS, boss->x + 2, boss->y + 2, 3);
+        world->holePosition = (Vector2){
+            (boss->x + boss->width / 2 + 0.5f) * TILE_WIDTH,
+            (boss->y + boss->height / 2 + 0.5f) * TILE_HEIGHT
+        };
+        world->holeRadius = WIN_HOLE_RADIUS;
+    }
+
+    world->currentRoom = layout->startRoom;
+    world->rooms[world->currentRoom]->isDiscovered = true;
+
+    TraceLog(LOG_INFO, "Created dungeon %dx%d tiles with %d rooms from seed %llu",
+        world->width, world->height, world->roomCount, (unsigned long long)layout->seed);
 
     return world;
 }
 
 void WorldDestroy(World* world) {
     if (!world) return;
-    // Clean up resources
+
+    // Stop streaming and save edited chunks
+    ChunkMapDestroy(world->chunks);
+
+    // Finish room loads before their rooms and grid go away
+    RoomStreamerDestroy(world->roomStreamer);
+
+    // Free rooms
+    for (int i = 0; i < world->roomCount; i++) {
+        RoomDestroy(world->rooms[i]);
+    }
+    free(world->rooms);
+
+    free(world->tiles);
+
+    free(world->spawns);
     free(world);
 }
 
@@ -61,11 +263,15 @@ void WorldDestroy(World* world) {
 void WorldUpdate(World* world, float deltaTime) {
     if (!world) return;
 
-    // Update room state if we're using rooms
-    if (world->rooms && world->currentRoom >= 0 && world->currentRoom < world->roomCount) {
-        Room* currentRoom = world->rooms[world->currentRoom];
-        if (currentRoom) {
-            RoomUpdate(currentRoom, deltaTime);
+    // Pick up rooms loaded in the background, and tiles edited since the last update
+    RoomStreamerCollect(world->roomStreamer);
+    WorldFlushTileEdits(world);
+
+    // Update the current room and its neighbours; the rest sleep
+    if (world->rooms) {
+        WorldUpdateActiveRooms(world);
+        for (int i = 0; i < world->activeRoomCount; i++) {
+            RoomUpdate(world->rooms[world->activeRooms[i]], deltaTime);
         }
     }
 
@@ -73,15 +279,27 @@ void WorldUpdate(World* world, float deltaTime) {
     // This would be implemented as the game evolves with more features
 
     // Update environmental effects (water animations, torch flickers, etc.)
-    static float effectTimer = 0.0f;
-    effectTimer += deltaTime;
+    world->effectTimer += deltaTime;
 
     // Reset timer if it gets too large to prevent float precision issues
-    if (effectTimer > 1000.0f) {
-        effectTimer = 0.0f;
+    if (world->effectTimer > 1000.0f) {
+        world->effectTimer = 0.0f;
     }
 }
 
+/**
+ * @brief Stream open world chunks around a position
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ */
+void WorldStreamAround(World* world, float x, float y) {
+    if (!world || !world->chunks) return;
+
+    ChunkMapUpdate(world->chunks, (int)(x / TILE_WIDTH), (int)(y / TILE_HEIGHT));
+}
+
 /**
 * @brief Render the world
 *
@@ -89,18 +307,17 @@ void WorldUpdate(World* world, float deltaTime) {
 * Only tiles that are visible on screen are rendered for efficiency.
 *
 * @param world Pointer to world
+* @param renderer Renderer to draw with
+* @param camera Pointer to camera used to cull tiles
 */
-void WorldRender(World* world) {
-    if (!world) return;
+void WorldRender(World* world, Renderer* renderer, Camera2D* camera) {
+    if (!world || !camera) return;
 
     // If we have a current room, render it
     if (world->rooms && world->currentRoom >= 0 && world->currentRoom < world->roomCount) {
         Room* currentRoom = world->rooms[world->currentRoom];
         if (currentRoom) {
-            // Get the current camera (would normally be passed as parameter)
-            Camera2D camera = { 0 };
-            camera.zoom = CAMERA_ZOOM;
-            RoomRender(currentRoom, &camera);
+            RoomRender(currentRoom, renderer, camera);
 
             // Add collision debug visualization for rooms
             if (DEBUG_SHOW_COLLISIONS) {
@@ -121,26 +338,32 @@ void WorldRender(World* world) {
         }
     }
 
-    // If there's no room, render a simple grid with floor tiles
-    for (int x = 0; x < world->width; x++) {
-        for (int y = 0; y < world->height; y++) {
-            // Draw floor tile
+    // If there's no room, render the visible part of the world tile grid
+    int startX, startY, endX, endY;
+    WorldGetVisibleArea(world, camera, &startX, &startY, &endX, &endY);
+
+    for (int x = startX; x <= endX; x++) {
+        for (int y = startY; y <= endY; y++) {
+            bool isWall = WorldGetTileType(world, x, y) == TILE_TYPE_WALL;
+
+            // Draw wall or floor tile
             DrawRectangle(
                 x * TILE_WIDTH,
                 y * TILE_HEIGHT,
                 TILE_WIDTH,
                 TILE_HEIGHT,
-                TILE_FLOOR_COLOR
+                isWall ? TILE_WALL_COLOR : TILE_FLOOR_COLOR
             );
 
             // Only draw border if it's not transparent
-            if (TILE_FLOOR_BORDER_COLOR.a > 0) {
+            Color borderColor = isWall ? TILE_WALL_BORDER_COLOR : TILE_FLOOR_BORDER_COLOR;
+            if (borderColor.a > 0) {
                 DrawRectangleLines(
                     x * TILE_WIDTH,
                     y * TILE_HEIGHT,
                     TILE_WIDTH,
                     TILE_HEIGHT,
-                    TILE_FLOOR_BORDER_COLOR
+                    borderColor
                 );
             }
 
@@ -160,8 +383,8 @@ void WorldRender(World* world) {
         }
     }
 
-    // Visible area debug visualization
-    if (DEBUG_SHOW_COLLISIONS) {
+    // Visible area debug visualization (fixed arena only)
+    if (DEBUG_SHOW_COLLISIONS && !world->chunks) {
         float cameraZoom = CAMERA_ZOOM;
         int screenWidthInTiles = (int)(SCREEN_WIDTH / (TILE_WIDTH * cameraZoom));
         int screenHeightInTiles = (int)(SCREEN_HEIGHT / (TILE_HEIGHT * cameraZoom));
@@ -189,7 +412,7 @@ void WorldRender(World* world) {
 * @brief Check if a position has a wall or is outside world boundaries
 *
 * This function converts world coordinates to tile coordinates and
-* checks if the tile at that position is a wall or if the position is beyond
+* checks if the tile at that position is solid or if the position is beyond
 * the world boundaries.
 *
 * @param world Pointer to world
@@ -210,49 +433,97 @@ bool WorldIsWallAtPosition(World* world, float x, float y) {
         return true; // Out of bounds is considered a wall
     }
 
-    // Calculate dimensions using 25x25 tiles
-    float cameraZoom = CAMERA_ZOOM;
-    int screenWidthInTiles = (int)(SCREEN_WIDTH / (TILE_WIDTH * cameraZoom));
-    int screenHeightInTiles = (int)(SCREEN_HEIGHT / (TILE_HEIGHT * cameraZoom));
-
-    // Calculate visible area - FIX TOP AND RIGHT COLLISIONS
-    int centerX = world->width / 2;
-    int centerY = world->height / 2;
+    // Look the tile up in the grid (works across chunk borders)
+    TileType type = WorldGetTileType(world, tileX, tileY);
+    return (TileGetDefaultFlags(type) & TILE_FLAG_SOLID) != 0;
+}
 
-    // Adjusted edge calculations to align with visual walls
-    int leftEdge = centerX - (screenWidthInTiles / 2);
-    int rightEdge = centerX + (screenWidthInTiles / 2) - 1; // +1 to fix right collider
-    int topEdge = centerY - (screenHeightInTiles / 2) - 1;  // -1 to fix top collider
-    int bottomEdge = centerY + (screenHeightInTiles / 2);
+/**
+ * @brief Get tile type at position
+ *
+ * @param world Pointer to world
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @return TileType Tile type (TILE_TYPE_WALL if out of bounds)
+ */
+TileType WorldGetTileType(World* world, int x, int y) {
+    if (!world) return TILE_TYPE_WALL;
 
-    // Border collision logic with fixed positions
-    if ((tileX == leftEdge || tileX == rightEdge) && (tileY >= topEdge && tileY <= bottomEdge)) {
-        return true;
-    }
-    if ((tileY == topEdge || tileY == bottomEdge) && (tileX >= leftEdge && tileX <= rightEdge)) {
-        return true;
+    // Streamed worlds look the tile up in its chunk
+    if (world->chunks) {
+        return ChunkMapGetTile(world->chunks, x, y);
     }
 
-    // Horizontal wall at exact center
-    if (tileY == centerY && abs(tileX - centerX) <= 2) {
-        return true;
+    if (!world->tiles) return TILE_TYPE_WALL;
+
+    // Out of bounds is considered a wall
+    if (x < 0 || x >= world->width || y < 0 || y >= world->height) {
+        return TILE_TYPE_WALL;
     }
 
-    // Vertical walls 4 tiles from center
-    if ((tileX == centerX - 4 || tileX == centerX + 4) && abs(tileY - centerY) <= 1) {
-        return true;
+    return (TileType)world->tiles[y * world->width + x];
+}
+
+/**
+ * @brief Add an entity spawn point
+ *
+ * @param world Pointer to world
+ * @param type Entity to spawn
+ * @param tileX Spawn X position in tiles
+ * @param tileY Spawn Y position in tiles
+ * @param param Type-specific parameter
+ * @return true Spawn point added
+ * @return false Failed to add spawn point
+ */
+bool WorldAddSpawn(World* world, SpawnType type, int tileX, int tileY, int param) {
+    if (!world || type < 0 || type >= SPAWN_TYPE_COUNT) return false;
+
+    // Grow the spawn array if needed
+    if (world->spawnCount >= world->spawnCapacity) {
+        int newCapacity = world->spawnCapacity > 0 ? world->spawnCapacity * 2 : 8;
+        WorldSpawn* newSpawns = (WorldSpawn*)realloc(world->spawns, sizeof(WorldSpawn) * newCapacity);
+        if (!newSpawns) {
+            TraceLog(LOG_ERROR, "Failed to expand spawn array");
+            return false;
+        }
+
+        world->spawns = newSpawns;
+        world->spawnCapacity = newCapacity;
     }
 
-    // Not a wall
-    return false;
+    world->spawns[world->spawnCount] = (WorldSpawn){ type, tileX, tileY, param };
+    world->spawnCount++;
+
+    return true;
 }
 
+/**
+ * @brief Find the first spawn point of a type
+ *
+ * @param world Pointer to world
+ * @param type Entity type to look for
+ * @return const WorldSpawn* Spawn point or NULL if none
+ */
+const WorldSpawn* WorldFindSpawn(World* world, SpawnType type) {
+    if (!world) return NULL;
+
+    for (int i = 0; i < world->spawnCount; i++) {
+        if (world->spawns[i].type == type) {
+            return &world->spawns[i];
+        }
+    }
+
+    return NULL;
+}
 
 /**
  * @brief Load a world from file
  *
- * This function loads world data from a file, including tiles,
- * rooms, and any other world-specific information.
+ * This function memory-maps a level file and copies its tile section into
+ * the world's tile grid in one go, so no per-tile parsing happens; the
+ * tile types were checked when the file was written. Rooms,
+ * connections, spawn points and the hole/goal positions are read from
+ * the remaining sections, then the file is unmapped.
  *
  * @param filename Path to world file
  * @return World* Pointer to the loaded world or NULL if failed
@@ -260,45 +531,139 @@ bool WorldIsWallAtPosition(World* world, float x, float y) {
 World* WorldLoad(const char* filename) {
     if (!filename) return NULL;
 
-    // In a real implementation, this would read from a file
-    // For this stub, we'll create a basic world
+    // Map the level file
+    PlatformFileMap map;
+    if (!PlatformMapFile(filename, &map)) {
+        TraceLog(LOG_ERROR, "Failed to open level file: %s", filename);
+        return NULL;
+    }
+
+    LevelView view;
+    if (!LevelOpenView(map.data, map.size, &view)) {
+        TraceLog(LOG_ERROR, "Invalid level file: %s", filename);
+        PlatformUnmapFile(&map);
+        return NULL;
+    }
 
-    // Create default world with the standard dimensions
-    World* world = WorldCreate(WORLD_WIDTH, WORLD_HEIGHT);
+    const LevelFileHeader* header = view.header;
+#if SIM_FIXED_POINT
+    // Fixed-point positions only reach FIXED_MAX_INT pixels
+    if (header->width > FIXED_MAX_INT / TILE_WIDTH || header->height > FIXED_MAX_INT / TILE_HEIGHT) {
+        TraceLog(LOG_ERROR, "Level %s is too large for fixed-point simulation (%dx%d)",
+            filename, header->width, header->height);
+        PlatformUnmapFile(&map);
+        return NULL;
+    }
+#endif
+    World* world = WorldAllocate(header->width, header->height);
     if (!world) {
-        TraceLog(LOG_ERROR, "Failed to create world when loading %s", filename);
+        PlatformUnmapFile(&map);
         return NULL;
     }
 
-    // For demonstration, initialize a basic layout
-    for (int x = 0; x < world->width; x++) {
-        for (int y = 0; y < world->height; y++) {
-            // Set borders as walls
-            if (x == 0 || y == 0 || x == world->width - 1 || y == world->height - 1) {
-                WorldSetTileType(world, x, y, TILE_TYPE_WALL);
-            }
-            else {
-                WorldSetTileType(world, x, y, TILE_TYPE_EMPTY);
-            }
+    // Copy the tile section out of the mapping so the world never reads
+    // the file again; it may be truncated or rewritten while we run.
+    size_t tileCount = (size_t)world->width * world->height;
+    world->tiles = (unsigned char*)malloc(tileCount);
+    if (!world->tiles) {
+        TraceLog(LOG_ERROR, "Failed to allocate tiles for level %s", filename);
+        WorldDestroy(world);
+        PlatformUnmapFile(&map);
+        return NULL;
+    }
+    memcpy(world->tiles, view.tiles, tileCount);
+
+    // Level metadata
+    world->isOpenWorld = (header->flags & LEVEL_FLAG_OPEN_WORLD) != 0;
+    world->holePosition = (Vector2){ header->holeX, header->holeY };
+    world->holeRadius = header->holeRadius;
+    world->goalArea = (Rectangle){
+        (float)header->goalX,
+        (float)header->goalY,
+        (float)header->goalWidth,
+        (float)header->goalHeight
+    };
+
+    // Create rooms
+    for (uint32_t i = 0; i < header->roomCount; i++) {
+        const LevelRoomRecord* record = &view.rooms[i];
+        if (record->width <= 0 || record->height <= 0) {
+            TraceLog(LOG_ERROR, "Invalid room %u in level %s", i, filename);
+            WorldDestroy(world);
+            PlatformUnmapFile(&map);
+            return NULL;
         }
+
+        RoomType type = (record->type >= 0 && record->type < ROOM_TYPE_COUNT) ?
+            (RoomType)record->type : ROOM_TYPE_NORMAL;
+
+        Room* room = RoomCreate(record->id, type, record->x, record->y, record->width, record->height);
+        if (!room || WorldAddRoom(world, room) < 0) {
+            RoomDestroy(room);
+            WorldDestroy(world);
+            PlatformUnmapFile(&map);
+            return NULL;
+        }
+    }
+
+    // Wire room connections
+    for (uint32_t i = 0; i < header->connectionCount; i++) {
+        const LevelConnectionRecord* connection = &view.connections[i];
+        if (connection->fromRoom < 0 || connection->fromRoom >= world->roomCount ||
+            connection->toRoom < 0 || connection->toRoom >= world->roomCount) {
+            TraceLog(LOG_WARNING, "Skipping invalid connection %u in level %s", i, filename);
+            continue;
+        }
+
+        // Each record is one door; two-way connections are stored as two records
+        WorldAddDoor(
+            world,
+            world->rooms[connection->fromRoom],
+            (ConnectionDirection)connection->direction,
+            world->rooms[connection->toRoom]
+        );
     }
 
-    // Add some obstacles (same as in WorldIsWallAtPosition)
-    int centerX = world->width / 2;
-    int centerY = world->height / 2;
+    // Copy spawn points, skipping types this build does not know
+    for (uint32_t i = 0; i < header->spawnCount; i++) {
+        const LevelSpawnRecord* spawn = &view.spawns[i];
+        if (spawn->type < 0 || spawn->type >= SPAWN_TYPE_COUNT) {
+            TraceLog(LOG_WARNING, "Skipping unknown spawn type %d in level %s", spawn->type, filename);
+            continue;
+        }
 
-    // Horizontal wall in the middle
-    for (int i = centerX - 5; i <= centerX + 5; i++) {
-        WorldSetTileType(world, i, centerY, TILE_TYPE_WALL);
+        WorldAddSpawn(world, (SpawnType)spawn->type, spawn->tileX, spawn->tileY, spawn->param);
     }
 
-    // Vertical walls on sides
-    for (int j = centerY - 3; j <= centerY + 3; j++) {
-        WorldSetTileType(world, centerX - 10, j, TILE_TYPE_WALL);
-        WorldSetTileType(world, centerX + 10, j, TILE_TYPE_WALL);
-    }//*/
+    // Start in the level's start room
+    if (header->startRoom >= 0 && header->startRoom < world->roomCount) {
+        world->currentRoom = header->startRoom;
+    }
 
-    TraceLog(LOG_INFO, "Created default world (no actual file loaded)");
+    // Everything has been read out of the file
+    PlatformUnmapFile(&map);
+
+    // Room tiles mirror the world grid under the room. Only the start room
+    // is filled now; the others load in the background once next to it.
+    if (world->roomCount > 1) {
+        world->roomStreamer = RoomStreamerCreate(world->tiles, world->width, world->height);
+    }
+    for (int i = 0; i < world->roomCount; i++) {
+        Room* room = world->rooms[i];
+        if (i == world->currentRoom || !world->roomStreamer) {
+            RoomLoadTilesFromGrid(room, world->tiles, world->width, world->height, room->x, room->y);
+        }
+        else {
+            room->state = ROOM_STATE_UNLOADED;
+        }
+    }
+    if (world->roomCount > 0) {
+        world->rooms[world->currentRoom]->isDiscovered = true;
+        WorldPrefetchRooms(world, world->currentRoom);
+    }
+
+    TraceLog(LOG_INFO, "Loaded level %s (%dx%d, %d rooms, %d spawns)",
+        filename, world->width, world->height, world->roomCount, world->spawnCount);
 
     return world;
 }
@@ -317,21 +682,221 @@ World* WorldLoad(const char* filename) {
 void WorldSetTileType(World* world, int x, int y, TileType type) {
     if (!world) return;
 
+    // Streamed worlds edit the chunk, which is saved when evicted
+    if (world->chunks) {
+        if (!ChunkMapSetTile(world->chunks, x, y, type)) {
+            TraceLog(LOG_WARNING, "Attempted to set tile in unloaded chunk: (%d, %d)", x, y);
+        }
+        return;
+    }
+
+    if (!world->tiles) return;
+
     // Check bounds
     if (x < 0 || x >= world->width || y < 0 || y >= world->height) {
         TraceLog(LOG_WARNING, "Attempted to set tile out of bounds: (%d, %d)", x, y);
         return;
     }
 
-    // In a full implementation, we would allocate and store tiles
-    // For this stub, we'll just keep track in a simple way
+    // Store the tile type in the world grid
+    world->tiles[y * world->width + x] = (unsigned char)type;
+}
 
-    // For now, we're not actually storing the tile types in memory
-    // In a real implementation, you would update the tile in the world grid
-    // world->tiles[y * world->width + x].type = type;
+/**
+ * @brief Make sure no background room load is reading part of the grid
+ *
+ * @param world Pointer to world
+ * @param x Left edge in tiles
+ * @param y Top edge in tiles
+ * @param width Width in tiles
+ * @param height Height in tiles
+ */
+static void WorldWaitForRoomLoads(World* world, int x, int y, int width, int height) {
+    if (!world->roomStreamer || world->roomStreamer->pendingJobs == 0) return;
+
+    for (int i = 0; i < world->roomCount; i++) {
+        Room* room = world->rooms[i];
+        if (room->state != ROOM_STATE_LOADING) continue;
+        if (x >= room->x + room->width || room->x >= x + width ||
+            y >= room->y + room->height || room->y >= y + height) continue;
+
+        RoomStreamerWait(world->roomStreamer, room);
+    }
+}
+
+/**
+ * @brief Record a region of edited tiles
+ *
+ * A region touching or overlapping one already recorded is merged into
+ * it. When the list is full the region is merged into the last one,
+ * which refreshes more tiles than needed but never the whole world.
+ *
+ * @param world Pointer to world
+ * @param region Region to record
+ */
+static void WorldMarkDirty(World* world, WorldTileRegion region) {
+    int target = -1;
+    for (int i = 0; i < world->dirtyRegionCount; i++) {
+        const WorldTileRegion* dirty = &world->dirtyRegions[i];
+        if (region.x <= dirty->x + dirty->width && dirty->x <= region.x + region.width &&
+            region.y <= dirty->y + dirty->height && dirty->y <= region.y + region.height) {
+            target = i;
+            break;
+        }
+    }
 
-    // Log the change for debugging
-    TraceLog(LOG_DEBUG, "Set tile at (%d, %d) to type %d", x, y, type);
+    if (target < 0 && world->dirtyRegionCount < WORLD_MAX_DIRTY_REGIONS) {
+        world->dirtyRegions[world->dirtyRegionCount++] = region;
+        return;
+    }
+    if (target < 0) {
+        target = world->dirtyRegionCount - 1;
+    }
+
+    WorldTileRegion* dirty = &world->dirtyRegions[target];
+    int right = dirty->x + dirty->width > region.x + region.width ? dirty->x + dirty->width : region.x + region.width;
+    int bottom = dirty->y + dirty->height > region.y + region.height ? dirty->y + dirty->height : region.y + region.height;
+    dirty->x = dirty->x < region.x ? dirty->x : region.x;
+    dirty->y = dirty->y < region.y ? dirty->y : region.y;
+    dirty->width = right - dirty->x;
+    dirty->height = bottom - dirty->y;
+}
+
+/**
+ * @brief Change a tile while the game is running
+ *
+ * @param world Pointer to world
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @param type Tile type to set
+ * @return true Tile changed
+ * @return false Tile already had that type, or is out of bounds
+ */
+bool WorldEditTile(World* world, int x, int y, TileType type) {
+    return WorldEditRegion(world, x, y, 1, 1, type) > 0;
+}
+
+/**
+ * @brief Change a rectangle of tiles while the game is running
+ *
+ * Only the bounds of the tiles that actually changed are recorded.
+ *
+ * @param world Pointer to world
+ * @param x Left edge in tiles
+ * @param y Top edge in tiles
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param type Tile type to set
+ * @return int Number of tiles changed
+ */
+int WorldEditRegion(World* world, int x, int y, int width, int height, TileType type) {
+    if (!world) return 0;
+
+    // Clip to the world
+    int startX = x > 0 ? x : 0;
+    int startY = y > 0 ? y : 0;
+    int endX = x + width < world->width ? x + width : world->width;
+    int endY = y + height < world->height ? y + height : world->height;
+    if (startX >= endX || startY >= endY) return 0;
+
+    WorldWaitForRoomLoads(world, startX, startY, endX - startX, endY - startY);
+
+    int changed = 0;
+    int minX = endX, minY = endY, maxX = startX - 1, maxY = startY - 1;
+    for (int tileY = startY; tileY < endY; tileY++) {
+        for (int tileX = startX; tileX < endX; tileX++) {
+            if (WorldGetTileType(world, tileX, tileY) == type) continue;
+
+            WorldSetTileType(world, tileX, tileY, type);
+            changed++;
+            if (tileX < minX) minX = tileX;
+            if (tileY < minY) minY = tileY;
+            if (tileX > maxX) maxX = tileX;
+            if (tileY > maxY) maxY = tileY;
+        }
+    }
+
+    if (changed > 0) {
+        WorldMarkDirty(world, (WorldTileRegion){ minX, minY, maxX - minX + 1, maxY - minY + 1 });
+    }
+    return changed;
+}
+
+/**
+ * @brief Put back a saved copy of the tile grid while the game is running
+ *
+ * Only the bounds of the tiles that differ are recorded, waited on and
+ * copied, so putting back an unchanged grid is one compare.
+ *
+ * @param world Pointer to world
+ * @param tiles Row-major grid of world->width * world->height tile types
+ * @return int Number of tiles changed
+ */
+int WorldRestoreTiles(World* world, const unsigned char* tiles) {
+    if (!world || !world->tiles || !tiles) return 0;
+
+    size_t tileCount = (size_t)world->width * (size_t)world->height;
+    if (memcmp(world->tiles, tiles, tileCount) == 0) return 0;
+
+    int changed = 0;
+    int minX = world->width, minY = world->height, maxX = -1, maxY = -1;
+    for (int tileY = 0; tileY < world->height; tileY++) {
+        const unsigned char* row = world->tiles + (size_t)tileY * world->width;
+        const unsigned char* savedRow = tiles + (size_t)tileY * world->width;
+        if (memcmp(row, savedRow, world->width) == 0) continue;
+
+        for (int tileX = 0; tileX < world->width; tileX++) {
+            if (row[tileX] == savedRow[tileX]) continue;
+
+            changed++;
+            if (tileX < minX) minX = tileX;
+            if (tileY < minY) minY = tileY;
+            if (tileX > maxX) maxX = tileX;
+            if (tileY > maxY) maxY = tileY;
+        }
+    }
+
+    WorldTileRegion region = { minX, minY, maxX - minX + 1, maxY - minY + 1 };
+    WorldWaitForRoomLoads(world, region.x, region.y, region.width, region.height);
+
+    for (int tileY = region.y; tileY < region.y + region.height; tileY++) {
+        size_t offset = (size_t)tileY * world->width + region.x;
+        memcpy(world->tiles + offset, tiles + offset, (size_t)region.width);
+    }
+
+    WorldMarkDirty(world, region);
+    return changed;
+}
+
+/**
+ * @brief Bring everything built from the grid up to date with tile edits
+ *
+ * Rooms keep a copy of the tiles under them; only the edited tiles of
+ * ready rooms are copied again. Rooms still to load read the edited
+ * grid anyway.
+ *
+ * @param world Pointer to world
+ */
+void WorldFlushTileEdits(World* world) {
+    if (!world || world->dirtyRegionCount == 0) return;
+
+    if (world->tiles && !world->chunks) {
+        for (int i = 0; i < world->dirtyRegionCount; i++) {
+            const WorldTileRegion* region = &world->dirtyRegions[i];
+
+            for (int j = 0; j < world->roomCount; j++) {
+                Room* room = world->rooms[j];
+                if (room->state != ROOM_STATE_READY) continue;
+                if (region->x >= room->x + room->width || room->x >= region->x + region->width ||
+                    region->y >= room->y + room->height || room->y >= region->y + region->height) continue;
+
+                RoomRefreshTilesFromGrid(room, world->tiles, world->width, world->height,
+                    region->x, region->y, region->width, region->height);
+            }
+        }
+    }
+
+    world->dirtyRegionCount = 0;
 }
 
 /**
@@ -383,8 +948,8 @@ void TileToWorldCoordinates(World* world, int tileX, int tileY, float* worldX, f
 /**
  * @brief Save a world to file
  *
- * This function saves the current world state to a file, including all tiles,
- * rooms, and other world data for later loading.
+ * This function saves the current world state to a level file, including
+ * all tiles, rooms, connections, spawn points and the hole/goal positions.
  *
  * @param world Pointer to world
  * @param filename Path to save file
@@ -394,19 +959,115 @@ void TileToWorldCoordinates(World* world, int tileX, int tileY, float* worldX, f
 bool WorldSave(World* world, const char* filename) {
     if (!world || !filename) return false;
 
-    // In a real implementation, we would write the world data to a file
-    // For this stub, we'll just log what would happen
-    TraceLog(LOG_INFO, "Would save world to file: %s", filename);
-    TraceLog(LOG_INFO, "World dimensions: %d x %d", world->width, world->height);
+    // Streamed worlds save edited chunks to their chunk directory instead
+    if (world->chunks) {
+        int remaining = ChunkMapFlush(world->chunks);
+        if (remaining > 0) {
+            TraceLog(LOG_WARNING, "%d edited chunks could not be queued for saving yet", remaining);
+        }
+        return remaining == 0;
+    }
+
+    if (!world->tiles) return false;
+
+    // Count connections so the record arrays can be sized up front
+    int connectionCount = 0;
+    for (int i = 0; i < world->roomCount; i++) {
+        for (int d = 0; d < 4; d++) {
+            if (world->rooms[i]->exits[d]) connectionCount++;
+        }
+    }
+
+    LevelRoomRecord* rooms = NULL;
+    LevelConnectionRecord* connections = NULL;
+    LevelSpawnRecord* spawns = NULL;
 
-    // Example of what might be saved:
-    // - World dimensions
-    // - Tile types for all tiles
-    // - Room data
-    // - Entity placements
-    // - Other world properties
+    if (world->roomCount > 0) {
+        rooms = (LevelRoomRecord*)calloc(world->roomCount, sizeof(LevelRoomRecord));
+    }
+    if (connectionCount > 0) {
+        connections = (LevelConnectionRecord*)calloc(connectionCount, sizeof(LevelConnectionRecord));
+    }
+    if (world->spawnCount > 0) {
+        spawns = (LevelSpawnRecord*)calloc(world->spawnCount, sizeof(LevelSpawnRecord));
+    }
+
+    if ((world->roomCount > 0 && !rooms) || (connectionCount > 0 && !connections) ||
+        (world->spawnCount > 0 && !spawns)) {
+        TraceLog(LOG_ERROR, "Failed to allocate level records for %s", filename);
+        free(rooms);
+        free(connections);
+        free(spawns);
+        return false;
+    }
 
-    return true; // Pretend the save was successful
+    // Room records
+    for (int i = 0; i < world->roomCount; i++) {
+        Room* room = world->rooms[i];
+        rooms[i].id = room->id;
+        rooms[i].type = room->type;
+        rooms[i].x = room->x;
+        rooms[i].y = room->y;
+        rooms[i].width = room->width;
+        rooms[i].height = room->height;
+    }
+
+    // Connection records (exits are stored N, E, S, W)
+    int connectionIndex = 0;
+    for (int i = 0; i < world->roomCount; i++) {
+        for (int d = 0; d < 4; d++) {
+            Room* exit = world->rooms[i]->exits[d];
+            if (!exit) continue;
+
+            // Find the index of the connected room
+            int target = -1;
+            for (int j = 0; j < world->roomCount; j++) {
+                if (world->rooms[j] == exit) {
+                    target = j;
+                    break;
+                }
+            }
+            if (target < 0) continue;
+
+            connections[connectionIndex].fromRoom = i;
+            connections[connectionIndex].toRoom = target;
+            connections[connectionIndex].direction = 1 << d;
+            connectionIndex++;
+        }
+    }
+
+    // Spawn records
+    for (int i = 0; i < world->spawnCount; i++) {
+        spawns[i].type = world->spawns[i].type;
+        spawns[i].tileX = world->spawns[i].tileX;
+        spawns[i].tileY = world->spawns[i].tileY;
+        spawns[i].param = world->spawns[i].param;
+    }
+
+    // Header with dimensions, counts and level metadata
+    LevelFileHeader header = { 0 };
+    header.width = world->width;
+    header.height = world->height;
+    header.roomCount = (uint32_t)world->roomCount;
+    header.connectionCount = (uint32_t)connectionIndex;
+    header.spawnCount = (uint32_t)world->spawnCount;
+    header.startRoom = world->currentRoom;
+    header.flags = world->isOpenWorld ? LEVEL_FLAG_OPEN_WORLD : LEVEL_FLAG_NONE;
+    header.holeX = world->holePosition.x;
+    header.holeY = world->holePosition.y;
+    header.holeRadius = world->holeRadius;
+    header.goalX = (int32_t)world->goalArea.x;
+    header.goalY = (int32_t)world->goalArea.y;
+    header.goalWidth = (int32_t)world->goalArea.width;
+    header.goalHeight = (int32_t)world->goalArea.height;
+
+    bool success = LevelWriteFile(filename, &header, world->tiles, rooms, connections, spawns);
+
+    free(rooms);
+    free(connections);
+    free(spawns);
+
+    return success;
 }
 
 /**
@@ -447,11 +1108,24 @@ void WorldGetVisibleArea(World* world, Camera2D* camera, int* startTileX, int* s
     if (*endTileY >= world->height) *endTileY = world->height - 1;
 }
 
+/**
+ * @brief Find a room's index in the world
+ *
+ * @param world Pointer to world
+ * @param room Pointer to room
+ * @return int Index of room or -1 if not in the world
+ */
+static int WorldFindRoomIndex(World* world, Room* room) {
+    for (int i = 0; i < world->roomCount; i++) {
+        if (world->rooms[i] == room) return i;
+    }
+    return -1;
+}
+
 /**
  * @brief Add a room to the world
  *
- * This function adds a new room to the world's room collection.
- * Used for level design with multiple connected rooms.
+ * The world takes ownership of the room and frees it when destroyed.
  *
  * @param world Pointer to world
  * @param room Pointer to room to add
@@ -460,16 +1134,145 @@ void WorldGetVisibleArea(World* world, Camera2D* camera, int* startTileX, int* s
 int WorldAddRoom(World* world, Room* room) {
     if (!world || !room) return -1;
 
-    // In a real implementation, we would:
-    // 1. Reallocate the rooms array if needed
-    // 2. Add the room to the array
-    // 3. Update connections between rooms
+    // Grow the room array if needed
+    if (world->roomCount >= world->roomCapacity) {
+        int newCapacity = world->roomCapacity > 0 ? world->roomCapacity * 2 : 8;
+        Room** newRooms = (Room**)realloc(world->rooms, sizeof(Room*) * newCapacity);
+        if (!newRooms) {
+            TraceLog(LOG_ERROR, "Failed to expand room array");
+            return -1;
+        }
+
+        world->rooms = newRooms;
+        world->roomCapacity = newCapacity;
+    }
+
+    world->rooms[world->roomCount] = room;
+    world->activeRoomsFor = -1;
+    return world->roomCount++;
+}
+
+/**
+ * @brief Connect two rooms with a door in each
+ *
+ * @param world Pointer to world
+ * @param fromRoom Index of first room
+ * @param direction Side of the first room the door is on
+ * @param toRoom Index of second room
+ * @return true Rooms connected
+ * @return false Invalid room or direction
+ */
+bool WorldConnectRooms(World* world, int fromRoom, ConnectionDirection direction, int toRoom) {
+    if (!world || fromRoom < 0 || fromRoom >= world->roomCount || toRoom < 0 || toRoom >= world->roomCount) {
+        return false;
+    }
+
+    for (int i = 0; i < WORLD_DOOR_SIDE_COUNT; i++) {
+        if (gWorldDoorSides[i].direction != direction) continue;
 
-    // For this stub, we'll just log what would happen
-    TraceLog(LOG_INFO, "Would add room ID %d to world", room->id);
+        const WorldDoorSide* opposite = &gWorldDoorSides[(i + WORLD_DOOR_SIDE_COUNT / 2) % WORLD_DOOR_SIDE_COUNT];
+        return WorldAddDoor(world, world->rooms[fromRoom], direction, world->rooms[toRoom]) &&
+            WorldAddDoor(world, world->rooms[toRoom], opposite->direction, world->rooms[fromRoom]);
+    }
 
-    // Pretend we added it successfully
-    return world->roomCount; // This would normally be the index of the added room
+    TraceLog(LOG_WARNING, "Invalid connection direction: %d", direction);
+    return false;
+}
+
+/**
+ * @brief Find the rooms to simulate if the current room changed
+ *
+ * @param world Pointer to world
+ */
+static void WorldUpdateActiveRooms(World* world) {
+    if (world->activeRoomsFor >= 0 && world->activeRoomsFor == world->currentRoom) return;
+
+    world->activeRoomCount = 0;
+    world->activeRoomsFor = world->currentRoom;
+    if (world->currentRoom < 0 || world->currentRoom >= world->roomCount) return;
+
+    Room* room = world->rooms[world->currentRoom];
+    world->activeRooms[world->activeRoomCount++] = world->currentRoom;
+
+    for (int i = 0; i < WORLD_DOOR_SIDE_COUNT; i++) {
+        Room* next = RoomGetConnected(room, gWorldDoorSides[i].direction);
+        if (!next) continue;
+
+        // Two doors may lead to the same room
+        int nextIndex = WorldFindRoomIndex(world, next);
+        bool listed = nextIndex < 0;
+        for (int j = 0; j < world->activeRoomCount && !listed; j++) {
+            listed = world->activeRooms[j] == nextIndex;
+        }
+        if (!listed) {
+            world->activeRooms[world->activeRoomCount++] = nextIndex;
+        }
+    }
+}
+
+/**
+ * @brief Check whether a room is being simulated
+ *
+ * @param world Pointer to world
+ * @param roomIndex Index of room
+ * @return true Room is active
+ * @return false Room is asleep or invalid
+ */
+bool WorldIsRoomActive(World* world, int roomIndex) {
+    if (!world) return false;
+
+    WorldUpdateActiveRooms(world);
+    for (int i = 0; i < world->activeRoomCount; i++) {
+        if (world->activeRooms[i] == roomIndex) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Check whether things at a position should be simulated
+ *
+ * Only the few active rooms are tested, so the cost does not grow with
+ * the number of rooms.
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ * @return true Position is inside an active room
+ * @return false Position is asleep
+ */
+bool WorldIsPositionActive(World* world, float x, float y) {
+    if (!world || world->roomCount < 2) return true;
+
+    WorldUpdateActiveRooms(world);
+    for (int i = 0; i < world->activeRoomCount; i++) {
+        Rectangle bounds = world->rooms[world->activeRooms[i]]->bounds;
+        if (x >= bounds.x && x < bounds.x + bounds.width &&
+            y >= bounds.y && y < bounds.y + bounds.height) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Find the room containing a position
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ * @return int Index of room or -1 if the position is in no room
+ */
+int WorldFindRoomAtPosition(World* world, float x, float y) {
+    if (!world) return -1;
+
+    for (int i = 0; i < world->roomCount; i++) {
+        Rectangle bounds = world->rooms[i]->bounds;
+        if (x >= bounds.x && x < bounds.x + bounds.width &&
+            y >= bounds.y && y < bounds.y + bounds.height) {
+            return i;
+        }
+    }
+    return -1;
 }
 
 /**
@@ -492,18 +1295,110 @@ bool WorldChangeRoom(World* world, int roomIndex) {
         return false;
     }
 
-    // In a real implementation, we would:
-    // 1. Save state of current room if needed
-    // 2. Update current room index
-    // 3. Set up camera for new room
-    // 4. Trigger any room entry events
+    // Prefetched rooms are ready by now; any other room is loaded here
+    Room* room = world->rooms[roomIndex];
+    RoomStreamerWait(world->roomStreamer, room);
 
     TraceLog(LOG_INFO, "Changing from room %d to room %d", world->currentRoom, roomIndex);
     world->currentRoom = roomIndex;
+    room->isDiscovered = true;
+
+    // Get the rooms one door further on ready before they are needed
+    WorldPrefetchRooms(world, roomIndex);
 
     return true;
 }
 
+/**
+ * @brief Start loading the rooms connected to a room in the background
+ *
+ * @param world Pointer to world
+ * @param roomIndex Index of room whose neighbours to load
+ */
+void WorldPrefetchRooms(World* world, int roomIndex) {
+    if (!world || !world->roomStreamer || roomIndex < 0 || roomIndex >= world->roomCount) return;
+
+    Room* room = world->rooms[roomIndex];
+    for (int i = 0; i < WORLD_DOOR_SIDE_COUNT; i++) {
+        Room* next = RoomGetConnected(room, gWorldDoorSides[i].direction);
+        if (next && !RoomStreamerRequest(world->roomStreamer, next)) {
+            TraceLog(LOG_DEBUG, "Room loader busy, room %d will load on entry", next->id);
+        }
+    }
+}
+
+/**
+ * @brief Wait until every room being loaded in the background is ready
+ *
+ * @param world Pointer to world
+ */
+void WorldFinishRoomLoads(World* world) {
+    if (!world) return;
+
+    RoomStreamerFinish(world->roomStreamer);
+}
+
+/**
+ * @brief Go through a door of the current room
+ *
+ * The doors of a connection face each other, so going out of the east
+ * door arrives one tile inside the next room's west door.
+ *
+ * @param world Pointer to world
+ * @param tileX Door X position in tiles
+ * @param tileY Door Y position in tiles
+ * @param arriveX Pointer to store where to arrive in the next room (X in pixels)
+ * @param arriveY Pointer to store where to arrive in the next room (Y in pixels)
+ * @return true Changed to the room behind the door
+ * @return false The tile is not a door of the current room
+ */
+bool WorldUseDoor(World* world, int tileX, int tileY, float* arriveX, float* arriveY) {
+    if (!world || !world->rooms || world->currentRoom < 0 || world->currentRoom >= world->roomCount) return false;
+
+    Room* room = world->rooms[world->currentRoom];
+    for (int i = 0; i < WORLD_DOOR_SIDE_COUNT; i++) {
+        const WorldDoorSide* exitSide = &gWorldDoorSides[i];
+        Room* next = RoomGetConnected(room, exitSide->direction);
+
+        int doorX = 0, doorY = 0;
+        if (!next || !RoomGetDoorPosition(room, exitSide->direction, &doorX, &doorY)) continue;
+        if (room->x + doorX != tileX || room->y + doorY != tileY) continue;
+
+        int nextIndex = WorldFindRoomIndex(world, next);
+        if (nextIndex < 0 || !WorldChangeRoom(world, nextIndex)) return false;
+
+        // Step in from the door on the side we came through
+        const WorldDoorSide* entrySide = &gWorldDoorSides[(i + WORLD_DOOR_SIDE_COUNT / 2) % WORLD_DOOR_SIDE_COUNT];
+        int entryX = 0, entryY = 0;
+        RoomGetDoorPosition(next, entrySide->direction, &entryX, &entryY);
+        if (arriveX) *arriveX = (next->x + entryX - entrySide->stepX + 0.5f) * TILE_WIDTH;
+        if (arriveY) *arriveY = (next->y + entryY - entrySide->stepY + 0.5f) * TILE_HEIGHT;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Activate a trigger tile in the current room
+ *
+ * Switches flip their data between off (0) and on (1).
+ *
+ * @param world Pointer to world
+ * @param tileX Trigger X position in tiles
+ * @param tileY Trigger Y position in tiles
+ */
+void WorldActivateTrigger(World* world, int tileX, int tileY) {
+    if (!world || !world->rooms || world->currentRoom < 0 || world->currentRoom >= world->roomCount) return;
+
+    Room* room = world->rooms[world->currentRoom];
+    Tile* tile = RoomGetTile(room, tileX - room->x, tileY - room->y);
+    if (!tile || !TileHasFlags(tile, TILE_FLAG_TRIGGER)) return;
+
+    tile->data = !tile->data;
+    TraceLog(LOG_INFO, "Switch at (%d, %d) in room %d turned %s", tileX, tileY, room->id, tile->data ? "on" : "off");
+}
+
 /**
 * @brief Draw debug visualization of collision areas
 *
@@ -511,13 +1406,17 @@ bool WorldChangeRoom(World* world, int roomIndex) {
 * It is separate from normal rendering and only used in debug mode.
 *
 * @param world Pointer to world
+* @param camera Pointer to camera used to cull tiles
 */
-void DebugVisualizeCollisions(World* world) {
-    if (!world || !DEBUG_SHOW_COLLISIONS) return;
+void DebugVisualizeCollisions(World* world, Camera2D* camera) {
+    if (!world || !camera || !DEBUG_SHOW_COLLISIONS) return;
 
-    // Visualize all tiles in the world that would cause collision
-    for (int x = 0; x < world->width; x++) {
-        for (int y = 0; y < world->height; y++) {
+    int startX, startY, endX, endY;
+    WorldGetVisibleArea(world, camera, &startX, &startY, &endX, &endY);
+
+    // Visualize all visible tiles that would cause collision
+    for (int x = startX; x <= endX; x++) {
+        for (int y = startY; y <= endY; y++) {
             float worldX = x * TILE_WIDTH;
             float worldY = y * TILE_HEIGHT;
             float centerX = worldX + TILE_WIDTH / 2;
@@ -544,38 +1443,4 @@ void DebugVisualizeCollisions(World* world) {
             }
         }
     }
-
-    // Visualize middle obstacles
-    int gridCenterX = world->width / 2;
-    int gridCenterY = world->height / 2;
-
-    // Visualize horizontal wall in the middle
-    for (int x = gridCenterX - 2; x <= gridCenterX + 2; x++) {
-        DrawRectangle(
-            x * TILE_WIDTH,
-            gridCenterY * TILE_HEIGHT,
-            TILE_WIDTH,
-            TILE_HEIGHT,
-            RED
-        );
-    }
-
-    // Visualize vertical walls on sides
-    for (int y = gridCenterY - 1; y <= gridCenterY + 1; y++) {
-        DrawRectangle(
-            (gridCenterX - 4) * TILE_WIDTH,
-            y * TILE_HEIGHT,
-            TILE_WIDTH,
-            TILE_HEIGHT,
-            RED
-        );
-
-        DrawRectangle(
-            (gridCenterX + 4) * TILE_WIDTH,
-            y * TILE_HEIGHT,
-            TILE_WIDTH,
-            TILE_HEIGHT,
-            RED
-        );
-    }
 }
\ No newline at end of file
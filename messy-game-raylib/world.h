@@ -12,6 +12,47 @@
 #include <stdbool.h>
 #include "room.h"
 #include "tile.h"
+#include "chunk.h"
+#include "room_stream.h"
+#include "dungeon.h"
+
+#define WORLD_MAX_ACTIVE_ROOMS 5 // Rooms simulated at once: the current room and one behind each door
+#define WORLD_MAX_DIRTY_REGIONS 16 // Edited regions kept between flushes before new ones are merged in
+
+/**
+ * @brief Entity spawn types enumeration
+ *
+ * Defines which entity a level spawn point creates.
+ */
+typedef enum {
+    SPAWN_TYPE_PLAYER,
+    SPAWN_TYPE_BALL,
+    SPAWN_TYPE_SNAKE_BOSS,
+    // Add more spawn types as needed
+    SPAWN_TYPE_COUNT
+} SpawnType;
+
+/**
+ * @brief Entity spawn point
+ *
+ * Describes where a level places an entity when it is loaded.
+ */
+typedef struct {
+    SpawnType type;            // Entity to spawn
+    int tileX;                 // Spawn X position in tiles
+    int tileY;                 // Spawn Y position in tiles
+    int param;                 // Type-specific parameter (snake length, or ball count)
+} WorldSpawn;
+
+/**
+ * @brief Rectangle of tiles
+ */
+typedef struct {
+    int x;                     // Left edge in tiles
+    int y;                     // Top edge in tiles
+    int width;                 // Width in tiles
+    int height;                // Height in tiles
+} WorldTileRegion;
 
  /**
   * @brief World structure
@@ -19,14 +60,29 @@
   * Contains all data about the game world including rooms, tiles,
   * and world state.
   */
-typedef struct {
-    Tile** tiles;              // 2D grid of all tiles in the world
+typedef struct World {
+    unsigned char* tiles;      // Row-major grid of TileType values (width * height)
     int width;                 // Width of world in tiles
     int height;                // Height of world in tiles
-    Room** rooms;              // Array of rooms in the world
+    Room** rooms;              // Array of rooms in the world (owned)
     int roomCount;             // Number of rooms
+    int roomCapacity;          // Capacity of rooms array
     int currentRoom;           // Index of current room
+    int activeRooms[WORLD_MAX_ACTIVE_ROOMS]; // Indices of the rooms being simulated
+    int activeRoomCount;       // Number of active rooms
+    int activeRoomsFor;        // Current room the active rooms were found for (-1 = out of date)
     bool isOpenWorld;          // Whether the world is an open area or room-based
+    WorldSpawn* spawns;        // Array of entity spawn points
+    int spawnCount;            // Number of spawn points
+    int spawnCapacity;         // Capacity of spawn points array
+    Vector2 holePosition;      // Win hole position in pixels
+    float holeRadius;          // Win hole radius in pixels (0 = default hole)
+    Rectangle goalArea;        // Goal area in tiles (zero size = no goal)
+    ChunkMap* chunks;          // Streamed tiles (open worlds only, replaces tiles)
+    RoomStreamer* roomStreamer; // Loads rooms next to the current one (NULL with fewer than two rooms)
+    WorldTileRegion dirtyRegions[WORLD_MAX_DIRTY_REGIONS]; // Tiles edited since the last flush
+    int dirtyRegionCount;      // Number of dirty regions
+    float effectTimer;         // Time driving environmental effects
     // Add more world attributes as needed
 } World;
 
@@ -39,6 +95,31 @@ typedef struct {
  */
 World* WorldCreate(int width, int height);
 
+/**
+ * @brief Create a streamed open world
+ *
+ * Tiles are kept in CHUNK_SIZE chunks that stream in around the focus set
+ * by WorldStreamAround, so the world size does not affect memory use.
+ *
+ * @param widthInChunks World width in chunks
+ * @param heightInChunks World height in chunks
+ * @param chunkDirectory Directory holding saved chunk files
+ * @param seed Seed for generating chunks with no file
+ * @return World* Pointer to the created world
+ */
+World* WorldCreateOpen(int widthInChunks, int heightInChunks, const char* chunkDirectory, uint64_t seed);
+
+/**
+ * @brief Create a room world from a generated dungeon layout
+ *
+ * Every room is built and drawn into the grid up front. Safe to call on
+ * a worker thread, as it touches nothing but the new world.
+ *
+ * @param layout Pointer to generated layout
+ * @return World* Pointer to the created world or NULL if failed
+ */
+World* WorldCreateDungeon(const DungeonLayout* layout);
+
 /**
  * @brief Destroy world and free resources
  *
@@ -54,12 +135,25 @@ void WorldDestroy(World* world);
  */
 void WorldUpdate(World* world, float deltaTime);
 
+/**
+ * @brief Stream open world chunks around a position
+ *
+ * Does nothing for worlds that are not streamed.
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ */
+void WorldStreamAround(World* world, float x, float y);
+
 /**
  * @brief Render the world
  *
  * @param world Pointer to world
+ * @param renderer Renderer to draw with
+ * @param camera Pointer to camera used to cull tiles
  */
-void WorldRender(World* world);
+void WorldRender(World* world, struct Renderer* renderer, Camera2D* camera);
 
 /**
  * @brief Load a world from file
@@ -100,6 +194,92 @@ bool WorldIsWallAtPosition(World* world, float x, float y);
  */
 void WorldSetTileType(World* world, int x, int y, TileType type);
 
+/**
+ * @brief Change a tile while the game is running
+ *
+ * The grid, which collision reads, changes at once. Rooms showing the
+ * tile pick it up at the next WorldFlushTileEdits, which refreshes
+ * only the tiles edited.
+ *
+ * @param world Pointer to world
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @param type Tile type to set
+ * @return true Tile changed
+ * @return false Tile already had that type, or is out of bounds
+ */
+bool WorldEditTile(World* world, int x, int y, TileType type);
+
+/**
+ * @brief Change a rectangle of tiles while the game is running
+ *
+ * Like WorldEditTile, for every tile in the rectangle that is inside
+ * the world.
+ *
+ * @param world Pointer to world
+ * @param x Left edge in tiles
+ * @param y Top edge in tiles
+ * @param width Width in tiles
+ * @param height Height in tiles
+ * @param type Tile type to set
+ * @return int Number of tiles changed
+ */
+int WorldEditRegion(World* world, int x, int y, int width, int height, TileType type);
+
+/**
+ * @brief Put back a saved copy of the tile grid while the game is running
+ *
+ * Like WorldEditRegion, for every tile that differs from the copy: only
+ * background room loads over those tiles are waited for, and rooms pick
+ * them up at the next WorldFlushTileEdits.
+ *
+ * @param world Pointer to world
+ * @param tiles Row-major grid of world->width * world->height tile types
+ * @return int Number of tiles changed
+ */
+int WorldRestoreTiles(World* world, const unsigned char* tiles);
+
+/**
+ * @brief Bring everything built from the grid up to date with tile edits
+ *
+ * Called by WorldUpdate; call it directly to see edits before then.
+ *
+ * @param world Pointer to world
+ */
+void WorldFlushTileEdits(World* world);
+
+/**
+ * @brief Get tile type at position
+ *
+ * @param world Pointer to world
+ * @param x X position in tiles
+ * @param y Y position in tiles
+ * @return TileType Tile type (TILE_TYPE_WALL if out of bounds)
+ */
+TileType WorldGetTileType(World* world, int x, int y);
+
+/**
+ * @brief Add an entity spawn point
+ *
+ * @param world Pointer to world
+ * @param type Entity to spawn
+ * @param tileX Spawn X position in tiles
+ * @param tileY Spawn Y position in tiles
+ * @param param Type-specific parameter
+ * @return true Spawn point added
+ * @return false Failed to add spawn point
+ */
+bool WorldAddSpawn(World* world, SpawnType type, int tileX, int tileY, int param);
+
+/**
+ * @brief Find the first spawn point of a type
+ *
+ * @param world Pointer to world
+ * @param type Entity type to look for
+ * @return const WorldSpawn* Spawn point or NULL if none
+ */
+const WorldSpawn* WorldFindSpawn(World* world, SpawnType type);
+
 /**
  * @brief Convert world coordinates to tile coordinates
  *
@@ -125,15 +305,71 @@ void TileToWorldCoordinates(World* world, int tileX, int tileY, float* worldX, f
 /**
  * @brief Add a room to the world
  *
+ * The world takes ownership of the room and frees it when destroyed.
+ *
  * @param world Pointer to world
  * @param room Pointer to room to add
  * @return int Index of added room or -1 if failed
  */
 int WorldAddRoom(World* world, Room* room);
 
+/**
+ * @brief Connect two rooms with a door in each
+ *
+ * The second room gets its door on the opposite side. Both doors are
+ * written into the world grid so they can be walked through.
+ *
+ * @param world Pointer to world
+ * @param fromRoom Index of first room
+ * @param direction Side of the first room the door is on
+ * @param toRoom Index of second room
+ * @return true Rooms connected
+ * @return false Invalid room or direction
+ */
+bool WorldConnectRooms(World* world, int fromRoom, ConnectionDirection direction, int toRoom);
+
+/**
+ * @brief Check whether a room is being simulated
+ *
+ * Only the current room and the rooms connected to it are simulated;
+ * the rest sleep until the player comes near.
+ *
+ * @param world Pointer to world
+ * @param roomIndex Index of room
+ * @return true Room is active
+ * @return false Room is asleep or invalid
+ */
+bool WorldIsRoomActive(World* world, int roomIndex);
+
+/**
+ * @brief Check whether things at a position should be simulated
+ *
+ * Worlds with fewer than two rooms simulate everywhere.
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ * @return true Position is inside an active room
+ * @return false Position is asleep
+ */
+bool WorldIsPositionActive(World* world, float x, float y);
+
+/**
+ * @brief Find the room containing a position
+ *
+ * @param world Pointer to world
+ * @param x X position in world
+ * @param y Y position in world
+ * @return int Index of room or -1 if the position is in no room
+ */
+int WorldFindRoomAtPosition(World* world, float x, float y);
+
 /**
  * @brief Change to different room
  *
+ * Waits for the room if it is still loading, then starts loading the
+ * rooms connected to it.
+ *
  * @param world Pointer to world
  * @param roomIndex Index of room to change to
  * @return true Successful room change
@@ -141,6 +377,45 @@ int WorldAddRoom(World* world, Room* room);
  */
 bool WorldChangeRoom(World* world, int roomIndex);
 
+/**
+ * @brief Start loading the rooms connected to a room in the background
+ *
+ * @param world Pointer to world
+ * @param roomIndex Index of room whose neighbours to load
+ */
+void WorldPrefetchRooms(World* world, int roomIndex);
+
+/**
+ * @brief Wait until every room being loaded in the background is ready
+ *
+ * @param world Pointer to world
+ */
+void WorldFinishRoomLoads(World* world);
+
+/**
+ * @brief Go through a door of the current room
+ *
+ * @param world Pointer to world
+ * @param tileX Door X position in tiles
+ * @param tileY Door Y position in tiles
+ * @param arriveX Pointer to store where to arrive in the next room (X in pixels)
+ * @param arriveY Pointer to store where to arrive in the next room (Y in pixels)
+ * @return true Changed to the room behind the door
+ * @return false The tile is not a door of the current room
+ */
+bool WorldUseDoor(World* world, int tileX, int tileY, float* arriveX, float* arriveY);
+
+/**
+ * @brief Activate a trigger tile in the current room
+ *
+ * Switches flip their data between off (0) and on (1).
+ *
+ * @param world Pointer to world
+ * @param tileX Trigger X position in tiles
+ * @param tileY Trigger Y position in tiles
+ */
+void WorldActivateTrigger(World* world, int tileX, int tileY);
+
 /**
  * @brief Get visible area in the world
  *
@@ -160,7 +435,8 @@ void WorldGetVisibleArea(World* world, Camera2D* camera, int* startTileX, int* s
 * It is separate from normal rendering and only used in debug mode.
 *
 * @param world Pointer to world
+* @param camera Pointer to camera used to cull tiles
 */
-void DebugVisualizeCollisions(World* world);
+void DebugVisualizeCollisions(World* world, Camera2D* camera);
 
 #endif // MESSY_GAME_WORLD_H
\ No newline at end of file